@@ -49,15 +49,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ParsingUtils.h>
 #include "FileSystemFilter.h"
 #include "Importer.h"
+#include "ThreadPool.h"
 #include <assimp/ByteSwapper.h>
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/importerdesc.h>
 
+#include <algorithm>
 #include <ios>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <cctype>
 
@@ -480,7 +483,8 @@ struct Assimp::BatchData {
     : pIOSystem( pIO )
     , pImporter( nullptr )
     , next_id(0xffff)
-    , validate( validate ) {
+    , validate( validate )
+    , numThreads( 1 ) {
         ai_assert( nullptr != pIO );
         
         pImporter = new Importer();
@@ -509,10 +513,91 @@ struct Assimp::BatchData {
 
     // Validation enabled state
     bool validate;
+
+    // Number of threads used by LoadAll(), 0 for all hardware threads
+    unsigned int numThreads;
 };
 
 typedef std::list<LoadRequest>::iterator LoadReqIt;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Forwards all file access to the IO system of a BatchLoader, but keeps a directory stack of
+// its own. Importers running on different threads would otherwise push to the same stack.
+class BatchWorkerIOSystem : public IOSystem {
+public:
+    explicit BatchWorkerIOSystem( IOSystem* io )
+    : mIO( io ) {
+        // empty
+    }
+
+    bool Exists( const char* pFile ) const override {
+        return mIO->Exists( pFile );
+    }
+
+    char getOsSeparator() const override {
+        return mIO->getOsSeparator();
+    }
+
+    IOStream* Open( const char* pFile, const char* pMode = "rb" ) override {
+        return mIO->Open( pFile, pMode );
+    }
+
+    void Close( IOStream* pFile ) override {
+        mIO->Close( pFile );
+    }
+
+    bool ComparePaths( const char* one, const char* second ) const override {
+        return mIO->ComparePaths( one, second );
+    }
+
+    bool CreateDirectory( const std::string &path ) override {
+        return mIO->CreateDirectory( path );
+    }
+
+    bool ChangeDirectory( const std::string &path ) override {
+        return mIO->ChangeDirectory( path );
+    }
+
+    bool DeleteFile( const std::string &file ) override {
+        return mIO->DeleteFile( file );
+    }
+
+private:
+    IOSystem* mIO;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Loads a single request with the given importer
+void LoadRequestWith( Importer* importer, LoadRequest& req, bool validate ) {
+    // force validation in debug builds
+    unsigned int pp = req.flags;
+    if ( validate ) {
+        pp |= aiProcess_ValidateDataStructure;
+    }
+
+    // setup config properties if necessary
+    ImporterPimpl* pimpl = importer->Pimpl();
+    pimpl->mFloatProperties  = req.map.floats;
+    pimpl->mIntProperties    = req.map.ints;
+    pimpl->mStringProperties = req.map.strings;
+    pimpl->mMatrixProperties = req.map.matrices;
+
+    if (!DefaultLogger::isNullLogger())
+    {
+        ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
+        ASSIMP_LOG_INFO_F("File: ", req.file);
+    }
+    importer->ReadFile(req.file,pp);
+    req.scene = importer->GetOrphanedScene();
+    req.loaded = true;
+
+    ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 BatchLoader::BatchLoader(IOSystem* pIO, bool validate ) {
     ai_assert(nullptr != pIO);
@@ -540,6 +625,16 @@ bool BatchLoader::getValidation() const {
     return m_data->validate;
 }
 
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::setNumThreads( unsigned int numThreads ) {
+    m_data->numThreads = numThreads;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BatchLoader::getNumThreads() const {
+    return m_data->numThreads;
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int BatchLoader::AddLoadRequest(const std::string& file,
     unsigned int steps /*= 0*/, const PropertyMap* map /*= NULL*/)
@@ -587,30 +682,45 @@ aiScene* BatchLoader::GetImport( unsigned int which )
 // ------------------------------------------------------------------------------------------------
 void BatchLoader::LoadAll()
 {
-    // no threaded implementation for the moment
+    std::vector<LoadRequest*> pending;
     for ( LoadReqIt it = m_data->requests.begin();it != m_data->requests.end(); ++it) {
-        // force validation in debug builds
-        unsigned int pp = (*it).flags;
-        if ( m_data->validate ) {
-            pp |= aiProcess_ValidateDataStructure;
+        if ( !(*it).loaded ) {
+            pending.push_back( &(*it) );
         }
+    }
 
-        // setup config properties if necessary
-        ImporterPimpl* pimpl = m_data->pImporter->Pimpl();
-        pimpl->mFloatProperties  = (*it).map.floats;
-        pimpl->mIntProperties    = (*it).map.ints;
-        pimpl->mStringProperties = (*it).map.strings;
-        pimpl->mMatrixProperties = (*it).map.matrices;
+    const unsigned int numThreads = std::min( ThreadPool::ResolveThreadCount( static_cast<int>( m_data->numThreads ) ),
+        static_cast<unsigned int>( pending.size() ) );
+    if ( numThreads <= 1 ) {
+        for ( LoadRequest* req : pending ) {
+            LoadRequestWith( m_data->pImporter, *req, m_data->validate );
+        }
+        return;
+    }
+
+    // Importers are not thread-safe, so each file is loaded with an importer that
+    // isn't in use by another thread. Their IO systems forward to ours.
+    std::vector<std::unique_ptr<Importer>> importers;
+    std::vector<Importer*> idle;
+    for ( unsigned int i = 0; i < numThreads; ++i ) {
+        importers.emplace_back( new Importer() );
+        importers.back()->SetIOHandler( new BatchWorkerIOSystem( m_data->pIOSystem ) );
+        idle.push_back( importers.back().get() );
+    }
+    std::mutex idleMutex;
 
-        if (!DefaultLogger::isNullLogger())
+    ThreadPool pool( numThreads );
+    pool.ParallelFor( static_cast<unsigned int>( pending.size() ), [&]( unsigned int i ) {
+        Importer* importer = nullptr;
         {
-            ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
-            ASSIMP_LOG_INFO_F("File: ", (*it).file);
+            std::lock_guard<std::mutex> lock( idleMutex );
+            importer = idle.back();
+            idle.pop_back();
         }
-        m_data->pImporter->ReadFile((*it).file,pp);
-        (*it).scene = m_data->pImporter->GetOrphanedScene();
-        (*it).loaded = true;
 
-        ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
-    }
+        LoadRequestWith( importer, *pending[ i ], m_data->validate );
+
+        std::lock_guard<std::mutex> lock( idleMutex );
+        idle.push_back( importer );
+    } );
 }
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/scene.h>
 #include "Importer.h"
+#include "ThreadPool.h"
 
 using namespace Assimp;
 
@@ -56,6 +57,8 @@ using namespace Assimp;
 BaseProcess::BaseProcess() AI_NO_EXCEPT
 : shared()
 , progress()
+, threadPool()
+, name()
 {
 }
 
@@ -74,6 +77,8 @@ void BaseProcess::ExecuteOnScene( Importer* pImp)
     progress = pImp->GetProgressHandler();
     ai_assert(progress);
 
+    threadPool = pImp->Pimpl()->mThreadPool;
+
     SetupProperties( pImp );
 
     // catch exceptions thrown inside the PostProcess-Step
@@ -93,12 +98,32 @@ void BaseProcess::ExecuteOnScene( Importer* pImp)
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecutePerMesh( aiScene* pScene, const std::function<void(unsigned int)>& job)
+{
+    ai_assert(NULL != pScene);
+
+    if (threadPool) {
+        threadPool->ParallelFor(pScene->mNumMeshes, job);
+        return;
+    }
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        job(a);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseProcess::SetupProperties(const Importer* /*pImp*/)
 {
     // the default implementation does nothing
 }
 
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsRequested( const Importer* /*pImp*/) const
+{
+    return false;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool BaseProcess::RequireVerboseFormat() const
 {
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_BASEPROCESS_H
 
 #include <map>
+#include <functional>
 #include <assimp/GenericProperty.h>
 
 struct aiScene;
@@ -52,6 +53,7 @@ struct aiScene;
 namespace Assimp    {
 
 class Importer;
+class ThreadPool;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -230,6 +232,15 @@ public:
     */
     virtual bool IsActive( unsigned int pFlags) const = 0;
 
+    // -------------------------------------------------------------------
+    /** Returns whether the step is requested through the importer's
+     * properties. Steps without a flag of their own are enabled this
+     * way, they run whenever post processing runs, even without flags.
+     * @param pImp Importer instance the properties are read from.
+     * @return The default implementation returns false.
+    */
+    virtual bool IsRequested( const Importer* pImp) const;
+
     // -------------------------------------------------------------------
     /** Check whether this step expects its input vertex data to be
      *  in verbose format. */
@@ -275,6 +286,45 @@ public:
         return shared;
     }
 
+    // -------------------------------------------------------------------
+    /** Assign a worker pool to the step. ExecuteOnScene() assigns the
+     *  pool configured via #AI_CONFIG_PP_NUM_THREADS automatically.
+     * @param pool May be NULL, per-mesh work is run serially then.
+    */
+    inline void SetThreadPool(ThreadPool* pool) {
+        threadPool = pool;
+    }
+
+    // -------------------------------------------------------------------
+    /** Assign the name the step is reported under in the import
+     *  statistics, see Importer::GetLastImportStatistics().
+     * @param n Must remain valid for the lifetime of the step.
+    */
+    inline void SetName(const char* n) {
+        name = n;
+    }
+
+    // -------------------------------------------------------------------
+    /** Get the name of the step, NULL if none has been assigned.
+    */
+    inline const char* GetName() const {
+        return name;
+    }
+
+protected:
+
+    // -------------------------------------------------------------------
+    /** Runs a per-mesh job for every mesh of the given scene.
+    * If a worker pool is assigned the meshes are processed concurrently,
+    * otherwise one after another in ascending order. A job may only
+    * modify the mesh it has been invoked for. If a job throws, the
+    * first exception is propagated once all running jobs have returned.
+    * @param pScene The scene whose meshes are to be processed.
+    * @param job    Called with the index of each mesh.
+    */
+    void ExecutePerMesh( aiScene* pScene,
+        const std::function<void(unsigned int)>& job);
+
 protected:
 
     /** See the doc of #SharedPostProcessInfo for more details */
@@ -282,6 +332,12 @@ protected:
 
     /** Currently active progress handler */
     ProgressHandler* progress;
+
+    /** Worker pool for per-mesh work, may be NULL */
+    ThreadPool* threadPool;
+
+    /** Name for the import statistics, may be NULL */
+    const char* name;
 };
 
 
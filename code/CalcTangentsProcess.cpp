@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProcessHelper.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
+#include <atomic>
 
 using namespace Assimp;
 
@@ -57,7 +58,8 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 CalcTangentsProcess::CalcTangentsProcess()
 : configMaxAngle( AI_DEG_TO_RAD(45.f) )
-, configSourceUV( 0 ) {
+, configSourceUV( 0 )
+, configSpatialSortBackend( SpatialSort::Backend_PlaneSort ) {
     // nothing to do here
 }
 
@@ -87,6 +89,7 @@ void CalcTangentsProcess::SetupProperties(const Importer* pImp)
     configMaxAngle = AI_DEG_TO_RAD(configMaxAngle);
 
     configSourceUV = pImp->GetPropertyInteger(AI_CONFIG_PP_CT_TEXTURE_CHANNEL_INDEX,0);
+    configSpatialSortBackend = GetSpatialSortBackend(pImp);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -97,10 +100,10 @@ void CalcTangentsProcess::Execute( aiScene* pScene)
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for ( unsigned int a = 0; a < pScene->mNumMeshes; a++ ) {
+    std::atomic<bool> bHas(false);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
         if(ProcessMesh( pScene->mMeshes[a],a))bHas = true;
-    }
+    });
 
     if ( bHas ) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -252,6 +255,7 @@ bool CalcTangentsProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
     }
     if (!vertexFinder)
     {
+        _vertexFinder.SetBackend(configSpatialSortBackend);
         _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_CALCTANGENTSPROCESS_H_INC
 
 #include "BaseProcess.h"
+#include <assimp/SpatialSort.h>
 
 struct aiMesh;
 
@@ -110,6 +111,7 @@ private:
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
     unsigned int configSourceUV;
+    SpatialSort::Backend configSpatialSortBackend;
 };
 
 } // end of namespace Assimp
@@ -97,6 +97,7 @@ ColladaLoader::ColladaLoader()
 , noSkeletonMesh( false )
 , ignoreUpDirection(false)
 , useColladaName( false )
+, releaseSources( false )
 , mNodeNameCounter( 0 ) {
     // empty
 }
@@ -139,6 +140,7 @@ void ColladaLoader::SetupProperties(const Importer* pImp)
     noSkeletonMesh = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NO_SKELETON_MESHES,0) != 0;
     ignoreUpDirection = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_IGNORE_UP_DIRECTION,0) != 0;
     useColladaName = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_USE_COLLADA_NAMES,0) != 0;
+    releaseSources = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_RELEASE_SOURCES,0) != 0;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -165,7 +167,7 @@ void ColladaLoader::InternReadFile( const std::string& pFile, aiScene* pScene, I
     mAnims.clear();
 
     // parse the input file
-    ColladaParser parser( pIOHandler, pFile);
+    ColladaParser parser( pIOHandler, pFile, releaseSources);
 
     if( !parser.mRootNode)
         throw DeadlyImportError( "Collada: File came out empty. Something is wrong here.");
@@ -249,6 +249,7 @@ protected:
     bool noSkeletonMesh;
     bool ignoreUpDirection;
     bool useColladaName;
+    bool releaseSources;
 
     /** Used by FindNameForNode() to generate unique node names */
     unsigned int mNodeNameCounter;
@@ -66,7 +66,7 @@ using namespace Assimp::Formatter;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
-ColladaParser::ColladaParser( IOSystem* pIOHandler, const std::string& pFile)
+ColladaParser::ColladaParser( IOSystem* pIOHandler, const std::string& pFile, bool pReleaseSources)
     : mFileName( pFile )
     , mReader( nullptr )
     , mDataLibrary()
@@ -84,21 +84,26 @@ ColladaParser::ColladaParser( IOSystem* pIOHandler, const std::string& pFile)
     , mUnitSize( 1.0f )
     , mUpDirection( UP_Y )
     , mFormat(FV_1_5_n )    // We assume the newest file format by default
+    , mReleaseSources( pReleaseSources )
 {
     // validate io-handler instance
     if (nullptr == pIOHandler ) {
         throw DeadlyImportError("IOSystem is NULL." );
     }
 
-    // open the file
-    std::unique_ptr<IOStream> file( pIOHandler->Open(pFile ) );
-    if (file.get() == nullptr) {
-        throw DeadlyImportError( "Failed to open file " + pFile + "." );
-    }
+    // generate a XML reader for it. IrrXML copies the whole document when it
+    // is created, so the file and the wrapper's own copy of it are released
+    // before parsing starts instead of staying alive alongside it.
+    {
+        // open the file
+        std::unique_ptr<IOStream> file( pIOHandler->Open(pFile ) );
+        if (file.get() == nullptr) {
+            throw DeadlyImportError( "Failed to open file " + pFile + "." );
+        }
 
-    // generate a XML reader for it
-    std::unique_ptr<CIrrXML_IOStreamReader> mIOWrapper(new CIrrXML_IOStreamReader(file.get()));
-    mReader = irr::io::createIrrXMLReader( mIOWrapper.get());
+        std::unique_ptr<CIrrXML_IOStreamReader> mIOWrapper(new CIrrXML_IOStreamReader(file.get()));
+        mReader = irr::io::createIrrXMLReader( mIOWrapper.get());
+    }
     if (!mReader) {
         ThrowException("Collada: Unable to open file.");
     }
@@ -1861,12 +1866,18 @@ void ColladaParser::ReadMesh( Mesh* pMesh)
     if( mReader->isEmptyElement())
         return;
 
+    // sources declared by this mesh, released at its end if mReleaseSources is set
+    std::vector<std::string> sourceIDs;
+
     while( mReader->read())
     {
         if( mReader->getNodeType() == irr::io::EXN_ELEMENT)
         {
             if( IsElement( "source"))
             {
+                if( mReleaseSources)
+                    sourceIDs.push_back( mReader->getAttributeValue( GetAttribute( "id")));
+
                 // we have professionals dealing with this
                 ReadSource();
             }
@@ -1903,6 +1914,40 @@ void ColladaParser::ReadMesh( Mesh* pMesh)
             }
         }
     }
+
+    // all primitives have been copied to the mesh, its sources are no longer needed
+    ReleaseSourceData( sourceIDs);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Releases the data arrays of the given sources. The library entries are kept, so
+// references resolved earlier stay valid; they just don't hold values anymore.
+void ColladaParser::ReleaseSourceData( const std::vector<std::string>& pSourceIDs)
+{
+    for( std::vector<std::string>::const_iterator it = pSourceIDs.begin(); it != pSourceIDs.end(); ++it)
+    {
+        AccessorLibrary::const_iterator acc = mAccessorLibrary.find( *it);
+        if( acc == mAccessorLibrary.end())
+            continue;
+
+        DataLibrary::iterator data = mDataLibrary.find( acc->second.mSource);
+        if( data == mDataLibrary.end())
+            continue;
+
+        std::vector<ai_real>().swap( data->second.mValues);
+        std::vector<std::string>().swap( data->second.mStrings);
+        mReleasedData.insert( data->first);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Throws if the data of the given input has been released already with another mesh
+void ColladaParser::TestReleasedSource( const InputChannel& pInput) const
+{
+    const std::string& dataID = pInput.mResolved->mSource;
+    if( mReleasedData.find( dataID) != mReleasedData.end())
+        ThrowException( format() << "Accessor \"" << pInput.mAccessor << "\" refers to data array \"" << dataID
+            << "\" of another mesh, which has been released already. Disable AI_CONFIG_IMPORT_COLLADA_RELEASE_SOURCES to import this file." );
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1994,20 +2039,11 @@ void ColladaParser::ReadDataArray()
             }
         } else
         {
-            data.mValues.reserve( count);
+            data.mValues.resize( count);
 
-            for( unsigned int a = 0; a < count; a++)
-            {
-                if( *content == 0)
-                    ThrowException( "Expected more values while reading float_array contents.");
-
-                ai_real value;
-                // read a number
-                content = fast_atoreal_move<ai_real>( content, value);
-                data.mValues.push_back( value);
-                // skip whitespace after it
-                SkipSpacesAndLineEnd( &content);
-            }
+            // read all numbers at once
+            if( count > 0 && fast_atoreal_array( &content, content + ::strlen( content), &data.mValues[0], count) != count)
+                ThrowException( "Expected more values while reading float_array contents.");
         }
     }
 
@@ -2206,16 +2242,10 @@ void ColladaParser::ReadIndexData( Mesh* pMesh)
                     {
                         // case <polylist> - specifies the number of indices for each polygon
                         const char* content = GetTextContent();
-                        vcount.reserve( numPrimitives);
-                        for( unsigned int a = 0; a < numPrimitives; a++)
-                        {
-                            if( *content == 0)
-                                ThrowException( "Expected more values while reading <vcount> contents.");
-                            // read a number
-                            vcount.push_back( (size_t) strtoul10( content, &content));
-                            // skip whitespace after it
-                            SkipSpacesAndLineEnd( &content);
-                        }
+                        std::vector<unsigned int> counts( numPrimitives);
+                        if( strtoul10_array( &content, content + ::strlen( content), &counts[0], numPrimitives) != numPrimitives)
+                            ThrowException( "Expected more values while reading <vcount> contents.");
+                        vcount.assign( counts.begin(), counts.end());
                     }
 
                     TestClosing( "vcount");
@@ -2250,7 +2280,8 @@ void ColladaParser::ReadIndexData( Mesh* pMesh)
 #ifdef ASSIMP_BUILD_DEBUG
 	if (primType != Prim_TriFans && primType != Prim_TriStrips && primType != Prim_LineStrip &&
         primType != Prim_Lines) { // this is ONLY to workaround a bug in SketchUp 15.3.331 where it writes the wrong 'count' when it writes out the 'lines'.
-        ai_assert(actualPrimitives == numPrimitives);
+        // no primitives at all if they have been skipped for missing source data
+        ai_assert(actualPrimitives == numPrimitives || actualPrimitives == 0);
     }
 #endif
 
@@ -2347,15 +2378,20 @@ size_t ColladaParser::ReadPrimitives( Mesh* pMesh, std::vector<InputChannel>& pP
     if (pNumPrimitives > 0) // It is possible to not contain any indices
     {
         const char* content = GetTextContent();
-        while( *content != 0)
+        const char* end = content + ::strlen( content);
+        int values[ 256 ];
+        for( ;; )
         {
-            // read a value.
+            // read a batch of values.
             // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
-            int value = std::max( 0, strtol10( content, &content));
-            indices.push_back( size_t( value));
-            // skip whitespace after it
-            SkipSpacesAndLineEnd( &content);
+            const size_t numValues = strtol10_array( &content, end, values, 256);
+            for( size_t a = 0; a < numValues; a++)
+                indices.push_back( size_t( std::max( 0, values[a])));
+            if( numValues < 256)
+                break;
         }
+        if( content != end)
+            ThrowException( "Invalid index in <p> element.");
     }
 
 	// complain if the index count doesn't fit
@@ -2408,6 +2444,36 @@ size_t ColladaParser::ReadPrimitives( Mesh* pMesh, std::vector<InputChannel>& pP
             acc->mData = &ResolveLibraryReference( mDataLibrary, acc->mSource);
     }
 
+    // a source released together with another mesh can't be read anymore. Fail instead of
+    // silently dropping the geometry.
+    for( const InputChannel& input : pMesh->mPerVertexData)
+        TestReleasedSource( input);
+    for( const InputChannel& input : pPerIndexChannels)
+    {
+        if( input.mType != IT_Vertex)
+            TestReleasedSource( input);
+    }
+
+    // skip the primitives if a source is empty
+    for( const InputChannel& input : pMesh->mPerVertexData)
+    {
+        if( input.mResolved->mCount > 0 && input.mResolved->mData->mValues.empty())
+        {
+            ReportWarning( "No data for accessor \"%s\", skipping primitives of mesh \"%s\".", input.mAccessor.c_str(), pMesh->mName.c_str());
+            TestClosing( "p");
+            return 0;
+        }
+    }
+    for( const InputChannel& input : pPerIndexChannels)
+    {
+        if( input.mType != IT_Vertex && input.mResolved->mCount > 0 && input.mResolved->mData->mValues.empty())
+        {
+            ReportWarning( "No data for accessor \"%s\", skipping primitives of mesh \"%s\".", input.mAccessor.c_str(), pMesh->mName.c_str());
+            TestClosing( "p");
+            return 0;
+        }
+    }
+
     // For continued primitives, the given count does not come all in one <p>, but only one primitive per <p>
     size_t numPrimitives = pNumPrimitives;
     if( pPrimType == Prim_TriFans || pPrimType == Prim_Polygon)
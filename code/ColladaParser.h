@@ -51,6 +51,7 @@
 #include "ColladaHelper.h"
 #include <assimp/ai_assert.h>
 #include <assimp/TinyFormatter.h>
+#include <set>
 
 namespace Assimp
 {
@@ -66,8 +67,9 @@ namespace Assimp
         friend class ColladaLoader;
 
     protected:
-        /** Constructor from XML file */
-        ColladaParser( IOSystem* pIOHandler, const std::string& pFile);
+        /** Constructor from XML file. If pReleaseSources is set, the source
+         * data of each mesh is released once the mesh has been read. */
+        ColladaParser( IOSystem* pIOHandler, const std::string& pFile, bool pReleaseSources = false);
 
         /** Destructor */
         ~ColladaParser();
@@ -165,6 +167,12 @@ namespace Assimp
         /** Reads a mesh from the geometry library */
         void ReadMesh( Collada::Mesh* pMesh);
 
+        /** Releases the data arrays of the given sources, see mReleaseSources */
+        void ReleaseSourceData( const std::vector<std::string>& pSourceIDs);
+
+        /** Throws if the data of the given input has been released with another mesh */
+        void TestReleasedSource( const Collada::InputChannel& pInput) const;
+
         /** Reads a source element - a combination of raw data and an accessor defining
          * things that should not be redefinable. Yes, that's another rant.
          */
@@ -345,6 +353,12 @@ namespace Assimp
 
         /** Collada file format version */
         Collada::FormatVersion mFormat;
+
+        /** Release the source data of each mesh once it has been read */
+        bool mReleaseSources;
+
+        /** IDs of the data arrays released so far, see mReleaseSources */
+        std::set<std::string> mReleasedData;
     };
 
     // ------------------------------------------------------------------------------------------------
@@ -120,6 +120,10 @@ void DeboneProcess::Execute( aiScene* pScene)
         // build a new array of meshes for the scene
         std::vector<aiMesh*> meshes;
 
+        // new place of each mesh which is kept unchanged
+        const unsigned int numOldMeshes = pScene->mNumMeshes;
+        std::vector<unsigned int> mapping(numOldMeshes,UINT_MAX);
+
         for(unsigned int a=0;a<pScene->mNumMeshes;a++)
         {
             aiMesh* srcMesh = pScene->mMeshes[a];
@@ -156,6 +160,7 @@ void DeboneProcess::Execute( aiScene* pScene)
             }
             else    {
                 // Mesh is kept unchanged - store it's new place in the mesh array
+                mapping[a] = static_cast<unsigned int>(meshes.size());
                 mSubMeshIndices[a].push_back(std::pair<unsigned int,aiNode*>(static_cast<unsigned int>(meshes.size()),(aiNode*)0));
                 meshes.push_back(srcMesh);
             }
@@ -169,6 +174,7 @@ void DeboneProcess::Execute( aiScene* pScene)
 
         // recurse through all nodes and translate the node's mesh indices to fit the new mesh array
         UpdateNode( pScene->mRootNode);
+        UpdateMeshLODs(pScene,&mapping[0],numOldMeshes);
     }
 
     ASSIMP_LOG_DEBUG("DeboneProcess end");
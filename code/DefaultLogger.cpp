@@ -62,6 +62,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #   include <thread>
 #   include <mutex>
     std::mutex loggerMutex;
+
+    // Serializes the writes of concurrently logging threads
+    static std::mutex loggerStreamMutex;
 #endif
 
 namespace Assimp    {
@@ -370,6 +373,11 @@ DefaultLogger::~DefaultLogger() {
 void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev ) {
     ai_assert(nullptr != message);
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // lastMsg is shared by all threads
+    std::lock_guard<std::mutex> lock(loggerStreamMutex);
+#endif
+
     // Check whether this is a repeated message
     if (! ::strncmp( message,lastMsg, lastLen-1))
     {
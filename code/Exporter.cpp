@@ -342,12 +342,6 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
         unsigned int pPreprocessing, const ExportProperties* pProperties) {
     ASSIMP_BEGIN_EXCEPTION_REGION();
 
-    // when they create scenes from scratch, users will likely create them not in verbose
-    // format. They will likely not be aware that there is a flag in the scene to indicate
-    // this, however. To avoid surprises and bug reports, we check for duplicates in
-    // meshes upfront.
-    const bool is_verbose_format = !(pScene->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT) || IsVerboseFormat(pScene);
-
     pimpl->mProgressHandler->UpdateFileWrite(0, 4);
 
     pimpl->mError = "";
@@ -365,6 +359,12 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                 std::unique_ptr<aiScene> scenecopy(scenecopy_tmp);
                 const ScenePrivateData* const priv = ScenePriv(pScene);
 
+                // when they create scenes from scratch, users will likely create them not in verbose
+                // format. They will likely not be aware that there is a flag in the scene to indicate
+                // this, however. To avoid surprises and bug reports, we check for duplicates in
+                // meshes upfront. The copy is checked as it always stores faces in aiMesh::mFaces.
+                const bool is_verbose_format = !(scenecopy->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT) || IsVerboseFormat(scenecopy.get());
+
                 // steps that are not idempotent, i.e. we might need to run them again, usually to get back to the
                 // original state before the step was applied first. When checking which steps we don't need
                 // to run, those are excluded.
@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXUtil.h"
 #include "FBXProperties.h"
 #include "FBXImporter.h"
+#include "ThreadPool.h"
 
 #include <assimp/StringComparison.h>
 
@@ -85,6 +86,7 @@ namespace Assimp {
             // to determine which nodes need to be generated.
             ConvertAnimations();
             ConvertRootNode();
+            ConvertMeshData();
 
             if (doc.Settings().readAllMaterials) {
                 // unfortunately this means we have to evaluate all objects
@@ -1010,6 +1012,26 @@ namespace Assimp {
             const MatIndexArray& mindices = mesh.GetMaterialIndices();
             aiMesh* const out_mesh = SetupEmptyMesh(mesh, nd);
 
+            // materials are shared between meshes, so they are always converted in order
+            if (!doc.Settings().readMaterials || mindices.empty()) {
+                FBXImporter::LogError("no material assigned to mesh, setting default material");
+                out_mesh->mMaterialIndex = GetDefaultMaterial();
+            }
+            else {
+                ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
+            }
+
+            const aiMatrix4x4 transform = node_global_transform;
+            AddMeshJob([this, out_mesh, &mesh, &model, transform]() {
+                FillMeshSingleMaterial(out_mesh, mesh, model, transform);
+            });
+
+            return static_cast<unsigned int>(meshes.size() - 1);
+        }
+
+        void FBXConverter::FillMeshSingleMaterial(aiMesh* out_mesh, const MeshGeometry& mesh, const Model& model,
+            const aiMatrix4x4& node_global_transform)
+        {
             const std::vector<aiVector3D>& vertices = mesh.GetVertices();
             const std::vector<unsigned int>& faces = mesh.GetFaceIndexCounts();
 
@@ -1117,14 +1139,6 @@ namespace Assimp {
                 std::copy(colors.begin(), colors.end(), out_mesh->mColors[i]);
             }
 
-            if (!doc.Settings().readMaterials || mindices.empty()) {
-                FBXImporter::LogError("no material assigned to mesh, setting default material");
-                out_mesh->mMaterialIndex = GetDefaultMaterial();
-            }
-            else {
-                ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
-            }
-
             if (doc.Settings().readWeights && mesh.DeformerSkin() != NULL) {
                 ConvertWeights(out_mesh, model, mesh, node_global_transform, NO_MATERIAL_SEPARATION);
             }
@@ -1168,7 +1182,6 @@ namespace Assimp {
                     out_mesh->mAnimMeshes[i] = animMeshes.at(i);
                 }
             }
-            return static_cast<unsigned int>(meshes.size() - 1);
         }
 
         std::vector<unsigned int> FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry& mesh, const Model& model,
@@ -1179,25 +1192,35 @@ namespace Assimp {
 
             std::set<MatIndexArray::value_type> had;
             std::vector<unsigned int> indices;
+            std::vector<std::pair<aiMesh*, MatIndexArray::value_type> > parts;
 
             for (MatIndexArray::value_type index : mindices) {
                 if (had.find(index) == had.end()) {
 
-                    indices.push_back(ConvertMeshMultiMaterial(mesh, model, index, node_global_transform, nd));
+                    aiMesh* const out_mesh = SetupEmptyMesh(mesh, nd);
+                    ConvertMaterialForMesh(out_mesh, model, mesh, index);
+
+                    parts.push_back(std::make_pair(out_mesh, index));
+                    indices.push_back(static_cast<unsigned int>(meshes.size() - 1));
                     had.insert(index);
                 }
             }
 
+            // all parts in one job, they share lazily computed lookup tables of the geometry
+            const aiMatrix4x4 transform = node_global_transform;
+            AddMeshJob([this, parts, &mesh, &model, transform]() {
+                for (const std::pair<aiMesh*, MatIndexArray::value_type>& part : parts) {
+                    FillMeshMultiMaterial(part.first, mesh, model, part.second, transform);
+                }
+            });
+
             return indices;
         }
 
-        unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry& mesh, const Model& model,
+        void FBXConverter::FillMeshMultiMaterial(aiMesh* out_mesh, const MeshGeometry& mesh, const Model& model,
             MatIndexArray::value_type index,
-            const aiMatrix4x4& node_global_transform,
-            aiNode& nd)
+            const aiMatrix4x4& node_global_transform)
         {
-            aiMesh* const out_mesh = SetupEmptyMesh(mesh, nd);
-
             const MatIndexArray& mindices = mesh.GetMaterialIndices();
             const std::vector<aiVector3D>& vertices = mesh.GetVertices();
             const std::vector<unsigned int>& faces = mesh.GetFaceIndexCounts();
@@ -1357,13 +1380,34 @@ namespace Assimp {
                 }
             }
 
-            ConvertMaterialForMesh(out_mesh, model, mesh, index);
-
             if (process_weights) {
                 ConvertWeights(out_mesh, model, mesh, node_global_transform, index, &reverseMapping);
             }
+        }
 
-            return static_cast<unsigned int>(meshes.size() - 1);
+        void FBXConverter::AddMeshJob(const std::function<void()>& job)
+        {
+            if (doc.Settings().numThreads > 1) {
+                mesh_jobs.push_back(job);
+            }
+            else {
+                job();
+            }
+        }
+
+        void FBXConverter::ConvertMeshData()
+        {
+            if (mesh_jobs.empty()) {
+                return;
+            }
+
+            // every job writes to its own output meshes only, so the result
+            // is the same as if they had run one after the other
+            ThreadPool pool(doc.Settings().numThreads);
+            pool.ParallelFor(static_cast<unsigned int>(mesh_jobs.size()), [this](unsigned int i) {
+                mesh_jobs[i]();
+            });
+            mesh_jobs.clear();
         }
 
         void FBXConverter::ConvertWeights(aiMesh* out, const Model& model, const MeshGeometry& geo,
@@ -59,6 +59,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/camera.h>
 #include <assimp/StringComparison.h>
 
+#include <functional>
+
 struct aiScene;
 struct aiNode;
 struct aiMaterial;
@@ -196,9 +198,25 @@ private:
         const aiMatrix4x4& node_global_transform, aiNode& nd);
 
     // ------------------------------------------------------------------------------------------------
-    unsigned int ConvertMeshMultiMaterial(const MeshGeometry& mesh, const Model& model,
+    // copy vertices, faces, weights and blend shapes of a mesh that has been set up
+    // already. Only reads the DOM and writes to out_mesh, so it may run concurrently.
+    void FillMeshSingleMaterial(aiMesh* out_mesh, const MeshGeometry& mesh, const Model& model,
+        const aiMatrix4x4& node_global_transform);
+
+    // ------------------------------------------------------------------------------------------------
+    // same as FillMeshSingleMaterial(), for the faces of the given material only
+    void FillMeshMultiMaterial(aiMesh* out_mesh, const MeshGeometry& mesh, const Model& model,
         MatIndexArray::value_type index,
-        const aiMatrix4x4& node_global_transform, aiNode& nd);
+        const aiMatrix4x4& node_global_transform);
+
+    // ------------------------------------------------------------------------------------------------
+    // run a mesh fill job right away, or queue it for ConvertMeshData() if geometry is
+    // converted on multiple threads
+    void AddMeshJob(const std::function<void()>& job);
+
+    // ------------------------------------------------------------------------------------------------
+    // run all queued mesh fill jobs on ImportSettings::numThreads threads
+    void ConvertMeshData();
 
     // ------------------------------------------------------------------------------------------------
     static const unsigned int NO_MATERIAL_SEPARATION = /* std::numeric_limits<unsigned int>::max() */
@@ -440,6 +458,9 @@ private:
     typedef std::map<const Geometry*, std::vector<unsigned int> > MeshMap;
     MeshMap meshes_converted;
 
+    // mesh contents still to be filled in, in the order the meshes were set up
+    std::vector<std::function<void()> > mesh_jobs;
+
     // fixed node name -> which trafo chain components have animations?
     typedef std::map<std::string, unsigned int> NodeAnimBitMap;
     NodeAnimBitMap node_anim_chain_bits;
@@ -99,7 +99,7 @@ const Object* LazyObject::Get(bool dieOnError)
     }
 
     const Token& key = element.KeyToken();
-    const TokenList& tokens = element.Tokens();
+    const TokenRange& tokens = element.Tokens();
 
     if(tokens.size() < 3) {
         DOMError("expected at least 3 tokens: id, name and class tag",&element);
@@ -391,7 +391,7 @@ void Document::ReadObjects()
     for(const ElementMap::value_type& el : sobjects.Elements()) {
 
         // extract ID
-        const TokenList& tok = el.second->Tokens();
+        const TokenRange& tok = el.second->Tokens();
 
         if (tok.empty()) {
             DOMError("expected ID after object key",el.second);
@@ -442,7 +442,7 @@ void Document::ReadPropertyTemplates()
             continue;
         }
 
-        const TokenList& tok = el.Tokens();
+        const TokenRange& tok = el.Tokens();
         if(tok.empty()) {
             DOMWarning("expected name for ObjectType element, ignoring",&el);
             continue;
@@ -459,7 +459,7 @@ void Document::ReadPropertyTemplates()
                 continue;
             }
 
-            const TokenList& tok = el.Tokens();
+            const TokenRange& tok = el.Tokens();
             if(tok.empty()) {
                 DOMWarning("expected name for PropertyTemplate element, ignoring",&el);
                 continue;
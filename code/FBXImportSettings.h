@@ -65,6 +65,7 @@ struct ImportSettings
         , preservePivots(true)
         , optimizeEmptyAnimationCurves(true)
         , useLegacyEmbeddedTextureNaming(false)
+        , numThreads(1)
     {}
 
 
@@ -143,6 +144,12 @@ struct ImportSettings
     /** use legacy naming for embedded textures eg: (*0, *1, *2)
     **/
     bool useLegacyEmbeddedTextureNaming;
+
+    /** number of threads used to decompress the binary data arrays
+     *  ahead of conversion and to fill in the converted meshes. 1
+     *  decompresses arrays lazily on first use and converts the meshes
+     *  one after the other. The default value is 1. */
+    unsigned int numThreads;
 };
 
 
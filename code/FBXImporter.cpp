@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXUtil.h"
 #include "FBXDocument.h"
 #include "FBXConverter.h"
+#include "ThreadPool.h"
 
 #include <assimp/StreamReader.h>
 #include <assimp/MemoryIOWrapper.h>
@@ -140,6 +141,7 @@ void FBXImporter::SetupProperties(const Importer* pImp)
     settings.preservePivots = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, true);
     settings.optimizeEmptyAnimationCurves = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_OPTIMIZE_EMPTY_ANIMATION_CURVES, true);
     settings.useLegacyEmbeddedTextureNaming = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_EMBEDDED_TEXTURES_LEGACY_NAMING, false);
+    settings.numThreads = ThreadPool::ResolveThreadCount(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_FBX_NUM_THREADS, 1));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -156,42 +158,49 @@ void FBXImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
     // then becomes very large, too. Assimp doesn't support
     // streaming for its output data structures so the net win with
     // streaming input data would be very low.
+    // Binary files are tokenized in place if the stream already holds
+    // them in memory, the text tokenizer needs a terminating zero.
     std::vector<char> contents;
-    contents.resize(stream->FileSize()+1);
-    stream->Read( &*contents.begin(), 1, contents.size()-1 );
-    contents[ contents.size() - 1 ] = 0;
-    const char* const begin = &*contents.begin();
+    const char* begin = reinterpret_cast<const char*>(stream->GetMappedData());
+    size_t length = stream->FileSize();
+    if (nullptr == begin || length < 18 || strncmp(begin,"Kaydara FBX Binary",18)) {
+        contents.resize(length+1);
+        stream->Read( &*contents.begin(), 1, length );
+        contents[ length ] = 0;
+        begin = &*contents.begin();
+        length = contents.size();
+    }
 
     // broadphase tokenizing pass in which we identify the core
-    // syntax elements of FBX (brackets, commas, key:value mappings)
+    // syntax elements of FBX (brackets, commas, key:value mappings).
+    // All tokens go to one arena which is released in a single step.
     TokenList tokens;
-    try {
+    MemoryArena token_arena(1024 * 1024);
 
-        bool is_binary = false;
-        if (!strncmp(begin,"Kaydara FBX Binary",18)) {
-            is_binary = true;
-            TokenizeBinary(tokens,begin,static_cast<unsigned int>(contents.size()));
-        }
-        else {
-            Tokenize(tokens,begin);
-        }
+    bool is_binary = false;
+    if (!strncmp(begin,"Kaydara FBX Binary",18)) {
+        is_binary = true;
+        TokenizeBinary(tokens,begin,static_cast<unsigned int>(length),token_arena);
+    }
+    else {
+        Tokenize(tokens,begin,token_arena);
+    }
 
-        // use this information to construct a very rudimentary
-        // parse-tree representing the FBX scope structure
-        Parser parser(tokens, is_binary);
+    // use this information to construct a very rudimentary
+    // parse-tree representing the FBX scope structure
+    Parser parser(tokens, is_binary);
 
-        // take the raw parse-tree and convert it to a FBX DOM
-        Document doc(parser,settings);
+    // decompress all binary arrays at once if we may use more than one
+    // thread, the DOM only picks up the results.
+    if (settings.numThreads > 1) {
+        parser.InflateArrays(settings.numThreads);
+    }
 
-        // convert the FBX DOM to aiScene
-        ConvertToAssimpScene(pScene,doc);
+    // take the raw parse-tree and convert it to a FBX DOM
+    Document doc(parser,settings);
 
-        std::for_each(tokens.begin(),tokens.end(),Util::delete_fun<Token>());
-    }
-    catch(std::exception&) {
-        std::for_each(tokens.begin(),tokens.end(),Util::delete_fun<Token>());
-        throw;
-    }
+    // convert the FBX DOM to aiScene
+    ConvertToAssimpScene(pScene,doc);
 }
 
 #endif // !ASSIMP_BUILD_NO_FBX_IMPORTER
@@ -174,7 +174,7 @@ MeshGeometry::MeshGeometry(uint64_t id, const Element& element, const std::strin
     // if settings.readAllLayers is false:
     //  * read only the layer with index 0, but warn about any further layers
     for (ElementMap::const_iterator it = Layer.first; it != Layer.second; ++it) {
-        const TokenList& tokens = (*it).second->Tokens();
+        const TokenRange& tokens = (*it).second->Tokens();
 
         const char* err;
         const int index = ParseTokenAsInt(*tokens[0], err);
@@ -55,11 +55,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
 #include "FBXUtil.h"
+#include "ThreadPool.h"
 
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
 #include <assimp/ByteSwapper.h>
 
+#include <algorithm>
 #include <iostream>
 
 using namespace Assimp;
@@ -116,7 +118,14 @@ namespace FBX {
 // ------------------------------------------------------------------------------------------------
 Element::Element(const Token& key_token, Parser& parser)
 : key_token(key_token)
+, compound()
+, inflated()
 {
+    // collect into the parser's scratch list, nested elements only
+    // start after our own tokens have been stored.
+    TokenList& collected = parser.element_tokens;
+    collected.clear();
+
     TokenPtr n = NULL;
     do {
         n = parser.AdvanceToNextToken();
@@ -125,7 +134,7 @@ Element::Element(const Token& key_token, Parser& parser)
         }
 
         if (n->Type() == TokenType_DATA) {
-            tokens.push_back(n);
+            collected.push_back(n);
 			TokenPtr prev = n;
             n = parser.AdvanceToNextToken();
             if(!n) {
@@ -136,7 +145,7 @@ Element::Element(const Token& key_token, Parser& parser)
 
 			// some exporters are missing a comma on the next line
 			if (ty == TokenType_DATA && prev->Type() == TokenType_DATA && (n->Line() == prev->Line() + 1)) {
-				tokens.push_back(n);
+				collected.push_back(n);
 				continue;
 			}
 
@@ -146,7 +155,8 @@ Element::Element(const Token& key_token, Parser& parser)
         }
 
         if (n->Type() == TokenType_OPEN_BRACKET) {
-            compound.reset(new Scope(parser));
+            tokens = parser.StoreTokens(collected);
+            compound = parser.NewScope();
 
             // current token should be a TOK_CLOSE_BRACKET
             n = parser.CurrentToken();
@@ -161,12 +171,8 @@ Element::Element(const Token& key_token, Parser& parser)
         }
     }
     while(n->Type() != TokenType_KEY && n->Type() != TokenType_CLOSE_BRACKET);
-}
 
-// ------------------------------------------------------------------------------------------------
-Element::~Element()
-{
-     // no need to delete tokens, they are owned by the parser
+    tokens = parser.StoreTokens(collected);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -191,7 +197,7 @@ Scope::Scope(Parser& parser,bool topLevel)
         }
 
         const std::string& str = n->StringContents();
-        elements.insert(ElementMap::value_type(str,new_Element(*n,parser)));
+        elements.insert(ElementMap::value_type(str,parser.NewElement(*n)));
 
         // Element() should stop at the next Key token (or right after a Close token)
         n = parser.CurrentToken();
@@ -204,29 +210,69 @@ Scope::Scope(Parser& parser,bool topLevel)
     }
 }
 
-// ------------------------------------------------------------------------------------------------
-Scope::~Scope()
-{
-    for(ElementMap::value_type& v : elements) {
-        delete v.second;
-    }
-}
-
 // ------------------------------------------------------------------------------------------------
 Parser::Parser (const TokenList& tokens, bool is_binary)
 : tokens(tokens)
 , last()
 , current()
 , cursor(tokens.begin())
+, arena(1024 * 1024)
+, root()
 , is_binary(is_binary)
 {
-    root.reset(new Scope(*this,true));
+    try {
+        root = NewScope(true);
+    }
+    catch(...) {
+        DestroyScopes();
+        throw;
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
 Parser::~Parser()
 {
-    // empty
+    DestroyScopes();
+}
+
+// ------------------------------------------------------------------------------------------------
+Scope* Parser::NewScope(bool topLevel)
+{
+    // make room up front so a constructed scope is always tracked
+    scopes.reserve(scopes.size() + 1);
+
+    Scope* const scope = new (arena.Allocate(sizeof(Scope), alignof(Scope))) Scope(*this, topLevel);
+    scopes.push_back(scope);
+    return scope;
+}
+
+// ------------------------------------------------------------------------------------------------
+Element* Parser::NewElement(const Token& key_token)
+{
+    return arena.New<Element>(key_token, *this);
+}
+
+// ------------------------------------------------------------------------------------------------
+TokenRange Parser::StoreTokens(const TokenList& list)
+{
+    if (list.empty()) {
+        return TokenRange();
+    }
+
+    TokenPtr* const out = arena.AllocateArray<TokenPtr>(list.size());
+    std::copy(list.begin(), list.end(), out);
+    return TokenRange(out, out + list.size());
+}
+
+// ------------------------------------------------------------------------------------------------
+void Parser::DestroyScopes()
+{
+    // elements and token lists are trivially destructible, only the
+    // scopes' element maps need to be torn down before the arena goes.
+    for(Scope* scope : scopes) {
+        scope->~Scope();
+    }
+    scopes.clear();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -515,10 +561,60 @@ void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uin
 
 
 // ------------------------------------------------------------------------------------------------
-// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
-void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
+// determine the size of a binary array element by looking at the type signature, 0 if unknown
+uint32_t BinaryDataArrayStride(char type)
+{
+    switch(type)
+    {
+        case 'f':
+        case 'i':
+            return 4;
+
+        case 'd':
+        case 'l':
+            return 8;
+
+        default:
+            break;
+    };
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// zlib/deflate, starting with the ZIP head (0x78 0x01), see http://www.ietf.org/rfc/rfc1950.txt
+bool InflateBinaryDataArray(const char* data, uint32_t comp_len, char* out, uint32_t full_length)
+{
+    z_stream zstream;
+    zstream.opaque = Z_NULL;
+    zstream.zalloc = Z_NULL;
+    zstream.zfree  = Z_NULL;
+    zstream.data_type = Z_BINARY;
+
+    // http://hewgill.com/journal/entries/349-how-to-decompress-gzip-stream-with-zlib
+    if(Z_OK != inflateInit(&zstream)) {
+        ParseError("failure initializing zlib");
+    }
+
+    zstream.next_in   = reinterpret_cast<Bytef*>( const_cast<char*>(data) );
+    zstream.avail_in  = comp_len;
+
+    zstream.avail_out = static_cast<uInt>(full_length);
+    zstream.next_out = reinterpret_cast<Bytef*>(out);
+    const int ret = inflate(&zstream, Z_FINISH);
+
+    // terminate zlib
+    inflateEnd(&zstream);
+
+    return ret == Z_STREAM_END || ret == Z_OK;
+}
+
+// ------------------------------------------------------------------------------------------------
+// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header).
+// Returns the decoded data, which is either stored in 'buff' or owned by the parser if the
+// array was inflated ahead of time.
+const char* ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
     std::vector<char>& buff,
-    const Element& /*el*/)
+    const Element& el)
 {
     BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
     AI_SWAP4(encmode);
@@ -531,23 +627,13 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
 
     ai_assert(data + comp_len == end);
 
-    // determine the length of the uncompressed data by looking at the type signature
-    uint32_t stride = 0;
-    switch(type)
-    {
-        case 'f':
-        case 'i':
-            stride = 4;
-            break;
-
-        case 'd':
-        case 'l':
-            stride = 8;
-            break;
+    if (el.InflatedArray()) {
+        data += comp_len;
+        return el.InflatedArray();
+    }
 
-        default:
-            ai_assert(false);
-    };
+    const uint32_t stride = BinaryDataArrayStride(type);
+    ai_assert(stride);
 
     const uint32_t full_length = stride * count;
     buff.resize(full_length);
@@ -559,33 +645,9 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
         std::copy(data, end, buff.begin());
     }
     else if(encmode == 1) {
-        // zlib/deflate, next comes ZIP head (0x78 0x01)
-        // see http://www.ietf.org/rfc/rfc1950.txt
-
-        z_stream zstream;
-        zstream.opaque = Z_NULL;
-        zstream.zalloc = Z_NULL;
-        zstream.zfree  = Z_NULL;
-        zstream.data_type = Z_BINARY;
-
-        // http://hewgill.com/journal/entries/349-how-to-decompress-gzip-stream-with-zlib
-        if(Z_OK != inflateInit(&zstream)) {
-            ParseError("failure initializing zlib");
-        }
-
-        zstream.next_in   = reinterpret_cast<Bytef*>( const_cast<char*>(data) );
-        zstream.avail_in  = comp_len;
-
-        zstream.avail_out = static_cast<uInt>(buff.size());
-        zstream.next_out = reinterpret_cast<Bytef*>(&*buff.begin());
-        const int ret = inflate(&zstream, Z_FINISH);
-
-        if (ret != Z_STREAM_END && ret != Z_OK) {
+        if (!InflateBinaryDataArray(data, comp_len, &buff[0], full_length)) {
             ParseError("failure decompressing compressed data section");
         }
-
-        // terminate zlib
-        inflateEnd(&zstream);
     }
 #ifdef ASSIMP_BUILD_DEBUG
     else {
@@ -596,10 +658,81 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
 
     data += comp_len;
     ai_assert(data == end);
+    return &buff[0];
 }
 
 } // !anon
 
+// ------------------------------------------------------------------------------------------------
+void Parser::InflateArrays(unsigned int numThreads)
+{
+    if (!is_binary) {
+        return;
+    }
+
+    struct Job {
+        Element* el;
+        const char* data;
+        uint32_t comp_len;
+        char* out;
+        uint32_t full_length;
+    };
+
+    // gather all deflated arrays and reserve their storage, the
+    // arena isn't thread-safe so this happens up front.
+    std::vector<Job> jobs;
+    for (Scope* scope : scopes) {
+        for (const ElementMap::value_type& v : scope->elements) {
+            Element& el = *v.second;
+            if (el.tokens.empty() || !el.tokens[0]->IsBinary()) {
+                continue;
+            }
+
+            const char* data = el.tokens[0]->begin(), *end = el.tokens[0]->end();
+            if (end - data < 13) {
+                continue;
+            }
+
+            const uint32_t stride = BinaryDataArrayStride(data[0]);
+            BE_NCONST uint32_t count = SafeParse<uint32_t>(data + 1, end);
+            BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data + 5, end);
+            BE_NCONST uint32_t comp_len = SafeParse<uint32_t>(data + 9, end);
+            AI_SWAP4(count);
+            AI_SWAP4(encmode);
+            AI_SWAP4(comp_len);
+
+            if (!stride || !count || encmode != 1 || data + 13 + comp_len != end) {
+                continue;
+            }
+
+            Job job;
+            job.el = &el;
+            job.data = data + 13;
+            job.comp_len = comp_len;
+            job.full_length = stride * count;
+            job.out = static_cast<char*>(arena.Allocate(job.full_length));
+            jobs.push_back(job);
+        }
+    }
+
+    if (jobs.empty()) {
+        return;
+    }
+
+    // largest first so the threads finish at about the same time
+    std::sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) {
+        return a.comp_len > b.comp_len;
+    });
+
+    ThreadPool pool(numThreads);
+    pool.ParallelFor(static_cast<unsigned int>(jobs.size()), [&jobs](unsigned int i) {
+        const Job& job = jobs[i];
+        if (InflateBinaryDataArray(job.data, job.comp_len, job.out, job.full_length)) {
+            job.el->inflated = job.out;
+        }
+    });
+}
+
 
 // ------------------------------------------------------------------------------------------------
 // read an array of float3 tuples
@@ -607,7 +740,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 {
     out.resize( 0 );
 
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -632,16 +765,15 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
 
         const uint32_t count3 = count / 3;
         out.reserve(count3);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count3; ++i, d += 3) {
                 out.push_back(aiVector3D(static_cast<float>(d[0]),
                     static_cast<float>(d[1]),
@@ -656,7 +788,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
             }*/
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count3; ++i, f += 3) {
                 out.push_back(aiVector3D(f[0],f[1],f[2]));
             }
@@ -678,7 +810,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
     if (a.Tokens().size() % 3 != 0) {
         ParseError("number of floats is not a multiple of three (3)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiVector3D v;
         v.x = ParseTokenAsFloat(**it++);
         v.y = ParseTokenAsFloat(**it++);
@@ -694,7 +826,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -719,16 +851,15 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
 
         const uint32_t count4 = count / 4;
         out.reserve(count4);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count4; ++i, d += 4) {
                 out.push_back(aiColor4D(static_cast<float>(d[0]),
                     static_cast<float>(d[1]),
@@ -737,7 +868,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
             }
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count4; ++i, f += 4) {
                 out.push_back(aiColor4D(f[0],f[1],f[2],f[3]));
             }
@@ -756,7 +887,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
     if (a.Tokens().size() % 4 != 0) {
         ParseError("number of floats is not a multiple of four (4)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiColor4D v;
         v.r = ParseTokenAsFloat(**it++);
         v.g = ParseTokenAsFloat(**it++);
@@ -773,7 +904,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -798,23 +929,22 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
 
         const uint32_t count2 = count / 2;
         out.reserve(count2);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count2; ++i, d += 2) {
                 out.push_back(aiVector2D(static_cast<float>(d[0]),
                     static_cast<float>(d[1])));
             }
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count2; ++i, f += 2) {
                 out.push_back(aiVector2D(f[0],f[1]));
             }
@@ -834,7 +964,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
     if (a.Tokens().size() % 2 != 0) {
         ParseError("number of floats is not a multiple of two (2)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiVector2D v;
         v.x = ParseTokenAsFloat(**it++);
         v.y = ParseTokenAsFloat(**it++);
@@ -849,7 +979,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
 void ParseVectorDataArray(std::vector<int>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -870,14 +1000,13 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * 4);
 
         out.reserve(count);
 
-        const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
+        const int32_t* ip = reinterpret_cast<const int32_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int32_t val = *ip;
             AI_SWAP4(val);
@@ -895,7 +1024,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const int ival = ParseTokenAsInt(**it++);
         out.push_back(ival);
     }
@@ -907,7 +1036,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
 void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -928,19 +1057,18 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count; ++i, ++d) {
                 out.push_back(static_cast<float>(*d));
             }
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count; ++i, ++f) {
                 out.push_back(*f);
             }
@@ -957,7 +1085,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const float ival = ParseTokenAsFloat(**it++);
         out.push_back(ival);
     }
@@ -969,7 +1097,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -990,14 +1118,13 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * 4);
 
         out.reserve(count);
 
-        const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
+        const int32_t* ip = reinterpret_cast<const int32_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int32_t val = *ip;
             if(val < 0) {
@@ -1019,7 +1146,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const int ival = ParseTokenAsInt(**it++);
         if(ival < 0) {
             ParseError("encountered negative integer index");
@@ -1034,7 +1161,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
 void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -1055,14 +1182,13 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * 8);
 
         out.reserve(count);
 
-        const uint64_t* ip = reinterpret_cast<const uint64_t*>(&buff[0]);
+        const uint64_t* ip = reinterpret_cast<const uint64_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST uint64_t val = *ip;
             AI_SWAP8(val);
@@ -1080,7 +1206,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const uint64_t ival = ParseTokenAsID(**it++);
 
         out.push_back(ival);
@@ -1092,7 +1218,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const TokenRange& tok = el.Tokens();
     if (tok.empty()) {
         ParseError("unexpected empty element", &el);
     }
@@ -1113,14 +1239,13 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        const char* const raw = ReadBinaryDataArray(type, count, data, end, buff, el);
 
         ai_assert(data == end);
-        ai_assert(buff.size() == count * 8);
 
         out.reserve(count);
 
-        const int64_t* ip = reinterpret_cast<const int64_t*>(&buff[0]);
+        const int64_t* ip = reinterpret_cast<const int64_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int64_t val = *ip;
             AI_SWAP8(val);
@@ -1138,7 +1263,7 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope, "a", &el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end;) {
+    for (TokenRange::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end;) {
         const int64_t ival = ParseTokenAsInt64(**it++);
 
         out.push_back(ival);
@@ -1233,7 +1358,7 @@ const Scope& GetRequiredScope(const Element& el)
 // get token at a particular index
 const Token& GetRequiredToken(const Element& el, unsigned int index)
 {
-    const TokenList& t = el.Tokens();
+    const TokenRange& t = el.Tokens();
     if(index >= t.size()) {
         ParseError(Formatter::format( "missing token at index " ) << index,&el);
     }
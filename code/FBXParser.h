@@ -62,15 +62,12 @@ class Scope;
 class Parser;
 class Element;
 
-// XXX should use C++11's unique_ptr - but assimp's need to keep working with 03
+// elements and scopes are owned by the parser's arena
 typedef std::vector< Scope* > ScopeList;
 typedef std::fbx_unordered_multimap< std::string, Element* > ElementMap;
 
 typedef std::pair<ElementMap::const_iterator,ElementMap::const_iterator> ElementCollection;
 
-#   define new_Scope new Scope
-#   define new_Element new Element
-
 
 /** FBX data entity that consists of a key:value tuple.
  *
@@ -82,29 +79,38 @@ typedef std::pair<ElementMap::const_iterator,ElementMap::const_iterator> Element
  *  @endverbatim
  *
  *  As can be seen in this sample, elements can contain nested #Scope
- *  as their trailing member.  **/
+ *  as their trailing member. Elements are allocated from the parser's
+ *  arena and never destroyed individually. **/
 class Element
 {
 public:
     Element(const Token& key_token, Parser& parser);
-    ~Element();
 
     const Scope* Compound() const {
-        return compound.get();
+        return compound;
     }
 
     const Token& KeyToken() const {
         return key_token;
     }
 
-    const TokenList& Tokens() const {
+    const TokenRange& Tokens() const {
         return tokens;
     }
 
+    /** Contents of the compressed binary array held by the first token,
+     *  if Parser::InflateArrays() has decoded it already, NULL otherwise. */
+    const char* InflatedArray() const {
+        return inflated;
+    }
+
 private:
+    friend class Parser;
+
     const Token& key_token;
-    TokenList tokens;
-    std::unique_ptr<Scope> compound;
+    TokenRange tokens;
+    const Scope* compound;
+    const char* inflated;
 };
 
 /** FBX data entity that consists of a 'scope', a collection
@@ -122,7 +128,6 @@ class Scope
 {
 public:
     Scope(Parser& parser, bool topLevel = false);
-    ~Scope();
 
     const Element* operator[] (const std::string& index) const {
         ElementMap::const_iterator it = elements.find(index);
@@ -149,11 +154,16 @@ public:
     }
 
 private:
+    friend class Parser;
+
     ElementMap elements;
 };
 
 /** FBX parsing class, takes a list of input tokens and generates a hierarchy
- *  of nested #Scope instances, representing the fbx DOM.*/
+ *  of nested #Scope instances, representing the fbx DOM.
+ *
+ *  All elements, scopes and per-element token lists are allocated from a
+ *  single arena and released together with the parser. */
 class Parser
 {
 public:
@@ -163,13 +173,19 @@ public:
     ~Parser();
 
     const Scope& GetRootScope() const {
-        return *root.get();
+        return *root;
     }
 
     bool IsBinary() const {
         return is_binary;
     }
 
+    /** Decompresses all deflated binary arrays of the DOM up front, spread
+     *  across the given number of threads. The data array parsers pick up
+     *  the results via Element::InflatedArray(); arrays that fail to
+     *  decompress are left to them so errors surface as before. */
+    void InflateArrays(unsigned int numThreads);
+
 private:
     friend class Scope;
     friend class Element;
@@ -178,12 +194,21 @@ private:
     TokenPtr LastToken() const;
     TokenPtr CurrentToken() const;
 
+    Scope* NewScope(bool topLevel = false);
+    Element* NewElement(const Token& key_token);
+    TokenRange StoreTokens(const TokenList& list);
+    void DestroyScopes();
+
 private:
     const TokenList& tokens;
 
     TokenPtr last, current;
     TokenList::const_iterator cursor;
-    std::unique_ptr<Scope> root;
+
+    MemoryArena arena;
+    ScopeList scopes;
+    TokenList element_tokens;
+    Scope* root;
 
     const bool is_binary;
 };
@@ -60,11 +60,7 @@ namespace FBX {
 
 // ------------------------------------------------------------------------------------------------
 Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int line, unsigned int column)
-    :
-#ifdef DEBUG
-    contents(sbegin, static_cast<size_t>(send-sbegin)),
-#endif
-    sbegin(sbegin)
+    : sbegin(sbegin)
     , send(send)
     , type(type)
     , line(line)
@@ -77,11 +73,6 @@ Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int
     ai_assert(static_cast<size_t>(send-sbegin) > 0);
 }
 
-// ------------------------------------------------------------------------------------------------
-Token::~Token()
-{
-}
-
 namespace {
 
 // ------------------------------------------------------------------------------------------------
@@ -95,7 +86,7 @@ AI_WONT_RETURN void TokenizeError(const std::string& message, unsigned int line,
 
 // process a potential data token up to 'cur', adding it to 'output_tokens'.
 // ------------------------------------------------------------------------------------------------
-void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*& end,
+void ProcessDataToken( TokenList& output_tokens, MemoryArena& arena, const char*& start, const char*& end,
                       unsigned int line,
                       unsigned int column,
                       TokenType type = TokenType_DATA,
@@ -120,7 +111,7 @@ void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*
             TokenizeError("non-terminated double quotes", line, column);
         }
 
-        output_tokens.push_back(new_Token(start,end + 1,type,line,column));
+        output_tokens.push_back(arena.New<Token>(start,end + 1,type,line,column));
     }
     else if (must_have_token) {
         TokenizeError("unexpected character, expected data token", line, column);
@@ -132,7 +123,7 @@ void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*
 }
 
 // ------------------------------------------------------------------------------------------------
-void Tokenize(TokenList& output_tokens, const char* input)
+void Tokenize(TokenList& output_tokens, const char* input, MemoryArena& arena)
 {
     ai_assert(input);
 
@@ -164,7 +155,7 @@ void Tokenize(TokenList& output_tokens, const char* input)
                 in_double_quotes = false;
                 token_end = cur;
 
-                ProcessDataToken(output_tokens,token_begin,token_end,line,column);
+                ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column);
                 pending_data_token = false;
             }
             continue;
@@ -181,30 +172,30 @@ void Tokenize(TokenList& output_tokens, const char* input)
             continue;
 
         case ';':
-            ProcessDataToken(output_tokens,token_begin,token_end,line,column);
+            ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column);
             comment = true;
             continue;
 
         case '{':
-            ProcessDataToken(output_tokens,token_begin,token_end, line, column);
-            output_tokens.push_back(new_Token(cur,cur+1,TokenType_OPEN_BRACKET,line,column));
+            ProcessDataToken(output_tokens,arena,token_begin,token_end, line, column);
+            output_tokens.push_back(arena.New<Token>(cur,cur+1,TokenType_OPEN_BRACKET,line,column));
             continue;
 
         case '}':
-            ProcessDataToken(output_tokens,token_begin,token_end,line,column);
-            output_tokens.push_back(new_Token(cur,cur+1,TokenType_CLOSE_BRACKET,line,column));
+            ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column);
+            output_tokens.push_back(arena.New<Token>(cur,cur+1,TokenType_CLOSE_BRACKET,line,column));
             continue;
 
         case ',':
             if (pending_data_token) {
-                ProcessDataToken(output_tokens,token_begin,token_end,line,column,TokenType_DATA,true);
+                ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column,TokenType_DATA,true);
             }
-            output_tokens.push_back(new_Token(cur,cur+1,TokenType_COMMA,line,column));
+            output_tokens.push_back(arena.New<Token>(cur,cur+1,TokenType_COMMA,line,column));
             continue;
 
         case ':':
             if (pending_data_token) {
-                ProcessDataToken(output_tokens,token_begin,token_end,line,column,TokenType_KEY,true);
+                ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column,TokenType_KEY,true);
             }
             else {
                 TokenizeError("unexpected colon", line, column);
@@ -226,7 +217,7 @@ void Tokenize(TokenList& output_tokens, const char* input)
                     }
                 }
 
-                ProcessDataToken(output_tokens,token_begin,token_end,line,column,type);
+                ProcessDataToken(output_tokens,arena,token_begin,token_end,line,column,type);
             }
 
             pending_data_token = false;
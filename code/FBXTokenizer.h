@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_FBX_TOKENIZER_H
 
 #include "FBXCompileConfig.h"
+#include "MemoryArena.h"
 #include <assimp/ai_assert.h>
 #include <vector>
 #include <string>
@@ -82,7 +83,8 @@ enum TokenType
 /** Represents a single token in a FBX file. Tokens are
  *  classified by the #TokenType enumerated types.
  *
- *  Offers iterator protocol. Tokens are immutable. */
+ *  Offers iterator protocol. Tokens are immutable and trivially
+ *  destructible, they live in a #MemoryArena owned by the importer. */
 class Token
 {
 private:
@@ -95,8 +97,6 @@ public:
     /** construct a binary token */
     Token(const char* sbegin, const char* send, TokenType type, unsigned int offset);
 
-    ~Token();
-
 public:
     std::string StringContents() const {
         return std::string(begin(),end());
@@ -134,14 +134,6 @@ public:
     }
 
 private:
-
-#ifdef DEBUG
-    // full string copy for the sole purpose that it nicely appears
-    // in msvc's debugger window.
-    const std::string contents;
-#endif
-
-
     const char* const sbegin;
     const char* const send;
     const TokenType type;
@@ -153,11 +145,51 @@ private:
     const unsigned int column;
 };
 
-// XXX should use C++11's unique_ptr - but assimp's need to keep working with 03
+// tokens are owned by the arena passed to the tokenizer
 typedef const Token* TokenPtr;
 typedef std::vector< TokenPtr > TokenList;
 
-#define new_Token new Token
+/** Read-only view of a contiguous sequence of tokens. Does not own
+ *  the storage it refers to. */
+class TokenRange
+{
+public:
+    typedef const TokenPtr* const_iterator;
+
+    TokenRange()
+        : first()
+        , last()
+    {}
+
+    TokenRange(const_iterator first, const_iterator last)
+        : first(first)
+        , last(last)
+    {}
+
+    const_iterator begin() const {
+        return first;
+    }
+
+    const_iterator end() const {
+        return last;
+    }
+
+    size_t size() const {
+        return static_cast<size_t>(last - first);
+    }
+
+    bool empty() const {
+        return first == last;
+    }
+
+    TokenPtr operator[] (size_t index) const {
+        ai_assert(index < size());
+        return first[index];
+    }
+
+private:
+    const_iterator first, last;
+};
 
 
 /** Main FBX tokenizer function. Transform input buffer into a list of preprocessed tokens.
@@ -166,8 +198,10 @@ typedef std::vector< TokenPtr > TokenList;
  *
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Textual input buffer to be processed, 0-terminated.
+ * @param arena Receives the storage of the tokens, they remain valid
+ *   until the arena is destroyed.
  * @throw DeadlyImportError if something goes wrong */
-void Tokenize(TokenList& output_tokens, const char* input);
+void Tokenize(TokenList& output_tokens, const char* input, MemoryArena& arena);
 
 
 /** Tokenizer function for binary FBX files.
@@ -177,8 +211,9 @@ void Tokenize(TokenList& output_tokens, const char* input);
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Binary input buffer to be processed.
  * @param length Length of input buffer, in bytes. There is no 0-terminal.
+ * @param arena Receives the storage of the tokens, see #Tokenize
  * @throw DeadlyImportError if something goes wrong */
-void TokenizeBinary(TokenList& output_tokens, const char* input, unsigned int length);
+void TokenizeBinary(TokenList& output_tokens, const char* input, unsigned int length, MemoryArena& arena);
 
 
 } // ! FBX
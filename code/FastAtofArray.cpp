@@ -0,0 +1,380 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  FastAtofArray.cpp
+ *  @brief Batched number parsing, see fast_atoreal_array() in fast_atof.h
+ */
+#include <assimp/fast_atof.h>
+#include "simd.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define AI_FAST_ATOF_SSE2
+#   include <emmintrin.h>
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   endif
+#endif
+
+namespace Assimp {
+
+namespace {
+
+inline bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f';
+}
+
+inline bool IsDecimalPoint(char c, bool check_comma) {
+    return c == '.' || (check_comma && c == ',');
+}
+
+#ifdef AI_FAST_ATOF_SSE2
+
+// ------------------------------------------------------------------------------------------------
+// Modular inverses of the powers of five, used to divide exactly by powers of ten.
+struct PowerOfFiveInverses {
+    uint64_t mValues[17];
+
+    PowerOfFiveInverses() {
+        uint64_t power = 1;
+        for (unsigned int i = 0; i < 17; ++i, power *= 5) {
+            // Newton's iteration doubles the number of correct bits in each step
+            uint64_t inverse = power;
+            for (unsigned int n = 0; n < 5; ++n) {
+                inverse *= 2 - power * inverse;
+            }
+            mValues[i] = inverse;
+        }
+    }
+};
+
+inline unsigned int CountTrailingZeros(unsigned int value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(value));
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the length of the run of digits at c and its value. 16 bytes must be readable at c.
+// Runs of 16 or more digits return 16 and leave value untouched.
+inline unsigned int ReadDigitRunSSE2(const char* c, uint64_t& value) {
+    static const PowerOfFiveInverses inverses;
+
+    const __m128i digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c)), _mm_set1_epi8('0'));
+
+    // unsigned digits < 10, done as signed compare with flipped sign bits
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i isDigit = _mm_cmplt_epi8(_mm_xor_si128(digits, bias), _mm_set1_epi8(static_cast<char>(0x80 + 10)));
+    const unsigned int length = CountTrailingZeros(~static_cast<unsigned int>(_mm_movemask_epi8(isDigit)));
+    if (length >= 16) {
+        return 16;
+    }
+
+    // keep the run only, the digits are left aligned and padded with zeros
+    const __m128i lanes = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i run = _mm_and_si128(digits, _mm_cmplt_epi8(lanes, _mm_set1_epi8(static_cast<char>(length))));
+
+    // combine pairs of digits, then pairs of those and so on
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tens = _mm_setr_epi16(10, 1, 10, 1, 10, 1, 10, 1);
+    const __m128i d2 = _mm_packs_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(run, zero), tens),
+            _mm_madd_epi16(_mm_unpackhi_epi8(run, zero), tens));
+    const __m128i d4 = _mm_madd_epi16(d2, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const __m128i d8 = _mm_madd_epi16(_mm_packs_epi32(d4, d4), _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    const uint64_t upper = static_cast<uint32_t>(_mm_cvtsi128_si32(d8));
+    const uint64_t lower = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(d8, 4)));
+    const uint64_t padded = upper * 100000000u + lower;
+
+    // padded is value * 10^k, which is divided exactly by shifting out 2^k and
+    // multiplying with the inverse of 5^k
+    const unsigned int k = 16 - length;
+    value = (padded >> k) * inverses.mValues[k];
+    return length;
+}
+
+#endif // AI_FAST_ATOF_SSE2
+
+// ------------------------------------------------------------------------------------------------
+// Reads a run of digits like strtoul10_64(). At most maxDigits digits are
+// accumulated, the rest of the run is skipped.
+template <bool SSE2>
+inline uint64_t ReadUInt64(const char*& c, const char* end, unsigned int maxDigits, unsigned int* numDigits) {
+#ifdef AI_FAST_ATOF_SSE2
+    if (SSE2 && end - c >= 16) {
+        uint64_t value;
+        const unsigned int length = ReadDigitRunSSE2(c, value);
+        if (length < 16 && length <= maxDigits) {
+            c += length;
+            if (numDigits) {
+                *numDigits = length;
+            }
+            return value;
+        }
+    }
+#endif
+
+    uint64_t value = 0;
+    unsigned int cur = 0;
+    while (c != end && IsDigit(*c)) {
+        if (cur == maxDigits) {
+            while (c != end && IsDigit(*c)) {
+                ++c;
+            }
+            break;
+        }
+
+        const uint64_t newValue = (value * 10) + static_cast<uint64_t>(*c - '0');
+        if (newValue < value) {
+            ASSIMP_LOG_WARN("Converting a number resulted in overflow.");
+            while (c != end && IsDigit(*c)) {
+                ++c;
+            }
+            value = 0;
+            break;
+        }
+        value = newValue;
+        ++c;
+        ++cur;
+    }
+    if (numDigits) {
+        *numDigits = cur;
+    }
+    return value;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads a run of digits like strtoul10(), wrapping around on overflow.
+template <bool SSE2>
+inline unsigned int ReadUInt32(const char*& c, const char* end) {
+#ifdef AI_FAST_ATOF_SSE2
+    if (SSE2 && end - c >= 16) {
+        uint64_t value;
+        const unsigned int length = ReadDigitRunSSE2(c, value);
+        if (length < 16) {
+            c += length;
+            return static_cast<unsigned int>(value);
+        }
+    }
+#endif
+
+    unsigned int value = 0;
+    while (c != end && IsDigit(*c)) {
+        value = (value * 10) + (*c - '0');
+        ++c;
+    }
+    return value;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Same as fast_atoreal_move(), but bounded by end. Returns nullptr if no number starts at c.
+template <typename Real, bool SSE2>
+inline const char* ReadReal(const char* c, const char* end, Real& out, bool check_comma) {
+    const bool inv = (*c == '-');
+    if (inv || *c == '+') {
+        if (++c == end) {
+            return nullptr;
+        }
+    }
+
+    if (!IsDigit(*c)) {
+        if (IsDecimalPoint(*c, check_comma) && end - c > 1 && IsDigit(c[1])) {
+            // fraction without integer part
+        } else if (end - c >= 3 && ASSIMP_strincmp(c, "nan", 3) == 0) {
+            out = std::numeric_limits<Real>::quiet_NaN();
+            return c + 3;
+        } else if (end - c >= 3 && ASSIMP_strincmp(c, "inf", 3) == 0) {
+            out = std::numeric_limits<Real>::infinity();
+            if (inv) {
+                out = -out;
+            }
+            c += 3;
+            if (end - c >= 5 && ASSIMP_strincmp(c, "inity", 5) == 0) {
+                c += 5;
+            }
+            return c;
+        } else {
+            return nullptr;
+        }
+    }
+
+    Real f = 0;
+    if (!IsDecimalPoint(*c, check_comma)) {
+        f = static_cast<Real>(ReadUInt64<SSE2>(c, end, ~0u, nullptr));
+    }
+
+    if (c != end && IsDecimalPoint(*c, check_comma) && end - c > 1 && IsDigit(c[1])) {
+        ++c;
+        unsigned int diff = AI_FAST_ATOF_RELAVANT_DECIMALS;
+        double pl = static_cast<double>(ReadUInt64<SSE2>(c, end, diff, &diff));
+
+        pl *= fast_atof_table[diff];
+        f += static_cast<Real>(pl);
+    } else if (c != end && *c == '.') {
+        // For backwards compatibility: eat trailing dots, but not trailing commas.
+        ++c;
+    }
+
+    if (c != end && (*c == 'e' || *c == 'E')) {
+        ++c;
+        const bool einv = (c != end && *c == '-');
+        if (einv || (c != end && *c == '+')) {
+            ++c;
+        }
+        if (c == end || !IsDigit(*c)) {
+            throw std::invalid_argument("Cannot parse string as real number: exponent without digits.");
+        }
+
+        Real exp = static_cast<Real>(ReadUInt64<SSE2>(c, end, ~0u, nullptr));
+        if (einv) {
+            exp = -exp;
+        }
+        f *= std::pow(static_cast<Real>(10.0), exp);
+    }
+
+    if (inv) {
+        f = -f;
+    }
+    out = f;
+    return c;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Real, bool SSE2>
+size_t ReadRealArray(const char** inout, const char* end, Real* out, size_t count, bool check_comma) {
+    const char* c = *inout;
+    size_t i = 0;
+    for (; i < count; ++i) {
+        while (c != end && IsBlank(*c)) {
+            ++c;
+        }
+        if (c == end) {
+            break;
+        }
+        Real value;
+        const char* next = ReadReal<Real, SSE2>(c, end, value, check_comma);
+        if (nullptr == next || (next != end && !IsBlank(*next))) {
+            break;
+        }
+        out[i] = value;
+        c = next;
+    }
+    *inout = c;
+    return i;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Int, bool SSE2>
+size_t ReadIntArray(const char** inout, const char* end, Int* out, size_t count, bool allowSign) {
+    const char* c = *inout;
+    size_t i = 0;
+    for (; i < count; ++i) {
+        while (c != end && IsBlank(*c)) {
+            ++c;
+        }
+        const char* p = c;
+        const bool inv = allowSign && p != end && *p == '-';
+        if (allowSign && p != end && (inv || *p == '+')) {
+            ++p;
+        }
+        if (p == end || !IsDigit(*p)) {
+            break;
+        }
+
+        unsigned int value = ReadUInt32<SSE2>(p, end);
+        if (p != end && !IsBlank(*p)) {
+            break;
+        }
+        if (inv) {
+            value = 0u - value;
+        }
+        out[i] = static_cast<Int>(value);
+        c = p;
+    }
+    *inout = c;
+    return i;
+}
+
+inline bool UseSSE2() {
+#ifdef AI_FAST_ATOF_SSE2
+    static const bool supported = CPUSupportsSSE2();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+size_t fast_atoreal_array(const char** inout, const char* end, float* out, size_t count, bool check_comma) {
+    return UseSSE2() ? ReadRealArray<float, true>(inout, end, out, count, check_comma)
+                     : ReadRealArray<float, false>(inout, end, out, count, check_comma);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t fast_atoreal_array(const char** inout, const char* end, double* out, size_t count, bool check_comma) {
+    return UseSSE2() ? ReadRealArray<double, true>(inout, end, out, count, check_comma)
+                     : ReadRealArray<double, false>(inout, end, out, count, check_comma);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t strtoul10_array(const char** inout, const char* end, unsigned int* out, size_t count) {
+    return UseSSE2() ? ReadIntArray<unsigned int, true>(inout, end, out, count, false)
+                     : ReadIntArray<unsigned int, false>(inout, end, out, count, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t strtol10_array(const char** inout, const char* end, int* out, size_t count) {
+    return UseSSE2() ? ReadIntArray<int, true>(inout, end, out, count, true)
+                     : ReadIntArray<int, false>(inout, end, out, count, true);
+}
+
+} // namespace Assimp
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FindInstancesProcess.h"
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <stdio.h>
 
 using namespace Assimp;
@@ -56,6 +58,7 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 FindInstancesProcess::FindInstancesProcess()
 :   configSpeedFlag (false)
+,   configContentHash (false)
 {}
 
 // ------------------------------------------------------------------------------------------------
@@ -78,25 +81,133 @@ void FindInstancesProcess::SetupProperties(const Importer* pImp)
 {
     // AI_CONFIG_FAVOUR_SPEED
     configSpeedFlag = (0 != pImp->GetPropertyInteger(AI_CONFIG_FAVOUR_SPEED,0));
+
+    // AI_CONFIG_PP_FI_CONTENT_HASH
+    configContentHash = pImp->GetPropertyBool(AI_CONFIG_PP_FI_CONTENT_HASH,false);
 }
 
+namespace {
+
 // ------------------------------------------------------------------------------------------------
-// Compare the bones of two meshes
-bool CompareBones(const aiMesh* orig, const aiMesh* inst)
+// 64 bit FNV-1a, fed with 32 bit words
+const uint64_t FnvOffsetBasis = 14695981039346656037ull;
+const uint64_t FnvPrime = 1099511628211ull;
+
+inline uint64_t HashWord(uint64_t hash, uint32_t word) {
+    for (unsigned int i = 0; i < 4; ++i, word >>= 8) {
+        hash = (hash ^ (word & 0xff)) * FnvPrime;
+    }
+    return hash;
+}
+
+inline uint64_t HashReal(uint64_t hash, ai_real value) {
+    // -0 and +0 compare equal, so they must hash alike
+    if (value == ai_real(0.0)) {
+        value = ai_real(0.0);
+    }
+    uint32_t words[sizeof(ai_real) / sizeof(uint32_t)];
+    ::memcpy(words, &value, sizeof(ai_real));
+    for (uint32_t word : words) {
+        hash = HashWord(hash, word);
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t HashReals(uint64_t hash, const T* values, unsigned int count) {
+    if (nullptr == values) {
+        return HashWord(hash, 0);
+    }
+    const ai_real* p = reinterpret_cast<const ai_real*>(values);
+    for (const ai_real* end = p + count * (sizeof(T) / sizeof(ai_real)); p != end; ++p) {
+        hash = HashReal(hash, *p);
+    }
+    return hash;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+uint64_t Assimp::GetMeshContentHash(const aiMesh* in, bool withTopologyAndBones)
+{
+    ai_assert(nullptr != in);
+
+    uint64_t hash = HashWord(HashWord(FnvOffsetBasis, 0), 0);
+    const uint64_t base = GetMeshHash(const_cast<aiMesh*>(in));
+    hash = HashWord(HashWord(hash, static_cast<uint32_t>(base)), static_cast<uint32_t>(base >> 32u));
+
+    const unsigned int n = in->mNumVertices;
+    hash = HashReals(hash, in->mVertices, n);
+    hash = HashReals(hash, in->mNormals, n);
+    hash = HashReals(hash, in->mTangents, n);
+    hash = HashReals(hash, in->mBitangents, n);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        hash = HashReals(hash, in->mTextureCoords[i], n);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        hash = HashReals(hash, in->mColors[i], n);
+    }
+
+    if (withTopologyAndBones) {
+        // the vertex -> face mapping, as compared by FindInstancesProcess
+        std::vector<unsigned int> ftbl(n, 0);
+        for (unsigned int i = 0; i < in->mNumFaces; ++i) {
+            const aiFace& f = in->mFaces[i];
+            for (unsigned int j = 0; j < f.mNumIndices; ++j) {
+                ftbl[f.mIndices[j]] = i;
+            }
+        }
+        for (unsigned int face : ftbl) {
+            hash = HashWord(hash, face);
+        }
+
+        // bone weights are compared with an epsilon, so only their vertices are hashed.
+        // The name identifies the node the bone is bound to.
+        for (unsigned int i = 0; i < in->mNumBones; ++i) {
+            const aiBone* bone = in->mBones[i];
+            hash = HashWord(hash, bone->mName.length);
+            for (unsigned int c = 0; c < bone->mName.length; ++c) {
+                hash = (hash ^ static_cast<unsigned char>(bone->mName.data[c])) * FnvPrime;
+            }
+            hash = HashWord(hash, bone->mNumWeights);
+            hash = HashReals(hash, &bone->mOffsetMatrix.a1, 16);
+            for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                hash = HashWord(hash, bone->mWeights[w].mVertexId);
+            }
+        }
+    }
+    return hash;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Check whether two meshes are bound to the same bones, i.e. the same nodes
+bool CompareBoneBindings(const aiMesh* orig, const aiMesh* inst)
 {
     for (unsigned int i = 0; i < orig->mNumBones;++i) {
-        aiBone* aha = orig->mBones[i];
-        aiBone* oha = inst->mBones[i];
+        const aiBone* aha = orig->mBones[i];
+        const aiBone* oha = inst->mBones[i];
 
-        if (aha->mNumWeights   != oha->mNumWeights   ||
+        if (aha->mName         != oha->mName         ||
+            aha->mNumWeights   != oha->mNumWeights   ||
             aha->mOffsetMatrix != oha->mOffsetMatrix) {
             return false;
         }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compare the bone weights of two meshes with equal bone bindings
+bool CompareBones(const aiMesh* orig, const aiMesh* inst)
+{
+    for (unsigned int i = 0; i < orig->mNumBones;++i) {
+        aiBone* aha = orig->mBones[i];
+        aiBone* oha = inst->mBones[i];
 
         // compare weight per weight ---
         for (unsigned int n = 0; n < aha->mNumWeights;++n) {
             if  (aha->mWeights[n].mVertexId != oha->mWeights[n].mVertexId ||
-                (aha->mWeights[n].mWeight - oha->mWeights[n].mWeight) < 10e-3f) {
+                std::fabs(aha->mWeights[n].mWeight - oha->mWeights[n].mWeight) >= 10e-3f) {
                 return false;
             }
         }
@@ -115,6 +226,113 @@ void UpdateMeshIndices(aiNode* node, unsigned int* lookup)
         UpdateMeshIndices(node->mChildren[n],lookup);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Check whether a mesh is an instance of another mesh with the same hash
+bool FindInstancesProcess::IsInstance(const aiMesh* orig, const aiMesh* inst, float& epsilon) const
+{
+    // check for hash collision .. we needn't check
+    // the vertex format, it *must* match due to the
+    // (brilliant) construction of the hash
+    if (orig->mNumBones       != inst->mNumBones      ||
+        orig->mNumFaces       != inst->mNumFaces      ||
+        orig->mNumVertices    != inst->mNumVertices   ||
+        orig->mMaterialIndex  != inst->mMaterialIndex ||
+        orig->mPrimitiveTypes != inst->mPrimitiveTypes ||
+        orig->mNumLODs        != inst->mNumLODs)
+        return false;
+
+    // meshes bound to different skeletons are never instances of each other,
+    // merging them would lose one of the bindings
+    if (!CompareBoneBindings(orig,inst))
+        return false;
+
+    // up to now the meshes are equal. find an appropriate
+    // epsilon to compare position differences against
+    if (epsilon < 0.f) {
+        epsilon = ComputePositionEpsilon(inst);
+        epsilon *= epsilon;
+    }
+
+    // now compare vertex positions, normals,
+    // tangents and bitangents using this epsilon.
+    if (orig->HasPositions()) {
+        if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+            return false;
+    }
+    if (orig->HasNormals()) {
+        if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
+            return false;
+    }
+    if (orig->HasTangentsAndBitangents()) {
+        if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
+            !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
+            return false;
+    }
+
+    // use a constant epsilon for colors and UV coordinates
+    static const float uvEpsilon = 10e-4f;
+    {
+        unsigned int j, end = orig->GetNumUVChannels();
+        for(j = 0; j < end; ++j) {
+            if (!orig->mTextureCoords[j]) {
+                continue;
+            }
+            if(!CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
+                break;
+            }
+        }
+        if (j != end) {
+            return false;
+        }
+    }
+    {
+        unsigned int j, end = orig->GetNumColorChannels();
+        for(j = 0; j < end; ++j) {
+            if (!orig->mColors[j]) {
+                continue;
+            }
+            if(!CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
+                break;
+            }
+        }
+        if (j != end) {
+            return false;
+        }
+    }
+
+    // These two checks are actually quite expensive and almost *never* required.
+    // Almost. That's why they're still here. But there's no reason to do them
+    // in speed-targeted imports.
+    if (!configSpeedFlag) {
+
+        // It seems to be strange, but we really need to check whether the
+        // bones are identical too. Although it's extremely unprobable
+        // that they're not if control reaches here, we need to deal
+        // with unprobable cases, too. It could still be that there are
+        // equal shapes which are deformed differently.
+        if (!CompareBones(orig,inst))
+            return false;
+
+        // For completeness ... compare even the index buffers for equality
+        // face order & winding order doesn't care. Input data is in verbose format.
+        std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
+        std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
+
+        for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
+            aiFace& f = orig->mFaces[tt];
+            for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
+                ftbl_orig[f.mIndices[nn]] = tt;
+
+            aiFace& f2 = inst->mFaces[tt];
+            for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
+                ftbl_inst[f2.mIndices[nn]] = tt;
+        }
+        if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
+            return false;
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void FindInstancesProcess::Execute( aiScene* pScene)
@@ -127,119 +345,28 @@ void FindInstancesProcess::Execute( aiScene* pScene)
         // in the pipeline, so we could, depending on the file format,
         // have several thousand small meshes. That's too much for a brute
         // everyone-against-everyone check involving up to 10 comparisons
-        // each.
-        std::unique_ptr<uint64_t[]> hashes (new uint64_t[pScene->mNumMeshes]);
+        // each. Meshes are bucketed by their hash, so only meshes with
+        // equal hashes are ever compared. The content hash also separates
+        // meshes which only differ in their vertex data.
+        std::unordered_map<uint64_t, std::vector<unsigned int>> buckets;
+        buckets.reserve(pScene->mNumMeshes);
         std::unique_ptr<unsigned int[]> remapping (new unsigned int[pScene->mNumMeshes]);
 
         unsigned int numMeshesOut = 0;
         for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 
             aiMesh* inst = pScene->mMeshes[i];
-            hashes[i] = GetMeshHash(inst);
-
-            for (int a = i-1; a >= 0; --a) {
-                if (hashes[i] == hashes[a])
-                {
-                    aiMesh* orig = pScene->mMeshes[a];
-                    if (!orig)
-                        continue;
-
-                    // check for hash collision .. we needn't check
-                    // the vertex format, it *must* match due to the
-                    // (brilliant) construction of the hash
-                    if (orig->mNumBones       != inst->mNumBones      ||
-                        orig->mNumFaces       != inst->mNumFaces      ||
-                        orig->mNumVertices    != inst->mNumVertices   ||
-                        orig->mMaterialIndex  != inst->mMaterialIndex ||
-                        orig->mPrimitiveTypes != inst->mPrimitiveTypes)
-                        continue;
-
-                    // up to now the meshes are equal. find an appropriate
-                    // epsilon to compare position differences against
-                    float epsilon = ComputePositionEpsilon(inst);
-                    epsilon *= epsilon;
-
-                    // now compare vertex positions, normals,
-                    // tangents and bitangents using this epsilon.
-                    if (orig->HasPositions()) {
-                        if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-                    if (orig->HasNormals()) {
-                        if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-                    if (orig->HasTangentsAndBitangents()) {
-                        if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
-                            !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-
-                    // use a constant epsilon for colors and UV coordinates
-                    static const float uvEpsilon = 10e-4f;
-                    {
-                        unsigned int j, end = orig->GetNumUVChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mTextureCoords[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
-                        }
-                        if (j != end) {
-                            continue;
-                        }
-                    }
-                    {
-                        unsigned int j, end = orig->GetNumColorChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mColors[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
-                        }
-                        if (j != end) {
-                            continue;
-                        }
-                    }
-
-                    // These two checks are actually quite expensive and almost *never* required.
-                    // Almost. That's why they're still here. But there's no reason to do them
-                    // in speed-targeted imports.
-                    if (!configSpeedFlag) {
-
-                        // It seems to be strange, but we really need to check whether the
-                        // bones are identical too. Although it's extremely unprobable
-                        // that they're not if control reaches here, we need to deal
-                        // with unprobable cases, too. It could still be that there are
-                        // equal shapes which are deformed differently.
-                        if (!CompareBones(orig,inst))
-                            continue;
-
-                        // For completeness ... compare even the index buffers for equality
-                        // face order & winding order doesn't care. Input data is in verbose format.
-                        std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
-                        std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
-
-                        for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
-                            aiFace& f = orig->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
-                                ftbl_orig[f.mIndices[nn]] = tt;
-
-                            aiFace& f2 = inst->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
-                                ftbl_inst[f2.mIndices[nn]] = tt;
-                        }
-                        if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
-                            continue;
-                    }
+            const uint64_t hash = configContentHash ? GetMeshContentHash(inst, !configSpeedFlag) : GetMeshHash(inst);
+            std::vector<unsigned int>& candidates = buckets[hash];
+
+            // compare against the unique meshes with the same hash, most recent first
+            float epsilon = -1.f;
+            for (std::vector<unsigned int>::reverse_iterator it = candidates.rbegin(); it != candidates.rend(); ++it) {
+                if (IsInstance(pScene->mMeshes[*it], inst, epsilon)) {
 
                     // We're still here. Or in other words: 'inst' is an instance of 'orig'.
                     // Place a marker in our list that we can easily update mesh indices.
-                    remapping[i] = remapping[a];
+                    remapping[i] = remapping[*it];
 
                     // Delete the instanced mesh, we don't need it anymore
                     delete inst;
@@ -251,6 +378,7 @@ void FindInstancesProcess::Execute( aiScene* pScene)
             // If we didn't find a match for the current mesh: keep it
             if (pScene->mMeshes[i]) {
                 remapping[i] = numMeshesOut++;
+                candidates.push_back(i);
             }
         }
         ai_assert(0 != numMeshesOut);
@@ -269,7 +397,9 @@ void FindInstancesProcess::Execute( aiScene* pScene)
             if (!DefaultLogger::isNullLogger()) {
                 ASSIMP_LOG_INFO_F( "FindInstancesProcess finished. Found ", (pScene->mNumMeshes - numMeshesOut), " instances" );
             }
+            const unsigned int numMeshesIn = pScene->mNumMeshes;
             pScene->mNumMeshes = numMeshesOut;
+            UpdateMeshLODs(pScene,remapping.get(),numMeshesIn);
         } else {
             ASSIMP_LOG_DEBUG("FindInstancesProcess finished. No instanced meshes found");
         }
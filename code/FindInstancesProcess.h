@@ -74,6 +74,20 @@ uint64_t GetMeshHash(aiMesh* in) {
         (in->mPrimitiveTypes<<28)) & 0xffffffff );
 }
 
+// -------------------------------------------------------------------------------
+/** @brief Get a hash of the contents of a mesh.
+ *
+ *  In addition to the properties covered by GetMeshHash(), the hash covers
+ *  the exact values of all vertex streams (positions, normals, tangents,
+ *  bitangents, texture coordinates and colors). Optionally it also covers
+ *  the face topology and the bones, with the same granularity the
+ *  FindInstances step compares them. Negative and positive zero hash alike.
+ *  @param in Input mesh
+ *  @param withTopologyAndBones Include faces and bones
+ *  @return Hash.
+ */
+ASSIMP_API uint64_t GetMeshContentHash(const aiMesh* in, bool withTopologyAndBones);
+
 // -------------------------------------------------------------------------------
 /** @brief Perform a component-wise comparison of two arrays
  *
@@ -107,7 +121,7 @@ inline bool CompareArrays(const aiColor4D* first, const aiColor4D* second,
 // ---------------------------------------------------------------------------
 /** @brief A post-processing steps to search for instanced meshes
 */
-class FindInstancesProcess : public BaseProcess
+class ASSIMP_API FindInstancesProcess : public BaseProcess
 {
 public:
 
@@ -127,9 +141,17 @@ public:
     // Setup properties prior to executing the process
     void SetupProperties(const Importer* pImp);
 
+private:
+
+    // -------------------------------------------------------------------
+    // Check whether 'inst' is an instance of 'orig'. 'epsilon' is the squared
+    // position epsilon of 'inst', computed on the first call if it is negative.
+    bool IsInstance(const aiMesh* orig, const aiMesh* inst, float& epsilon) const;
+
 private:
 
     bool configSpeedFlag;
+    bool configContentHash;
 
 }; // ! end class FindInstancesProcess
 }  // ! end namespace Assimp
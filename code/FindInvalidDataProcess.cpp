@@ -158,6 +158,7 @@ void FindInvalidDataProcess::Execute( aiScene* pScene) {
             // to them from the scenegraph
             UpdateMeshReferences(pScene->mRootNode,meshMapping);
             pScene->mNumMeshes = real;
+            UpdateMeshLODs(pScene,&meshMapping[0],static_cast<unsigned int>(meshMapping.size()));
         }
 
         ASSIMP_LOG_INFO("FindInvalidDataProcess finished. Found issues ...");
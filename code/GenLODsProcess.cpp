@@ -0,0 +1,744 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to generate levels of detail.
+ */
+
+#include "GenLODsProcess.h"
+#include "ProcessHelper.h"
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
+#include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+
+using namespace Assimp;
+
+namespace {
+
+// default value of AI_CONFIG_PP_LOD_RATIOS, no levels are generated
+const char* const DefaultRatios = "";
+
+// weight of the planes keeping open edges in place, relative to the faces
+const double BorderWeight = 10.0;
+
+// ------------------------------------------------------------------------------------------------
+// Symmetric 4x4 error quadric of a set of planes
+struct Quadric
+{
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+
+    Quadric() : a2(), ab(), ac(), ad(), b2(), bc(), bd(), c2(), cd(), d2() {}
+
+    void AddPlane(double a, double b, double c, double d, double w) {
+        a2 += w * a * a; ab += w * a * b; ac += w * a * c; ad += w * a * d;
+        b2 += w * b * b; bc += w * b * c; bd += w * b * d;
+        c2 += w * c * c; cd += w * c * d;
+        d2 += w * d * d;
+    }
+
+    void Add(const Quadric& o) {
+        a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+        b2 += o.b2; bc += o.bc; bd += o.bd;
+        c2 += o.c2; cd += o.cd;
+        d2 += o.d2;
+    }
+
+    double Eval(const aiVector3D& p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+            + b2 * y * y + 2 * bc * y * z + 2 * bd * y
+            + c2 * z * z + 2 * cd * z + d2;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Unnormalized normal of a triangle, in double precision
+void TriangleNormal(const aiVector3D& p0, const aiVector3D& p1, const aiVector3D& p2, double* n)
+{
+    const double e1[3] = { double(p1.x) - p0.x, double(p1.y) - p0.y, double(p1.z) - p0.z };
+    const double e2[3] = { double(p2.x) - p0.x, double(p2.y) - p0.y, double(p2.z) - p0.z };
+    n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+inline uint64_t EdgeKey(unsigned int a, unsigned int b)
+{
+    return (uint64_t(a) << 32) | b;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Removes all triangles with repeated vertices from an index list
+void RemoveDegenerates(std::vector<unsigned int>& indices)
+{
+    size_t out = 0;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        const unsigned int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if (a != b && b != c && c != a) {
+            indices[out++] = a;
+            indices[out++] = b;
+            indices[out++] = c;
+        }
+    }
+    indices.resize(out);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Edge collapse simplifier working on the vertex indices of a mesh. Vertices
+// sharing a position form a group, the quadrics are kept per group so both
+// sides of an attribute seam see the same error.
+class MeshSimplifier
+{
+public:
+    MeshSimplifier(const aiMesh* pMesh, const std::vector<unsigned int>& indices);
+
+    // Collapses edges until the index list has at most targetTriangles
+    // triangles or no more edges can be collapsed
+    void Simplify(std::vector<unsigned int>& indices, size_t targetTriangles);
+
+private:
+    enum Kind { Unused, Manifold, Border, Seam, Locked };
+
+    struct Collapse {
+        double cost;
+        unsigned int v, t;   // v is collapsed onto t
+        unsigned int w, wt;  // seam counterpart, UINT_MAX if none
+        bool operator < (const Collapse& o) const {
+            return cost < o.cost || (cost == o.cost && v < o.v);
+        }
+    };
+
+    void BuildTopology(const std::vector<unsigned int>& indices);
+    bool Flips(const std::vector<unsigned int>& indices, unsigned int v, unsigned int t) const;
+    unsigned int CountShared(const std::vector<unsigned int>& indices, unsigned int v, unsigned int t) const;
+
+    const aiVector3D* positions;
+    unsigned int numVertices;
+
+    std::vector<unsigned int> group;       // position group of each vertex
+    std::vector<unsigned int> nextInGroup; // circular list of the group members
+    std::vector<Quadric> quadrics;         // per group
+
+    // per pass data
+    std::vector<unsigned int> triOffsets, triList; // vertex to triangle adjacency
+    std::vector<unsigned char> kind;
+    std::vector<unsigned int> openTo, openFrom;    // open edges of border and seam vertices
+    std::vector<unsigned int> liveSibling;         // other live member of a seam group
+    std::vector<unsigned int> groupLive;           // live members per group
+};
+
+// ------------------------------------------------------------------------------------------------
+MeshSimplifier::MeshSimplifier(const aiMesh* pMesh, const std::vector<unsigned int>& indices)
+: positions(pMesh->mVertices)
+, numVertices(pMesh->mNumVertices)
+, group(numVertices)
+, nextInGroup(numVertices)
+{
+    // group the vertices by their exact position
+    std::vector<unsigned int> order(numVertices);
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b) {
+        const aiVector3D& pa = positions[a];
+        const aiVector3D& pb = positions[b];
+        return pa.x < pb.x || (pa.x == pb.x && (pa.y < pb.y || (pa.y == pb.y && (pa.z < pb.z || (pa.z == pb.z && a < b)))));
+    });
+    unsigned int numGroups = 0;
+    for (unsigned int i = 0; i < numVertices;) {
+        unsigned int end = i + 1;
+        while (end < numVertices && positions[order[end]] == positions[order[i]]) {
+            ++end;
+        }
+        for (unsigned int k = i; k < end; ++k) {
+            group[order[k]] = numGroups;
+            nextInGroup[order[k]] = order[k + 1 < end ? k + 1 : i];
+        }
+        ++numGroups;
+        i = end;
+    }
+    quadrics.resize(numGroups);
+
+    // face planes, weighted by the triangle area
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        double n[3];
+        const aiVector3D& p0 = positions[indices[i]];
+        TriangleNormal(p0, positions[indices[i + 1]], positions[indices[i + 2]], n);
+        const double len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (len <= 0) {
+            continue;
+        }
+        const double a = n[0] / len, b = n[1] / len, c = n[2] / len;
+        const double d = -(a * p0.x + b * p0.y + c * p0.z);
+        for (unsigned int k = 0; k < 3; ++k) {
+            quadrics[group[indices[i + k]]].AddPlane(a, b, c, d, len * 0.5);
+        }
+    }
+
+    // planes perpendicular to the open edges keep borders and seams in place
+    std::vector<uint64_t> edges;
+    edges.reserve(indices.size());
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            edges.push_back(EdgeKey(indices[i + k], indices[i + (k + 1) % 3]));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        double n[3];
+        TriangleNormal(positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]], n);
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int a = indices[i + k], b = indices[i + (k + 1) % 3];
+            if (std::binary_search(edges.begin(), edges.end(), EdgeKey(b, a))) {
+                continue;
+            }
+            const aiVector3D& pa = positions[a];
+            const double e[3] = { double(positions[b].x) - pa.x, double(positions[b].y) - pa.y, double(positions[b].z) - pa.z };
+            double m[3] = { e[1] * n[2] - e[2] * n[1], e[2] * n[0] - e[0] * n[2], e[0] * n[1] - e[1] * n[0] };
+            const double len = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+            if (len <= 0) {
+                continue;
+            }
+            m[0] /= len; m[1] /= len; m[2] /= len;
+            const double d = -(m[0] * pa.x + m[1] * pa.y + m[2] * pa.z);
+            const double w = BorderWeight * (e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+            quadrics[group[a]].AddPlane(m[0], m[1], m[2], d, w);
+            quadrics[group[b]].AddPlane(m[0], m[1], m[2], d, w);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Classifies all vertices used by the current index list
+void MeshSimplifier::BuildTopology(const std::vector<unsigned int>& indices)
+{
+    const unsigned int numTris = static_cast<unsigned int>(indices.size() / 3);
+
+    triOffsets.assign(numVertices + 1, 0);
+    for (unsigned int idx : indices) {
+        ++triOffsets[idx + 1];
+    }
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        triOffsets[i + 1] += triOffsets[i];
+    }
+    triList.resize(indices.size());
+    std::vector<unsigned int> fill(triOffsets.begin(), triOffsets.end() - 1);
+    for (unsigned int i = 0; i < numTris; ++i) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            triList[fill[indices[i * 3 + k]]++] = i;
+        }
+    }
+
+    // directed edges, per vertex and per position group
+    std::vector<uint64_t> edges, groupEdges;
+    edges.reserve(indices.size());
+    groupEdges.reserve(indices.size());
+    for (unsigned int i = 0; i < numTris; ++i) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int a = indices[i * 3 + k], b = indices[i * 3 + (k + 1) % 3];
+            edges.push_back(EdgeKey(a, b));
+            groupEdges.push_back(EdgeKey(group[a], group[b]));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    std::sort(groupEdges.begin(), groupEdges.end());
+
+    std::vector<unsigned int> openOut(numVertices, 0), openIn(numVertices, 0);
+    std::vector<unsigned int> groupOpen(quadrics.size(), 0);
+    std::vector<unsigned char> nonManifold(numVertices, 0);
+    std::vector<unsigned char> groupNonManifold(quadrics.size(), 0);
+    openTo.assign(numVertices, UINT_MAX);
+    openFrom.assign(numVertices, UINT_MAX);
+
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const unsigned int a = static_cast<unsigned int>(edges[i] >> 32), b = static_cast<unsigned int>(edges[i]);
+        if (i + 1 < edges.size() && edges[i + 1] == edges[i]) {
+            nonManifold[a] = nonManifold[b] = 1;
+            continue;
+        }
+        if (!std::binary_search(edges.begin(), edges.end(), EdgeKey(b, a))) {
+            ++openOut[a];
+            ++openIn[b];
+            openTo[a] = b;
+            openFrom[b] = a;
+        }
+    }
+    for (size_t i = 0; i < groupEdges.size(); ++i) {
+        const unsigned int a = static_cast<unsigned int>(groupEdges[i] >> 32), b = static_cast<unsigned int>(groupEdges[i]);
+        if (i + 1 < groupEdges.size() && groupEdges[i + 1] == groupEdges[i]) {
+            groupNonManifold[a] = groupNonManifold[b] = 1;
+            continue;
+        }
+        if (!std::binary_search(groupEdges.begin(), groupEdges.end(), EdgeKey(b, a))) {
+            ++groupOpen[a];
+            ++groupOpen[b];
+        }
+    }
+
+    groupLive.assign(quadrics.size(), 0);
+    for (unsigned int v = 0; v < numVertices; ++v) {
+        if (triOffsets[v + 1] > triOffsets[v]) {
+            ++groupLive[group[v]];
+        }
+    }
+
+    kind.assign(numVertices, Unused);
+    liveSibling.assign(numVertices, UINT_MAX);
+    for (unsigned int v = 0; v < numVertices; ++v) {
+        if (triOffsets[v + 1] == triOffsets[v]) {
+            continue;
+        }
+        const unsigned int g = group[v];
+        if (nonManifold[v] || groupNonManifold[g]) {
+            kind[v] = Locked;
+        }
+        else if (groupLive[g] == 1) {
+            if (!openOut[v] && !openIn[v]) {
+                kind[v] = Manifold;
+            }
+            else if (openOut[v] == 1 && openIn[v] == 1 && groupOpen[g] == 2) {
+                kind[v] = Border;
+            }
+            else kind[v] = Locked;
+        }
+        else if (groupLive[g] == 2 && !groupOpen[g] && openOut[v] == 1 && openIn[v] == 1) {
+            kind[v] = Seam;
+            for (unsigned int s = nextInGroup[v]; s != v; s = nextInGroup[s]) {
+                if (triOffsets[s + 1] > triOffsets[s]) {
+                    liveSibling[v] = s;
+                }
+            }
+        }
+        else kind[v] = Locked;
+    }
+
+    // a seam needs a seam on the other side as well
+    for (unsigned int v = 0; v < numVertices; ++v) {
+        if (kind[v] == Seam && kind[liveSibling[v]] != Seam) {
+            kind[v] = Locked;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether moving v onto t turns one of the remaining triangles of v over
+bool MeshSimplifier::Flips(const std::vector<unsigned int>& indices, unsigned int v, unsigned int t) const
+{
+    for (unsigned int i = triOffsets[v]; i < triOffsets[v + 1]; ++i) {
+        const unsigned int* tri = &indices[triList[i] * 3];
+        if (tri[0] == t || tri[1] == t || tri[2] == t) {
+            continue;
+        }
+        aiVector3D p[3];
+        double n0[3], n1[3];
+        for (unsigned int k = 0; k < 3; ++k) {
+            p[k] = positions[tri[k]];
+        }
+        TriangleNormal(p[0], p[1], p[2], n0);
+        for (unsigned int k = 0; k < 3; ++k) {
+            if (tri[k] == v) {
+                p[k] = positions[t];
+            }
+        }
+        TriangleNormal(p[0], p[1], p[2], n1);
+        const double l0 = std::sqrt(n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2]);
+        const double l1 = std::sqrt(n1[0] * n1[0] + n1[1] * n1[1] + n1[2] * n1[2]);
+        if (l0 > 0 && n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0.25 * l0 * l1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Number of triangles using both v and t
+unsigned int MeshSimplifier::CountShared(const std::vector<unsigned int>& indices, unsigned int v, unsigned int t) const
+{
+    unsigned int count = 0;
+    for (unsigned int i = triOffsets[v]; i < triOffsets[v + 1]; ++i) {
+        const unsigned int* tri = &indices[triList[i] * 3];
+        if (tri[0] == t || tri[1] == t || tri[2] == t) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::Simplify(std::vector<unsigned int>& indices, size_t targetTriangles)
+{
+    RemoveDegenerates(indices);
+
+    std::vector<unsigned int> remap(numVertices);
+    std::vector<unsigned char> touched(numVertices);
+    std::vector<Collapse> collapses;
+
+    while (indices.size() / 3 > targetTriangles) {
+        BuildTopology(indices);
+
+        // pick the cheapest collapse of each vertex
+        collapses.clear();
+        for (unsigned int v = 0; v < numVertices; ++v) {
+            if (kind[v] == Unused || kind[v] == Locked) {
+                continue;
+            }
+            const Quadric& qv = quadrics[group[v]];
+            Collapse best;
+            best.cost = -1;
+            best.v = v;
+            best.w = best.wt = UINT_MAX;
+
+            auto consider = [&](unsigned int t, unsigned int w, unsigned int wt) {
+                if (group[t] == group[v]) {
+                    return;
+                }
+                const double cost = qv.Eval(positions[t]) + quadrics[group[t]].Eval(positions[t]);
+                if (best.cost < 0 || cost < best.cost) {
+                    best.cost = cost;
+                    best.t = t;
+                    best.w = w;
+                    best.wt = wt;
+                }
+            };
+
+            if (kind[v] == Manifold) {
+                for (unsigned int i = triOffsets[v]; i < triOffsets[v + 1]; ++i) {
+                    const unsigned int* tri = &indices[triList[i] * 3];
+                    for (unsigned int k = 0; k < 3; ++k) {
+                        if (tri[k] != v) {
+                            consider(tri[k], UINT_MAX, UINT_MAX);
+                        }
+                    }
+                }
+            }
+            else if (kind[v] == Border) {
+                consider(openTo[v], UINT_MAX, UINT_MAX);
+                consider(openFrom[v], UINT_MAX, UINT_MAX);
+            }
+            else {
+                // the counterpart moves along the other side of the seam
+                const unsigned int w = liveSibling[v];
+                for (unsigned int t : { openTo[v], openFrom[v] }) {
+                    unsigned int wt = UINT_MAX;
+                    if (groupLive[group[t]] == 1) {
+                        wt = t;
+                    }
+                    else if (groupLive[group[t]] == 2) {
+                        for (unsigned int s = nextInGroup[t]; s != t; s = nextInGroup[s]) {
+                            if (triOffsets[s + 1] > triOffsets[s]) {
+                                wt = s;
+                            }
+                        }
+                    }
+                    if (wt != UINT_MAX && (openTo[w] == wt || openFrom[w] == wt)) {
+                        consider(t, w, wt);
+                    }
+                }
+            }
+            if (best.cost >= 0) {
+                collapses.push_back(best);
+            }
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        // apply the cheapest third in one go, keeping the collapses apart
+        // so the adjacency stays valid for the checks
+        for (unsigned int v = 0; v < numVertices; ++v) {
+            remap[v] = v;
+        }
+        std::fill(touched.begin(), touched.end(), 0);
+        auto touch = [&](unsigned int v) {
+            for (unsigned int i = triOffsets[v]; i < triOffsets[v + 1]; ++i) {
+                const unsigned int* tri = &indices[triList[i] * 3];
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+            }
+        };
+
+        size_t numTriangles = indices.size() / 3;
+        const size_t limit = std::max<size_t>(1, collapses.size() / 3);
+        unsigned int numCollapsed = 0;
+        for (size_t i = 0; i < limit && i < collapses.size() && numTriangles > targetTriangles; ++i) {
+            const Collapse& c = collapses[i];
+            const bool seam = c.w != UINT_MAX;
+            if (touched[c.v] || touched[c.t] || (seam && (touched[c.w] || touched[c.wt]))) {
+                continue;
+            }
+            if (Flips(indices, c.v, c.t) || (seam && Flips(indices, c.w, c.wt))) {
+                continue;
+            }
+
+            remap[c.v] = c.t;
+            numTriangles -= CountShared(indices, c.v, c.t);
+            touch(c.v);
+            touch(c.t);
+            if (seam) {
+                remap[c.w] = c.wt;
+                numTriangles -= CountShared(indices, c.w, c.wt);
+                touch(c.w);
+                touch(c.wt);
+            }
+            quadrics[group[c.t]].Add(quadrics[group[c.v]]);
+            ++numCollapsed;
+        }
+        if (!numCollapsed) {
+            break;
+        }
+
+        for (unsigned int& idx : indices) {
+            idx = remap[idx];
+        }
+        RemoveDegenerates(indices);
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+GenLODsProcess::GenLODsProcess()
+{
+    // nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Destructor, private as well
+GenLODsProcess::~GenLODsProcess()
+{
+    // nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool GenLODsProcess::IsActive( unsigned int /*pFlags*/) const
+{
+    // there is no flag, see IsRequested()
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether levels of detail have been requested through AI_CONFIG_PP_LOD_RATIOS
+bool GenLODsProcess::IsRequested( const Importer* pImp) const
+{
+    const std::string list = pImp->GetPropertyString(AI_CONFIG_PP_LOD_RATIOS, DefaultRatios);
+    return list.find_first_not_of(" \t\r\n") != std::string::npos;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void GenLODsProcess::SetupProperties(const Importer* pImp)
+{
+    const std::string list = pImp->GetPropertyString(AI_CONFIG_PP_LOD_RATIOS, DefaultRatios);
+
+    std::vector<float> ratios;
+    const char* sz = list.c_str();
+    while (SkipSpaces(&sz)) {
+        float ratio = 0.f;
+        const char* next = fast_atoreal_move<float>(sz, ratio);
+        if (next == sz) {
+            ASSIMP_LOG_WARN_F("GenLODsProcess: ignoring invalid level ratio list \"", list, "\"");
+            ratios.clear();
+            break;
+        }
+        ratios.push_back(ratio);
+        sz = next;
+    }
+    SetRatios(ratios);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::SetRatios( const std::vector<float>& ratios)
+{
+    configRatios.clear();
+    for (float ratio : ratios) {
+        if (ratio > 0.f && ratio < 1.f) {
+            configRatios.push_back(ratio);
+        }
+    }
+    std::sort(configRatios.begin(), configRatios.end(), std::greater<float>());
+    configRatios.erase(std::unique(configRatios.begin(), configRatios.end()), configRatios.end());
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void GenLODsProcess::Execute( aiScene* pScene)
+{
+    if (configRatios.empty()) {
+        return;
+    }
+    ASSIMP_LOG_DEBUG("GenLODsProcess begin");
+
+    // don't simplify the levels of a previous run once more
+    std::vector<char> skip(pScene->mNumMeshes, 0);
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        const aiMesh* mesh = pScene->mMeshes[a];
+        for (unsigned int i = 0; i < mesh->mNumLODs; ++i) {
+            if (mesh->mLODs[i] < pScene->mNumMeshes) {
+                skip[mesh->mLODs[i]] = 1;
+            }
+        }
+    }
+
+    std::vector<std::vector<aiMesh*> > lods(pScene->mNumMeshes);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
+        if (!skip[a] && !pScene->mMeshes[a]->HasLODs()) {
+            ProcessMesh(pScene->mMeshes[a], lods[a]);
+        }
+    });
+
+    unsigned int numLODs = 0, numFaces = 0, numLODFaces = 0;
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        numLODs += static_cast<unsigned int>(lods[a].size());
+    }
+    if (!numLODs) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished. No levels of detail generated");
+        return;
+    }
+
+    // append the generated meshes to the scene
+    const unsigned int numMeshes = pScene->mNumMeshes;
+    aiMesh** meshes = new aiMesh*[numMeshes + numLODs];
+    std::copy(pScene->mMeshes, pScene->mMeshes + numMeshes, meshes);
+    delete[] pScene->mMeshes;
+    pScene->mMeshes = meshes;
+
+    for (unsigned int a = 0; a < numMeshes; ++a) {
+        if (lods[a].empty()) {
+            continue;
+        }
+        aiMesh* mesh = pScene->mMeshes[a];
+        mesh->mNumLODs = static_cast<unsigned int>(lods[a].size());
+        mesh->mLODs = new unsigned int[mesh->mNumLODs];
+        for (unsigned int i = 0; i < mesh->mNumLODs; ++i) {
+            mesh->mLODs[i] = pScene->mNumMeshes;
+            pScene->mMeshes[pScene->mNumMeshes++] = lods[a][i];
+        }
+        numFaces += mesh->mNumFaces;
+        numLODFaces += lods[a].back()->mNumFaces;
+    }
+    ASSIMP_LOG_INFO_F("GenLODsProcess finished. Generated ", numLODs, " levels of detail, coarsest levels have ",
+        numLODFaces, " of ", numFaces, " triangles");
+}
+
+// ------------------------------------------------------------------------------------------------
+// Generates the levels of detail of a specific mesh
+bool GenLODsProcess::ProcessMesh( aiMesh* pMesh, std::vector<aiMesh*>& lods) const
+{
+    ai_assert(nullptr != pMesh);
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || configRatios.empty()) {
+        return false;
+    }
+    if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess: skipping a mesh that is not made of triangles only");
+        return false;
+    }
+
+    std::vector<unsigned int> indices;
+    indices.reserve(pMesh->mNumFaces * 3);
+    for (unsigned int i = 0; i < pMesh->mNumFaces; ++i) {
+        const aiFace& face = pMesh->mFaces[i];
+        if (face.mNumIndices != 3) {
+            return false;
+        }
+        indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+    }
+
+    MeshSimplifier simplifier(pMesh, indices);
+
+    // each level continues from the previous one
+    std::vector<std::vector<unsigned int> > levels;
+    size_t numTriangles = pMesh->mNumFaces;
+    for (float ratio : configRatios) {
+        const size_t target = std::max<size_t>(1, static_cast<size_t>(pMesh->mNumFaces * ratio));
+        simplifier.Simplify(indices, target);
+        if (indices.empty() || indices.size() / 3 >= numTriangles) {
+            break;
+        }
+        numTriangles = indices.size() / 3;
+        levels.push_back(indices);
+    }
+
+    // build the meshes by temporarily swapping in the simplified faces
+    struct FaceSwap {
+        aiMesh* mesh;
+        aiFace* faces;
+        unsigned int numFaces;
+        ~FaceSwap() {
+            delete[] mesh->mFaces;
+            mesh->mFaces = faces;
+            mesh->mNumFaces = numFaces;
+        }
+    };
+    for (size_t k = 0; k < levels.size(); ++k) {
+        const std::vector<unsigned int>& level = levels[k];
+        std::vector<unsigned int> faces(level.size() / 3);
+        for (unsigned int i = 0; i < faces.size(); ++i) {
+            faces[i] = i;
+        }
+
+        aiMesh* lod = nullptr;
+        {
+            FaceSwap swap = { pMesh, pMesh->mFaces, pMesh->mNumFaces };
+            pMesh->mFaces = nullptr;
+            pMesh->mFaces = new aiFace[faces.size()];
+            pMesh->mNumFaces = static_cast<unsigned int>(faces.size());
+            for (unsigned int i = 0; i < faces.size(); ++i) {
+                aiFace& face = pMesh->mFaces[i];
+                face.mNumIndices = 3;
+                face.mIndices = new unsigned int[3];
+                std::copy(&level[i * 3], &level[i * 3] + 3, face.mIndices);
+            }
+            lod = MakeSubmesh(pMesh, faces, 0);
+        }
+        char suffix[16];
+        ai_snprintf(suffix, sizeof(suffix), "_LOD%u", static_cast<unsigned int>(k + 1));
+        lod->mName.Set(std::string(pMesh->mName.C_Str()) + suffix);
+        lods.push_back(lod);
+    }
+    return true;
+}
@@ -0,0 +1,116 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Defines a post processing step to generate levels of detail */
+#ifndef AI_GENLODSPROCESS_H_INC
+#define AI_GENLODSPROCESS_H_INC
+
+#include "BaseProcess.h"
+#include <assimp/types.h>
+#include <vector>
+
+struct aiMesh;
+
+namespace Assimp
+{
+
+// ---------------------------------------------------------------------------
+/** The GenLODsProcess generates a chain of simplified copies of each mesh.
+ *  Edges are collapsed in the order of their quadric error, always onto one
+ *  of their existing vertices. Open borders may only be shortened along
+ *  themselves, vertices on attribute seams are collapsed together with their
+ *  counterpart on the other side of the seam, all other non-manifold
+ *  vertices are left alone. The generated meshes are appended to the scene
+ *  and linked from aiMesh::mLODs. There is no post processing flag, the
+ *  step runs whenever #AI_CONFIG_PP_LOD_RATIOS is set.
+ *
+ *  @note This step expects triangulated input data. Animation meshes are
+ *  not carried over to the generated levels.
+ */
+class ASSIMP_API GenLODsProcess : public BaseProcess
+{
+public:
+
+    GenLODsProcess();
+    ~GenLODsProcess();
+
+public:
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is active
+    bool IsActive( unsigned int pFlags) const;
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is enabled by the importer's properties
+    bool IsRequested( const Importer* pImp) const;
+
+    // -------------------------------------------------------------------
+    // Executes the pp step on a given scene
+    void Execute( aiScene* pScene);
+
+    // -------------------------------------------------------------------
+    // Configures the pp step
+    void SetupProperties(const Importer* pImp);
+
+    // -------------------------------------------------------------------
+    /** Generates the levels of detail of a single mesh.
+     * @param pMesh The mesh to simplify. It is left unchanged.
+     * @param lods Receives the generated meshes, from the finest to the
+     *   coarsest one. The caller takes ownership.
+     * @return false if the mesh doesn't consist of triangles only
+     */
+    bool ProcessMesh( aiMesh* pMesh, std::vector<aiMesh*>& lods) const;
+
+    // -------------------------------------------------------------------
+    /** Sets the target ratios of the generated levels, these are otherwise
+     *  configured by #AI_CONFIG_PP_LOD_RATIOS. Values outside (0, 1) are
+     *  ignored. */
+    void SetRatios( const std::vector<float>& ratios);
+
+private:
+    //! Configuration parameter: triangle ratios, sorted in descending order
+    std::vector<float> configRatios;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_GENLODSPROCESS_H_INC
@@ -0,0 +1,334 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to split meshes into meshlets.
+ */
+
+#include "GenMeshletsProcess.h"
+#include "VertexTriangleAdjacency.h"
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Number of vertices of a face that are not yet part of the current meshlet
+unsigned int CountNewVertices(const aiFace& face, const std::vector<unsigned int>& local)
+{
+    const unsigned int* idx = face.mIndices;
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < 3; ++i) {
+        if (local[idx[i]] == UINT_MAX && (i < 1 || idx[i] != idx[0]) && (i < 2 || idx[i] != idx[1])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compute the bounding sphere and the normal cone of a meshlet
+void ComputeMeshletBounds(const aiMesh* pMesh, aiMeshlet& meshlet,
+    const unsigned int* vertices, const unsigned char* indices)
+{
+    // the sphere is centered in the bounding box of the vertices
+    aiVector3D min = pMesh->mVertices[vertices[0]], max = min;
+    for (unsigned int i = 1; i < meshlet.mVertexCount; ++i) {
+        const aiVector3D& v = pMesh->mVertices[vertices[i]];
+        min.x = std::min(min.x, v.x); min.y = std::min(min.y, v.y); min.z = std::min(min.z, v.z);
+        max.x = std::max(max.x, v.x); max.y = std::max(max.y, v.y); max.z = std::max(max.z, v.z);
+    }
+    meshlet.mCenter = (min + max) * ai_real(0.5);
+    ai_real radius = 0;
+    for (unsigned int i = 0; i < meshlet.mVertexCount; ++i) {
+        radius = std::max(radius, (pMesh->mVertices[vertices[i]] - meshlet.mCenter).SquareLength());
+    }
+    meshlet.mRadius = std::sqrt(radius);
+
+    // the cone axis is the average normal of all non-degenerate triangles
+    std::vector<aiVector3D> normals(meshlet.mTriangleCount);
+    aiVector3D axis;
+    for (unsigned int t = 0; t < meshlet.mTriangleCount; ++t) {
+        const aiVector3D& p0 = pMesh->mVertices[vertices[indices[t * 3]]];
+        const aiVector3D& p1 = pMesh->mVertices[vertices[indices[t * 3 + 1]]];
+        const aiVector3D& p2 = pMesh->mVertices[vertices[indices[t * 3 + 2]]];
+        aiVector3D n = (p1 - p0) ^ (p2 - p0);
+        const ai_real len = n.Length();
+        normals[t] = len > 0 ? n / len : aiVector3D();
+        axis += normals[t];
+    }
+
+    meshlet.mConeApex = meshlet.mCenter;
+    meshlet.mConeAxis = aiVector3D();
+    meshlet.mConeCutoff = 1;
+    const ai_real len = axis.Length();
+    if (len <= 0) {
+        return;
+    }
+    axis /= len;
+
+    ai_real minCos = 1;
+    for (const aiVector3D& n : normals) {
+        if (n.SquareLength() > 0) {
+            minCos = std::min(minCos, axis * n);
+        }
+    }
+    meshlet.mConeAxis = axis;
+
+    // a cone close to a hemisphere is useless for culling and would put the
+    // apex far away, keep the cutoff at 1 then
+    if (minCos <= ai_real(0.1)) {
+        return;
+    }
+
+    // move the apex back along the axis until all triangles face away from it
+    ai_real maxT = 0;
+    for (unsigned int t = 0; t < meshlet.mTriangleCount; ++t) {
+        if (normals[t].SquareLength() > 0) {
+            const aiVector3D& p0 = pMesh->mVertices[vertices[indices[t * 3]]];
+            maxT = std::max(maxT, ((meshlet.mCenter - p0) * normals[t]) / (axis * normals[t]));
+        }
+    }
+    meshlet.mConeApex = meshlet.mCenter - axis * maxT;
+    meshlet.mConeCutoff = std::sqrt(1 - minCos * minCos);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+GenMeshletsProcess::GenMeshletsProcess()
+: configMaxVertices(AI_GM_DEFAULT_MAX_VERTICES)
+, configMaxTriangles(AI_GM_DEFAULT_MAX_TRIANGLES) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Destructor, private as well
+GenMeshletsProcess::~GenMeshletsProcess()
+{
+    // nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool GenMeshletsProcess::IsActive( unsigned int pFlags) const
+{
+    return (pFlags & aiProcess_GenMeshlets) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void GenMeshletsProcess::SetupProperties(const Importer* pImp)
+{
+    SetLimits(pImp->GetPropertyInteger(AI_CONFIG_PP_GM_VERTEX_LIMIT, AI_GM_DEFAULT_MAX_VERTICES),
+        pImp->GetPropertyInteger(AI_CONFIG_PP_GM_TRIANGLE_LIMIT, AI_GM_DEFAULT_MAX_TRIANGLES));
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::SetLimits( unsigned int maxVertices, unsigned int maxTriangles)
+{
+    // the local indices of the meshlet triangles are 8 bit
+    configMaxVertices = std::min(std::max(maxVertices, 3u), 256u);
+    configMaxTriangles = std::max(maxTriangles, 1u);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void GenMeshletsProcess::Execute( aiScene* pScene)
+{
+    ASSIMP_LOG_DEBUG("GenMeshletsProcess begin");
+
+    std::vector<char> processed(pScene->mNumMeshes, 0);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
+        processed[a] = ProcessMesh(pScene->mMeshes[a]);
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        unsigned int numMeshes = 0, numMeshlets = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (processed[a]) {
+                ++numMeshes;
+                numMeshlets += pScene->mMeshes[a]->mNumMeshlets;
+            }
+        }
+        ASSIMP_LOG_INFO_F("GenMeshletsProcess finished. Split ", numMeshes, " meshes into ", numMeshlets, " meshlets");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Splits a specific mesh into meshlets
+bool GenMeshletsProcess::ProcessMesh( aiMesh* pMesh) const
+{
+    ai_assert(nullptr != pMesh);
+
+    // drop meshlets of a previous run, they don't match the faces anymore
+    delete[] pMesh->mMeshlets;
+    delete[] pMesh->mMeshletVertices;
+    delete[] pMesh->mMeshletIndices;
+    pMesh->mMeshlets = nullptr;
+    pMesh->mMeshletVertices = nullptr;
+    pMesh->mMeshletIndices = nullptr;
+    pMesh->mNumMeshlets = pMesh->mNumMeshletVertices = pMesh->mNumMeshletIndices = 0;
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions()) {
+        return false;
+    }
+    if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_DEBUG("GenMeshletsProcess: skipping a mesh that is not made of triangles only");
+        return false;
+    }
+
+    const unsigned int numFaces = pMesh->mNumFaces;
+    VertexTriangleAdjacency adj(pMesh->mFaces, numFaces, pMesh->mNumVertices, true);
+    unsigned int* const live = adj.mLiveTriangles;
+    const std::vector<unsigned int> numAdjacent(live, live + pMesh->mNumVertices);
+
+    std::vector<aiMeshlet> meshlets;
+    std::vector<unsigned int> vertices;
+    std::vector<unsigned char> indices;
+    vertices.reserve(pMesh->mNumVertices);
+    indices.reserve(numFaces * 3);
+
+    // local index of each vertex in the current meshlet
+    std::vector<unsigned int> local(pMesh->mNumVertices, UINT_MAX);
+    std::vector<bool> emitted(numFaces, false);
+
+    // triangles adjacent to the current meshlet, marked with the meshlet they were queued for
+    std::vector<unsigned int> candidates;
+    std::vector<unsigned int> queued(numFaces, UINT_MAX);
+    unsigned int cursor = 0;
+
+    aiMeshlet current;
+    for (unsigned int n = 0; n < numFaces; ++n) {
+
+        // pick the adjacent triangle needing the fewest new vertices, prefer
+        // triangles with few remaining neighbours to avoid leaving islands
+        unsigned int best = UINT_MAX, bestNew = 4, bestLive = UINT_MAX;
+        size_t kept = 0;
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            const unsigned int f = candidates[c];
+            if (emitted[f]) {
+                continue;
+            }
+            candidates[kept++] = f;
+
+            const aiFace& face = pMesh->mFaces[f];
+            const unsigned int numNew = CountNewVertices(face, local);
+            const unsigned int numLive = live[face.mIndices[0]] + live[face.mIndices[1]] + live[face.mIndices[2]];
+            if (numNew < bestNew || (numNew == bestNew && numLive < bestLive)) {
+                best = f;
+                bestNew = numNew;
+                bestLive = numLive;
+            }
+        }
+        candidates.resize(kept);
+
+        // no neighbours left, continue with the next triangle in input order
+        if (best == UINT_MAX) {
+            while (emitted[cursor]) {
+                ++cursor;
+            }
+            best = cursor;
+            bestNew = CountNewVertices(pMesh->mFaces[best], local);
+        }
+
+        // start a new meshlet if the triangle doesn't fit anymore
+        if (current.mVertexCount + bestNew > configMaxVertices || current.mTriangleCount == configMaxTriangles) {
+            meshlets.push_back(current);
+            for (unsigned int i = current.mVertexOffset; i < vertices.size(); ++i) {
+                local[vertices[i]] = UINT_MAX;
+            }
+            current = aiMeshlet();
+            current.mVertexOffset = static_cast<unsigned int>(vertices.size());
+            current.mTriangleOffset = static_cast<unsigned int>(indices.size());
+            candidates.clear();
+        }
+
+        const aiFace& face = pMesh->mFaces[best];
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int v = face.mIndices[i];
+            if (local[v] == UINT_MAX) {
+                local[v] = current.mVertexCount++;
+                vertices.push_back(v);
+
+                const unsigned int* adjacent = adj.GetAdjacentTriangles(v);
+                for (unsigned int t = 0; t < numAdjacent[v]; ++t) {
+                    const unsigned int f = adjacent[t];
+                    if (!emitted[f] && queued[f] != meshlets.size()) {
+                        queued[f] = static_cast<unsigned int>(meshlets.size());
+                        candidates.push_back(f);
+                    }
+                }
+            }
+            indices.push_back(static_cast<unsigned char>(local[v]));
+            --live[v];
+        }
+        emitted[best] = true;
+        ++current.mTriangleCount;
+    }
+    meshlets.push_back(current);
+
+    for (aiMeshlet& meshlet : meshlets) {
+        ComputeMeshletBounds(pMesh, meshlet, &vertices[meshlet.mVertexOffset], &indices[meshlet.mTriangleOffset]);
+    }
+
+    pMesh->mNumMeshlets = static_cast<unsigned int>(meshlets.size());
+    pMesh->mMeshlets = new aiMeshlet[pMesh->mNumMeshlets];
+    std::copy(meshlets.begin(), meshlets.end(), pMesh->mMeshlets);
+
+    pMesh->mNumMeshletVertices = static_cast<unsigned int>(vertices.size());
+    pMesh->mMeshletVertices = new unsigned int[pMesh->mNumMeshletVertices];
+    std::copy(vertices.begin(), vertices.end(), pMesh->mMeshletVertices);
+
+    pMesh->mNumMeshletIndices = static_cast<unsigned int>(indices.size());
+    pMesh->mMeshletIndices = new unsigned char[pMesh->mNumMeshletIndices];
+    std::copy(indices.begin(), indices.end(), pMesh->mMeshletIndices);
+    return true;
+}
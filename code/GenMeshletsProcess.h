@@ -0,0 +1,107 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Defines a post processing step to split meshes into meshlets */
+#ifndef AI_GENMESHLETSPROCESS_H_INC
+#define AI_GENMESHLETSPROCESS_H_INC
+
+#include "BaseProcess.h"
+#include <assimp/types.h>
+
+struct aiMesh;
+
+namespace Assimp
+{
+
+// ---------------------------------------------------------------------------
+/** The GenMeshletsProcess splits the triangles of each mesh into meshlets of
+ *  a limited number of vertices and triangles. A meshlet is grown from a
+ *  seed triangle by adding the adjacent triangle that needs the fewest new
+ *  vertices until one of the limits is reached. Bounding spheres and normal
+ *  cones are computed for all meshlets.
+ *
+ *  @note This step expects triangulated input data.
+ */
+class ASSIMP_API GenMeshletsProcess : public BaseProcess
+{
+public:
+
+    GenMeshletsProcess();
+    ~GenMeshletsProcess();
+
+public:
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is active
+    bool IsActive( unsigned int pFlags) const;
+
+    // -------------------------------------------------------------------
+    // Executes the pp step on a given scene
+    void Execute( aiScene* pScene);
+
+    // -------------------------------------------------------------------
+    // Configures the pp step
+    void SetupProperties(const Importer* pImp);
+
+    // -------------------------------------------------------------------
+    /** Splits a single mesh into meshlets, replacing existing ones.
+     * @param pMesh The mesh to process.
+     * @return false if the mesh doesn't consist of triangles only
+     */
+    bool ProcessMesh( aiMesh* pMesh) const;
+
+    // -------------------------------------------------------------------
+    /** Sets the meshlet limits, these are otherwise configured by
+     *  #AI_CONFIG_PP_GM_VERTEX_LIMIT and #AI_CONFIG_PP_GM_TRIANGLE_LIMIT */
+    void SetLimits( unsigned int maxVertices, unsigned int maxTriangles);
+
+private:
+    //! Configuration parameter: maximum number of vertices per meshlet
+    unsigned int configMaxVertices;
+
+    //! Configuration parameter: maximum number of triangles per meshlet
+    unsigned int configMaxTriangles;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_GENMESHLETSPROCESS_H_INC
@@ -52,13 +52,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProcessHelper.h"
 #include <assimp/Exceptional.h>
 #include <assimp/qnan.h>
+#include <atomic>
 
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 GenVertexNormalsProcess::GenVertexNormalsProcess()
-: configMaxAngle( AI_DEG_TO_RAD( 175.f ) ) {
+: configMaxAngle( AI_DEG_TO_RAD( 175.f ) )
+, configSpatialSortBackend( SpatialSort::Backend_PlaneSort ) {
     // empty
 }
 
@@ -83,6 +85,8 @@ void GenVertexNormalsProcess::SetupProperties(const Importer* pImp)
     // Get the current value of the AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE property
     configMaxAngle = pImp->GetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE,(ai_real)175.0);
     configMaxAngle = AI_DEG_TO_RAD(std::max(std::min(configMaxAngle,(ai_real)175.0),(ai_real)0.0));
+
+    configSpatialSortBackend = GetSpatialSortBackend(pImp);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -95,11 +99,11 @@ void GenVertexNormalsProcess::Execute( aiScene* pScene)
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+    std::atomic<bool> bHas(false);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
         if(GenMeshVertexNormals( pScene->mMeshes[a],a))
             bHas = true;
-    }
+    });
 
     if (bHas)   {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
@@ -172,6 +176,7 @@ bool GenVertexNormalsProcess::GenMeshVertexNormals (aiMesh* pMesh, unsigned int
         }
     }
     if (!vertexFinder)  {
+        _vertexFinder.SetBackend(configSpatialSortBackend);
         _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
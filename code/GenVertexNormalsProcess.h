@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include <assimp/mesh.h>
+#include <assimp/SpatialSort.h>
 
 class GenNormalsTest;
 
@@ -107,6 +108,8 @@ private:
 
     /** Configuration option: maximum smoothing angle, in radians*/
     ai_real configMaxAngle;
+    /** Configuration option: SpatialSort backend if no shared one is available */
+    SpatialSort::Backend configSpatialSortBackend;
     mutable bool force_ = false;
 };
 
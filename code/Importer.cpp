@@ -73,6 +73,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProcessHelper.h"
 #include "ScenePreprocessor.h"
 #include "ScenePrivate.h"
+#include "SceneArena.h"
+#include "ThreadPool.h"
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/Profiler.h>
 #include <assimp/TinyFormatter.h>
@@ -81,9 +83,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 #include <memory>
 #include <cctype>
+#include <chrono>
 
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/IndexBuffer.h>
+#include <assimp/PackedVertices.h>
 
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
 #   include "ValidateDataStructure.h"
@@ -104,6 +109,112 @@ namespace Assimp {
 using namespace Assimp;
 using namespace Assimp::Intern;
 
+// ------------------------------------------------------------------------------------------------
+// (Re-)creates the worker pool for the post-processing steps as configured by the user.
+static void SetupPostProcessingThreadPool(ImporterPimpl* pimpl, int requested) {
+    const unsigned int numThreads = ThreadPool::ResolveThreadCount(requested);
+    if (numThreads <= 1) {
+        delete pimpl->mThreadPool;
+        pimpl->mThreadPool = nullptr;
+        return;
+    }
+
+    if (nullptr == pimpl->mThreadPool || pimpl->mThreadPool->GetNumThreads() != numThreads) {
+        delete pimpl->mThreadPool;
+        pimpl->mThreadPool = new ThreadPool(numThreads);
+        ASSIMP_LOG_DEBUG_F("Post-processing uses ", pimpl->mThreadPool->GetNumThreads(), " threads");
+    }
+}
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Records the statistics of the import phases and post-processing steps into the
+// ImporterPimpl. Does nothing unless AI_CONFIG_GLOB_MEASURE_TIME is set.
+class StepStatisticsRecorder {
+public:
+    explicit StepStatisticsRecorder(Importer* importer)
+    : mImporter(importer)
+    , mEnabled(0 != importer->GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0))
+    , mCurrent()
+    , mStart() {
+        // empty
+    }
+
+    void Begin(const char* name) {
+        if (!mEnabled) {
+            return;
+        }
+        mCurrent = aiImportStepStatistics();
+        mCurrent.mName.Set(name);
+        CaptureScene(mCurrent.mNumMeshesIn, mCurrent.mNumVerticesIn, mCurrent.mBytesIn);
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    void End() {
+        if (!mEnabled) {
+            return;
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStart;
+        mCurrent.mSeconds = elapsed.count();
+        CaptureScene(mCurrent.mNumMeshesOut, mCurrent.mNumVerticesOut, mCurrent.mBytesOut);
+
+        ImporterPimpl* pimpl = mImporter->Pimpl();
+        pimpl->mStepStatistics.push_back(mCurrent);
+        pimpl->mImportStatistics.mTotalSeconds += mCurrent.mSeconds;
+        pimpl->mImportStatistics.mNumSteps = static_cast<unsigned int>(pimpl->mStepStatistics.size());
+        pimpl->mImportStatistics.mSteps = &pimpl->mStepStatistics[0];
+    }
+
+private:
+    void CaptureScene(unsigned int& meshes, unsigned int& vertices, unsigned int& bytes) const {
+        const aiScene* scene = mImporter->GetScene();
+        meshes = vertices = bytes = 0;
+        if (!scene) {
+            return;
+        }
+        meshes = scene->mNumMeshes;
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            vertices += scene->mMeshes[i]->mNumVertices;
+        }
+        aiMemoryInfo mem;
+        mImporter->GetMemoryRequirements(mem);
+        bytes = mem.total;
+    }
+
+    Importer* mImporter;
+    const bool mEnabled;
+    aiImportStepStatistics mCurrent;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Converts a final scene to the storage layouts requested through the GLOB_ properties
+void ApplyStorageOptions(const Importer* importer, aiScene* scene) {
+    const int indexBits = importer->GetPropertyInteger(AI_CONFIG_GLOB_INDEX_BUFFER, 0);
+    if (indexBits) {
+        BuildIndexBuffers(scene, indexBits == 16 ? 2 : 4);
+    }
+    const int packedStreams = importer->GetPropertyInteger(AI_CONFIG_GLOB_PACK_VERTICES, 0);
+    if (packedStreams) {
+        BuildPackedVertices(scene, static_cast<unsigned int>(packedStreams));
+    }
+    if (importer->GetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, false)) {
+        MoveSceneToArena(scene);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Restores the classic layout. The post-processing steps rely on aiMesh::mFaces and free and
+// replace arrays, which they can't do with arena storage.
+void RevertStorageOptions(aiScene* scene) {
+    MoveSceneFromArena(scene);
+    ExpandIndexBuffers(scene);
+    ExpandPackedVertices(scene);
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Intern::AllocateFromAssimpHeap serves as abstract base class. It overrides
 // new and delete (and their array counterparts) of public API classes (e.g. Logger) to
@@ -193,6 +304,9 @@ Importer::~Importer()
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Join the post-processing workers
+    delete pimpl->mThreadPool;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -583,6 +697,11 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
             return NULL;
         }
 
+        // statistics are reset by each import
+        pimpl->mStepStatistics.clear();
+        pimpl->mImportStatistics = aiImportStatistics();
+        StepStatisticsRecorder statistics(this);
+
         std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler():NULL);
         if (profiler) {
             profiler->BeginRegion("total");
@@ -639,10 +758,12 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
         if (profiler) {
             profiler->BeginRegion("import");
         }
+        statistics.Begin("import");
 
         pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
         pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
 
+        statistics.End();
         if (profiler) {
             profiler->EndRegion("import");
         }
@@ -656,8 +777,10 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
             // The ValidateDS process is an exception. It is executed first, even before ScenePreprocessor is called.
             if (pFlags & aiProcess_ValidateDataStructure)
             {
+                statistics.Begin("validate");
                 ValidateDSProcess ds;
                 ds.ExecuteOnScene (this);
+                statistics.End();
                 if (!pimpl->mScene) {
                     return NULL;
                 }
@@ -668,16 +791,23 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
             if (profiler) {
                 profiler->BeginRegion("preprocess");
             }
+            statistics.Begin("preprocess");
 
             ScenePreprocessor pre(pimpl->mScene);
             pre.ProcessScene();
 
+            statistics.End();
             if (profiler) {
                 profiler->EndRegion("preprocess");
             }
 
             // Ensure that the validation process won't be called twice
             ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+
+            // This is a no-op if the post-processing pipeline did it already
+            if (pimpl->mScene) {
+                ApplyStorageOptions(this, pimpl->mScene);
+            }
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -722,22 +852,35 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
         return NULL;
     }
 
-    // If no flags are given, return the current scene with no further action
+    // If no flags are given and no step is enabled by the properties, return the current
+    // scene with no further action
     if (!pFlags) {
-        return pimpl->mScene;
+        bool requested = false;
+        for (unsigned int a = 0; a < pimpl->mPostProcessingSteps.size() && !requested; a++) {
+            requested = pimpl->mPostProcessingSteps[a]->IsRequested(this);
+        }
+        if (!requested) {
+            return pimpl->mScene;
+        }
     }
 
     // In debug builds: run basic flag validation
     ai_assert(_ValidateFlags(pFlags));
     ASSIMP_LOG_INFO("Entering post processing pipeline");
 
+    StepStatisticsRecorder statistics(this);
+
+    RevertStorageOptions(pimpl->mScene);
+
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
     // The ValidateDS process plays an exceptional role. It isn't contained in the global
     // list of post-processing steps, so we need to call it manually.
     if (pFlags & aiProcess_ValidateDataStructure)
     {
+        statistics.Begin("validate");
         ValidateDSProcess ds;
         ds.ExecuteOnScene (this);
+        statistics.End();
         if (!pimpl->mScene) {
             return NULL;
         }
@@ -757,21 +900,26 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
     }
 #endif // ! DEBUG
 
+    SetupPostProcessingThreadPool(pimpl, GetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, 1));
+
     std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler():NULL);
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
 
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
-        if( process->IsActive( pFlags)) {
+        if( process->IsActive( pFlags) || process->IsRequested( this)) {
+            const char* name = process->GetName() ? process->GetName() : "postprocess";
 
             if (profiler) {
-                profiler->BeginRegion("postprocess");
+                profiler->BeginRegion(name);
             }
+            statistics.Begin(name);
 
             process->ExecuteOnScene ( this );
 
+            statistics.End();
             if (profiler) {
-                profiler->EndRegion("postprocess");
+                profiler->EndRegion(name);
             }
         }
         if( !pimpl->mScene) {
@@ -803,6 +951,10 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
     if( pimpl->mScene )
       ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
 
+    if (pimpl->mScene) {
+        ApplyStorageOptions(this, pimpl->mScene);
+    }
+
     // clear any data allocated by post-process steps
     pimpl->mPPShared->Clean();
     ASSIMP_LOG_INFO("Leaving post processing pipeline");
@@ -828,6 +980,8 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     // In debug builds: run basic flag validation
     ASSIMP_LOG_INFO( "Entering customized post processing pipeline" );
 
+    RevertStorageOptions( pimpl->mScene );
+
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
     // The ValidateDS process plays an exceptional role. It isn't contained in the global
     // list of post-processing steps, so we need to call it manually.
@@ -853,16 +1007,22 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
+    SetupPostProcessingThreadPool( pimpl, GetPropertyInteger( AI_CONFIG_PP_NUM_THREADS, 1 ) );
+
     std::unique_ptr<Profiler> profiler( GetPropertyInteger( AI_CONFIG_GLOB_MEASURE_TIME, 0 ) ? new Profiler() : NULL );
+    StepStatisticsRecorder statistics( this );
+    const char* name = rootProcess->GetName() ? rootProcess->GetName() : "postprocess";
 
     if ( profiler ) {
-        profiler->BeginRegion( "postprocess" );
+        profiler->BeginRegion( name );
     }
+    statistics.Begin( name );
 
     rootProcess->ExecuteOnScene( this );
 
+    statistics.End();
     if ( profiler ) {
-        profiler->EndRegion( "postprocess" );
+        profiler->EndRegion( name );
     }
 
     // If the extra verbose mode is active, execute the ValidateDataStructureStep again - after each step
@@ -876,6 +1036,10 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
         }
     }
 
+    if ( pimpl->mScene ) {
+        ApplyStorageOptions( this, pimpl->mScene );
+    }
+
     // clear any data allocated by post-process steps
     pimpl->mPPShared->Clean();
     ASSIMP_LOG_INFO( "Leaving customized post processing pipeline" );
@@ -1069,6 +1233,14 @@ inline void AddNodeWeight(unsigned int& iScene,const aiNode* pcNode)
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the statistics of the last import
+const aiImportStatistics* Importer::GetLastImportStatistics() const
+{
+    ai_assert(nullptr != pimpl);
+    return pimpl->mImportStatistics.mNumSteps ? &pimpl->mImportStatistics : NULL;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get the memory requirements of the scene
 void Importer::GetMemoryRequirements(aiMemoryInfo& in) const
@@ -1118,7 +1290,21 @@ void Importer::GetMemoryRequirements(aiMemoryInfo& in) const
                 in.meshes += mScene->mMeshes[i]->mBones[p]->mNumWeights * sizeof(aiVertexWeight);
             }
         }
-        in.meshes += (sizeof(aiFace) + 3 * sizeof(unsigned int))*mScene->mMeshes[i]->mNumFaces;
+        if (mScene->mMeshes[i]->HasIndexBuffer()) {
+            in.meshes += mScene->mMeshes[i]->mIndexSize * mScene->mMeshes[i]->mNumIndices;
+        }
+        else in.meshes += (sizeof(aiFace) + 3 * sizeof(unsigned int))*mScene->mMeshes[i]->mNumFaces;
+
+        if (mScene->mMeshes[i]->HasPackedVertices()) {
+            in.meshes += mScene->mMeshes[i]->mPackedLayout.mStride * mScene->mMeshes[i]->mNumVertices;
+        }
+
+        if (mScene->mMeshes[i]->HasMeshlets()) {
+            in.meshes += sizeof(aiMeshlet) * mScene->mMeshes[i]->mNumMeshlets;
+            in.meshes += sizeof(unsigned int) * mScene->mMeshes[i]->mNumMeshletVertices;
+            in.meshes += mScene->mMeshes[i]->mNumMeshletIndices;
+        }
+        in.meshes += sizeof(unsigned int) * mScene->mMeshes[i]->mNumLODs;
     }
     in.total += in.meshes;
 
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 #include <string>
 #include <assimp/matrix4x4.h>
+#include <assimp/types.h>
 
 struct aiScene;
 
@@ -58,6 +59,7 @@ namespace Assimp    {
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class ThreadPool;
 
 
 //! @cond never
@@ -119,6 +121,14 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Worker pool for post-process steps, NULL unless #AI_CONFIG_PP_NUM_THREADS
+     *  requests more than one thread */
+    ThreadPool* mThreadPool;
+
+    /** Statistics of the last import, collected if #AI_CONFIG_GLOB_MEASURE_TIME is set */
+    std::vector<aiImportStepStatistics> mStepStatistics;
+    aiImportStatistics mImportStatistics;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 };
@@ -138,7 +148,10 @@ ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT
 , mStringProperties()
 , mMatrixProperties()
 , bExtraVerbose( false )
-, mPPShared( nullptr ) {
+, mPPShared( nullptr )
+, mThreadPool( nullptr )
+, mStepStatistics()
+, mImportStatistics() {
     // empty
 }
 //! @endcond
@@ -150,8 +163,9 @@ struct BatchData;
 /** FOR IMPORTER PLUGINS ONLY: A helper class to the pleasure of importers
  *  that need to load many external meshes recursively.
  *
- *  The class uses several threads to load these meshes (or at least it
- *  could, this has not yet been implemented at the moment).
+ *  The queued files are loaded one after another by default. With
+ *  setNumThreads() they are spread across a pool of threads instead, each
+ *  with an Importer of its own.
  *
  *  @note The class may not be used by more than one thread*/
 class ASSIMP_API BatchLoader
@@ -204,6 +218,25 @@ public:
      *  @return The current validation step.
      */
     bool getValidation() const;
+
+    // -------------------------------------------------------------------
+    /** Sets the number of threads LoadAll() loads the queued files on.
+     *
+     *  Each thread uses an Importer of its own, all of which share the
+     *  IO system given to the constructor. It must therefore be safe to
+     *  call from several threads at once if more than one thread is
+     *  used; DefaultIOSystem and MemoryMappedIOSystem are. The directory
+     *  stack of the IO system is kept per thread.
+     *  @param  numThreads  Number of threads, 0 selects the number of
+     *    hardware threads. The default is 1, which loads the files on
+     *    the calling thread.
+     */
+    void setNumThreads( unsigned int numThreads );
+
+    // -------------------------------------------------------------------
+    /** Returns the number of threads set with setNumThreads().
+     */
+    unsigned int getNumThreads() const;
     
     // -------------------------------------------------------------------
     /** Add a new file to the list of files to be loaded.
@@ -234,7 +267,8 @@ public:
 
     // -------------------------------------------------------------------
     /** Waits until all scenes have been loaded. This returns
-     *  immediately if no scenes are queued.*/
+     *  immediately if no scenes are queued. Files that have been
+     *  loaded by a previous call are not loaded again.*/
     void LoadAll();
 
 private:
@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../STEPParser/STEPFileReader.h"
 
 #include "IFCUtil.h"
+#include "code/ThreadPool.h"
 
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/scene.h>
@@ -163,6 +164,7 @@ void IFCImporter::SetupProperties(const Importer* pImp)
     settings.conicSamplingAngle = std::min(std::max((float) pImp->GetPropertyFloat(AI_CONFIG_IMPORT_IFC_SMOOTHING_ANGLE, AI_IMPORT_IFC_DEFAULT_SMOOTHING_ANGLE), 5.0f), 120.0f);
 	settings.cylindricalTessellation = std::min(std::max(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_CYLINDRICAL_TESSELLATION, AI_IMPORT_IFC_DEFAULT_CYLINDRICAL_TESSELLATION), 3), 180);
 	settings.skipAnnotations = true;
+    settings.numThreads = ThreadPool::ResolveThreadCount(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_NUM_THREADS, 1));
 }
 
 
@@ -278,7 +280,7 @@ void IFCImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
     };
 
     // feed the IFC schema into the reader and pre-parse all lines
-    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track);
+    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track, settings.numThreads);
     const STEP::LazyObject* proj =  db->GetObject("ifcproject");
     if (!proj) {
         ThrowException("missing IfcProject entity");
@@ -113,6 +113,7 @@ public:
             , skipAnnotations()
             , conicSamplingAngle(10.f)
 			, cylindricalTessellation(32)
+            , numThreads(1)
         {}
 
 
@@ -121,6 +122,7 @@ public:
         bool skipAnnotations;
         float conicSamplingAngle;
 		int cylindricalTessellation;
+        unsigned int numThreads;
     };
 
 
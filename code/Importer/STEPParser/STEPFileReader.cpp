@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "STEPFileReader.h"
 #include "STEPFileEncoding.h"
+#include "code/ThreadPool.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/fast_atof.h>
 #include <memory>
@@ -101,7 +102,9 @@ STEP::DB* STEP::ReadFileHeader(std::shared_ptr<IOStream> stream) {
         const std::string& s = *splitter;
         if (s == "DATA;") {
             // here we go, header done, start of data section
+            const char* const data = reinterpret_cast<const char*>(reader->GetPtr());
             ++splitter;
+            db->SetDataSection(data, splitter.get_index());
             break;
         }
 
@@ -146,12 +149,12 @@ namespace {
 
 // ------------------------------------------------------------------------------------------------
 // check whether the given line contains an entity definition (i.e. starts with "#<number>=")
-bool IsEntityDef(const std::string& snext)
+bool IsEntityDef(const char* begin, const char* end)
 {
-    if (snext[0] == '#') {
+    if (begin != end && begin[0] == '#') {
         // it is only a new entity if it has a '=' after the
         // entity ID.
-        for(std::string::const_iterator it = snext.begin()+1; it != snext.end(); ++it) {
+        for(const char* it = begin+1; it != end; ++it) {
             if (*it == '=') {
                 return true;
             }
@@ -163,25 +166,123 @@ bool IsEntityDef(const std::string& snext)
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool IsEntityDef(const std::string& snext)
+{
+    return IsEntityDef(snext.c_str(), snext.c_str() + snext.length());
 }
 
+// ------------------------------------------------------------------------------------------------
+// An entity record from the DATA section, before its LazyObject is created
+struct EntityRecord
+{
+    uint64_t id;
+    uint64_t line;
+    const char* type;
+    char* args;
+};
 
 // ------------------------------------------------------------------------------------------------
-void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
-    const char* const* types_to_track, size_t len,
-    const char* const* inverse_indices_to_track, size_t len2)
+// Result of scanning (a part of) the DATA section. Warnings are kept with their
+// line numbers and emitted by the caller, so they come out in file order.
+struct RecordScan
 {
-    db.SetSchema(scheme);
-    db.SetTypesToTrack(types_to_track,len);
-    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+    RecordScan()
+        : records()
+        , warnings()
+        , numLines()
+        , endsec()
+    {}
+
+    ~RecordScan() {
+        for(EntityRecord& r : records) {
+            delete[] r.args;
+        }
+    }
 
-    const DB::ObjectMap& map = db.GetObjects();
-    LineSplitter& splitter = db.GetSplitter();
+    std::vector<EntityRecord> records;
+    std::vector<std::pair<std::string, uint64_t> > warnings;
+    LineSplitter::line_idx numLines;
+    bool endsec;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Lines of one chunk of the DATA section, split following the same rules as
+// LineSplitter with empty lines skipped and leading blanks trimmed. The chunk
+// owns all lines that start before its end.
+class ChunkLines
+{
+public:
+    ChunkLines(const char* begin, const char* chunkEnd, const char* end)
+        : mLineStart(begin)
+        , mNext(begin)
+        , mChunkEnd(chunkEnd)
+        , mEnd(end)
+        , mIdx()
+    {
+        operator++();
+        mIdx = 0;
+    }
+
+    ChunkLines& operator++() {
+        mLineStart = mNext;
+        const char* s = mNext;
+        while (s != mEnd && *s != '\n' && *s != '\r') {
+            ++s;
+        }
+        mCur.assign(mNext, s);
+        if (s != mEnd) {
+            for (++s; s != mEnd && (*s == ' ' || *s == '\r' || *s == '\n'); ++s);
+        }
+        mNext = s;
+        ++mIdx;
+        return *this;
+    }
+
+    operator bool() const {
+        return mLineStart < mChunkEnd && mNext != mEnd;
+    }
 
+    const std::string& operator* () const {
+        return mCur;
+    }
+
+    LineSplitter::line_idx get_index() const {
+        return mIdx;
+    }
+
+    // start of the line following the one at pos, skipping empty lines
+    static const char* NextLine(const char* pos, const char* end) {
+        while (pos != end && *pos != '\n' && *pos != '\r') {
+            ++pos;
+        }
+        while (pos != end && (*pos == ' ' || *pos == '\r' || *pos == '\n')) {
+            ++pos;
+        }
+        return pos;
+    }
+
+private:
+    const char* mLineStart;
+    const char* mNext;
+    const char* const mChunkEnd;
+    const char* const mEnd;
+    LineSplitter::line_idx mIdx;
+    std::string mCur;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Scan the entity records from the given lines up to ENDSEC. Only the id, the
+// type and the argument string of each entity are extracted, the actual
+// objects are created lazily later on.
+template <typename Lines>
+void ScanRecords(Lines& splitter, const EXPRESS::ConversionSchema& scheme, RecordScan& out)
+{
     while (splitter) {
         bool has_next = false;
         std::string s = *splitter;
         if (s == "ENDSEC;") {
+            out.endsec = true;
             break;
         }
         s.erase(std::remove(s.begin(), s.end(), ' '), s.end());
@@ -191,7 +292,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // LineSplitter already ignores empty lines
         ai_assert(s.length());
         if (s[0] != '#') {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'#\'",line));
+            out.warnings.push_back(std::make_pair(std::string("expected token \'#\'"),line));
             ++splitter;
             continue;
         }
@@ -201,14 +302,14 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // ---
         const std::string::size_type n0 = s.find_first_of('=');
         if (n0 == std::string::npos) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'=\'",line));
+            out.warnings.push_back(std::make_pair(std::string("expected token \'=\'"),line));
             ++splitter;
             continue;
         }
 
         const uint64_t id = strtoul10_64(s.substr(1,n0-1).c_str());
         if (!id) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected positive, numeric entity id",line));
+            out.warnings.push_back(std::make_pair(std::string("expected positive, numeric entity id"),line));
             ++splitter;
             continue;
         }
@@ -235,7 +336,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
             }
 
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \'(\'",line));
+                out.warnings.push_back(std::make_pair(std::string("expected token \'(\'"),line));
                 continue;
             }
         }
@@ -261,15 +362,11 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
                 }
             }
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \')\'",line));
+                out.warnings.push_back(std::make_pair(std::string("expected token \')\'"),line));
                 continue;
             }
         }
 
-        if (map.find(id) != map.end()) {
-            ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
-        }
-
         std::string::size_type ns = n0;
         do ++ns; while( IsSpace(s.at(ns)));
         std::string::size_type ne = n1;
@@ -282,14 +379,122 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
             char* const copysz = new char[len+1];
             std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz);
             copysz[len] = '\0';
-            db.InternInsert(new LazyObject(db,id,line,sz,copysz));
+            const EntityRecord record = { id, line, sz, copysz };
+            out.records.push_back(record);
         }
         if(!has_next) {
             ++splitter;
         }
     }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Scan the DATA section on several threads. The section is cut into chunks at
+// lines that start an entity, so no record spans two chunks, and the chunks
+// are scanned independently. Their line numbers are made absolute afterwards.
+void ScanRecordsParallel(const char* begin, const char* end, LineSplitter::line_idx firstLine,
+    const EXPRESS::ConversionSchema& scheme, unsigned int numThreads,
+    std::vector<std::unique_ptr<RecordScan> >& scans)
+{
+    // a few chunks per thread to even out the load
+    const size_t numChunks = std::max<size_t>(1, std::min<size_t>(numThreads * 4, (end - begin) / (1 << 16)));
+    std::vector<const char*> bounds(1, begin);
+    for (size_t i = 1; i < numChunks; ++i) {
+        const char* cut = std::max(bounds.back(), begin + (end - begin) / numChunks * i);
+        if (cut != begin) {
+            cut = ChunkLines::NextLine(cut - 1, end);
+        }
+        while (cut != end && !IsEntityDef(cut, std::find_if(cut, end, [](char c) { return c == '\n' || c == '\r'; }))) {
+            cut = ChunkLines::NextLine(cut, end);
+        }
+        bounds.push_back(cut);
+    }
+    bounds.push_back(end);
+
+    scans.resize(numChunks);
+    ThreadPool pool(numThreads);
+    pool.ParallelFor(static_cast<unsigned int>(numChunks), [&](unsigned int i) {
+        scans[i].reset(new RecordScan());
+        ChunkLines lines(bounds[i], bounds[i + 1], end);
+        ScanRecords(lines, scheme, *scans[i]);
+        if (!scans[i]->endsec) {
+            for(; lines; ++lines);
+        }
+        scans[i]->numLines = lines.get_index();
+    });
+
+    // line numbers are relative to their chunk so far
+    LineSplitter::line_idx base = firstLine;
+    for (std::unique_ptr<RecordScan>& scan : scans) {
+        for(EntityRecord& r : scan->records) {
+            r.line += base;
+        }
+        for(std::pair<std::string, uint64_t>& w : scan->warnings) {
+            w.second += base;
+        }
+        base += scan->numLines;
+    }
+}
+
+}
+
+
+// ------------------------------------------------------------------------------------------------
+void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
+    const char* const* types_to_track, size_t len,
+    const char* const* inverse_indices_to_track, size_t len2,
+    unsigned int numThreads)
+{
+    db.SetSchema(scheme);
+    db.SetTypesToTrack(types_to_track,len);
+    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+
+    std::vector<std::unique_ptr<RecordScan> > scans;
+    if (numThreads > 1 && db.GetDataBegin()) {
+        StreamReaderLE& reader = db.GetReader();
+        const char* const end = reinterpret_cast<const char*>(reader.GetPtr()) + reader.GetRemainingSize();
+        ScanRecordsParallel(db.GetDataBegin(), end, db.GetDataLine(), scheme, numThreads, scans);
+    }
+    else {
+        scans.push_back(std::unique_ptr<RecordScan>(new RecordScan()));
+        ScanRecords(db.GetSplitter(), scheme, *scans.back());
+    }
+
+    // size the object table once all ids are known
+    uint64_t maxId = 0;
+    size_t numRecords = 0;
+    for (const std::unique_ptr<RecordScan>& scan : scans) {
+        for(const EntityRecord& r : scan->records) {
+            maxId = std::max(maxId, r.id);
+        }
+        numRecords += scan->records.size();
+        if (scan->endsec) {
+            break;
+        }
+    }
+    db.ReserveObjects(maxId, numRecords);
+
+    // create the objects in file order, this also collects the inverse indices
+    bool endsec = false;
+    const DB::ObjectMap& map = db.GetObjects();
+    for (std::unique_ptr<RecordScan>& scan : scans) {
+        for(const std::pair<std::string, uint64_t>& w : scan->warnings) {
+            ASSIMP_LOG_WARN(AddLineNumber(w.first,w.second));
+        }
+        for(EntityRecord& r : scan->records) {
+            if (map.Find(r.id)) {
+                ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",r.id," already exists"),r.line));
+            }
+            db.InternInsert(new LazyObject(db,r.id,r.line,r.type,r.args));
+            r.args = nullptr;
+        }
+        if (scan->endsec) {
+            endsec = true;
+            break;
+        }
+    }
 
-    if (!splitter) {
+    if (!endsec) {
         ASSIMP_LOG_WARN("STEP: ignoring unexpected EOF");
     }
 
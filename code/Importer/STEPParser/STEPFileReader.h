@@ -55,14 +55,16 @@ namespace STEP {
 DB* ReadFileHeader(std::shared_ptr<IOStream> stream);
 
 /// 2) read the actual file contents using a user-supplied set of
-///    conversion functions to interpret the data.
-void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const* types_to_track, size_t len, const char* const* inverse_indices_to_track, size_t len2);
+///    conversion functions to interpret the data. With numThreads > 1 the
+///    DATA section is split at entity boundaries and the chunks are scanned
+///    concurrently; the resulting database is the same.
+void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const* types_to_track, size_t len, const char* const* inverse_indices_to_track, size_t len2, unsigned int numThreads = 1);
 
 /// @brief  Helper to read a file.
 template <size_t N, size_t N2>
 inline
-void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const (&arr)[N], const char* const (&arr2)[N2]) {
-    return ReadFile(db,scheme,arr,N,arr2,N2);
+void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const (&arr)[N], const char* const (&arr2)[N2], unsigned int numThreads = 1) {
+    return ReadFile(db,scheme,arr,N,arr2,N2,numThreads);
 }
 
 } // ! STEP
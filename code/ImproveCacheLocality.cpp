@@ -45,7 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * <br>
  * The algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw rduction isn't implemented yet ...
+ * The optional overdraw reduction follows the clustering and sorting
+ * described in the same paper, using the fast view-independent sort key.
  */
 
 
@@ -59,13 +60,355 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <stdio.h>
 #include <stack>
+#include <algorithm>
+#include <climits>
+#include <limits>
 
 using namespace Assimp;
 
+namespace {
+
+// the vertex fetch is simulated with a direct mapped cache of this many lines
+const unsigned int FETCH_CACHE_LINE_SIZE = 64;
+const unsigned int FETCH_CACHE_LINES = 256;
+
+// ------------------------------------------------------------------------------------------------
+// Simple model of a FIFO post-transform vertex cache
+class VertexFIFO {
+public:
+    explicit VertexFIFO(unsigned int depth)
+    : mEntries(std::max(depth, 1u), UINT_MAX)
+    , mNext() {
+        // empty
+    }
+
+    void Clear() {
+        std::fill(mEntries.begin(), mEntries.end(), UINT_MAX);
+    }
+
+    // returns true on a cache miss
+    bool Touch(unsigned int idx) {
+        if (std::find(mEntries.begin(), mEntries.end(), idx) != mEntries.end()) {
+            return false;
+        }
+        mEntries[mNext] = idx;
+        mNext = (mNext + 1) % mEntries.size();
+        return true;
+    }
+
+    unsigned int Touch(const aiFace& face) {
+        unsigned int misses = 0;
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            misses += Touch(face.mIndices[i]);
+        }
+        return misses;
+    }
+
+private:
+    std::vector<unsigned int> mEntries;
+    size_t mNext;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Cache statistics of a triangle mesh, used for logging only
+struct VertexCacheStats {
+    VertexCacheStats()
+    : numFaces()
+    , numVertices()
+    , numMisses()
+    , fetchedBytes()
+    , vertexBytes() {
+        // empty
+    }
+
+    unsigned int numFaces;
+    unsigned int numVertices;   //!< number of referenced vertices
+    unsigned int numMisses;     //!< post-transform cache misses
+    size_t fetchedBytes;        //!< bytes read from the vertex buffer
+    size_t vertexBytes;         //!< size of all referenced vertices
+
+    void Add(const VertexCacheStats& o) {
+        numFaces += o.numFaces;
+        numVertices += o.numVertices;
+        numMisses += o.numMisses;
+        fetchedBytes += o.fetchedBytes;
+        vertexBytes += o.vertexBytes;
+    }
+
+    // average cache miss ratio, misses per triangle
+    float ACMR() const {
+        return numFaces ? (float)numMisses / numFaces : 0.f;
+    }
+
+    // average transformed vertex ratio, 1 is optimal
+    float ATVR() const {
+        return numVertices ? (float)numMisses / numVertices : 0.f;
+    }
+
+    // bytes fetched per byte of vertex data, 1 is optimal
+    float FetchRatio() const {
+        return vertexBytes ? (float)fetchedBytes / vertexBytes : 0.f;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Size of a vertex if all streams of the mesh were interleaved in one buffer
+unsigned int ComputeVertexSize(const aiMesh* pMesh)
+{
+    unsigned int size = sizeof(aiVector3D);
+    if (pMesh->HasNormals()) {
+        size += sizeof(aiVector3D);
+    }
+    if (pMesh->HasTangentsAndBitangents()) {
+        size += 2 * sizeof(aiVector3D);
+    }
+    for (unsigned int i = 0; pMesh->HasVertexColors(i); ++i) {
+        size += sizeof(aiColor4D);
+    }
+    for (unsigned int i = 0; pMesh->HasTextureCoords(i); ++i) {
+        size += pMesh->mNumUVComponents[i] * sizeof(ai_real);
+    }
+    return size;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Simulate a FIFO post-transform cache of the given size and the vertex fetch
+// of each transformed vertex.
+VertexCacheStats AnalyzeVertexCache(const aiMesh* pMesh, unsigned int cacheDepth)
+{
+    VertexCacheStats stats;
+    stats.numFaces = pMesh->mNumFaces;
+
+    const unsigned int vertexSize = ComputeVertexSize(pMesh);
+    VertexFIFO fifo(cacheDepth);
+    std::vector<size_t> lines(FETCH_CACHE_LINES, std::numeric_limits<size_t>::max());
+    std::vector<bool> referenced(pMesh->mNumVertices, false);
+
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        const aiFace& face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            const unsigned int idx = face.mIndices[i];
+            if (!fifo.Touch(idx)) {
+                continue;
+            }
+            ++stats.numMisses;
+
+            if (!referenced[idx]) {
+                referenced[idx] = true;
+                ++stats.numVertices;
+            }
+
+            // fetch all cache lines the vertex touches
+            const size_t first = (size_t)idx * vertexSize / FETCH_CACHE_LINE_SIZE;
+            const size_t last = ((size_t)idx * vertexSize + vertexSize - 1) / FETCH_CACHE_LINE_SIZE;
+            for (size_t line = first; line <= last; ++line) {
+                size_t& slot = lines[line % FETCH_CACHE_LINES];
+                if (slot != line) {
+                    slot = line;
+                    stats.fetchedBytes += FETCH_CACHE_LINE_SIZE;
+                }
+            }
+        }
+    }
+    stats.vertexBytes = (size_t)stats.numVertices * vertexSize;
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorder the triangles of a cache optimized mesh to reduce overdraw. The face
+// order is cut into clusters wherever the cache starts over, and those are cut
+// further as long as the ACMR of the parts, each starting with an empty cache,
+// does not exceed the one of the whole cluster by more than the given
+// threshold. The clusters are then sorted by how much they face away from the
+// center of the mesh.
+void ReduceOverdraw(aiMesh* pMesh, unsigned int cacheDepth, float threshold)
+{
+    const unsigned int numFaces = pMesh->mNumFaces;
+    VertexFIFO fifo(cacheDepth);
+
+    // hard boundaries: no vertex of the face was in the cache
+    std::vector<unsigned int> hard;
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        if (fifo.Touch(pMesh->mFaces[f]) == 3 || !f) {
+            hard.push_back(f);
+        }
+    }
+    hard.push_back(numFaces);
+
+    // soft boundaries inside of the hard clusters
+    std::vector<unsigned int> clusters;
+    for (size_t c = 0; c + 1 < hard.size(); ++c) {
+        const unsigned int begin = hard[c], end = hard[c + 1];
+        unsigned int total = 0;
+        fifo.Clear();
+        for (unsigned int f = begin; f < end; ++f) {
+            total += fifo.Touch(pMesh->mFaces[f]);
+        }
+        const float limit = threshold * total / (end - begin);
+
+        unsigned int start = begin, sum = 0;
+        clusters.push_back(begin);
+        fifo.Clear();
+        for (unsigned int f = begin; f + 1 < end; ++f) {
+            sum += fifo.Touch(pMesh->mFaces[f]);
+            if ((float)sum / (f - start + 1) <= limit) {
+                clusters.push_back(f + 1);
+                start = f + 1;
+                sum = 0;
+                fifo.Clear();
+            }
+        }
+    }
+    clusters.push_back(numFaces);
+
+    const size_t numClusters = clusters.size() - 1;
+    if (numClusters < 2) {
+        return;
+    }
+
+    // area weighted centroid and normal of each cluster and of the mesh
+    std::vector<aiVector3D> centroids(numClusters), normals(numClusters);
+    std::vector<ai_real> areas(numClusters, 0);
+    aiVector3D meshCentroid;
+    ai_real meshArea = 0;
+    for (size_t c = 0; c < numClusters; ++c) {
+        for (unsigned int f = clusters[c]; f < clusters[c + 1]; ++f) {
+            const aiFace& face = pMesh->mFaces[f];
+            const aiVector3D& v0 = pMesh->mVertices[face.mIndices[0]];
+            const aiVector3D& v1 = pMesh->mVertices[face.mIndices[1]];
+            const aiVector3D& v2 = pMesh->mVertices[face.mIndices[2]];
+            const aiVector3D n = (v1 - v0) ^ (v2 - v0);
+            const ai_real area = n.Length();
+            centroids[c] += (v0 + v1 + v2) * (area / 3);
+            normals[c] += n;
+            areas[c] += area;
+        }
+        meshCentroid += centroids[c];
+        meshArea += areas[c];
+    }
+    if (meshArea > 0) {
+        meshCentroid /= meshArea;
+    }
+
+    std::vector<std::pair<ai_real, unsigned int> > keys(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        ai_real key = 0;
+        if (areas[c] > 0) {
+            key = (centroids[c] / areas[c] - meshCentroid) * normals[c].Normalize();
+        }
+        keys[c] = std::make_pair(key, static_cast<unsigned int>(c));
+    }
+    std::stable_sort(keys.begin(), keys.end(),
+        [](const std::pair<ai_real, unsigned int>& a, const std::pair<ai_real, unsigned int>& b) {
+            return a.first > b.first;
+        });
+
+    // the faces are triangles, so the indices can be copied back face by face
+    std::vector<unsigned int> indices;
+    indices.reserve(numFaces * 3);
+    for (size_t c = 0; c < numClusters; ++c) {
+        const unsigned int cluster = keys[c].second;
+        for (unsigned int f = clusters[cluster]; f < clusters[cluster + 1]; ++f) {
+            const aiFace& face = pMesh->mFaces[f];
+            indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+        }
+    }
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        std::copy(&indices[f * 3], &indices[f * 3] + 3, pMesh->mFaces[f].mIndices);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void RemapVertexStream(T*& data, const std::vector<unsigned int>& remap)
+{
+    if (!data) {
+        return;
+    }
+    T* const out = new T[remap.size()];
+    for (size_t i = 0; i < remap.size(); ++i) {
+        out[remap[i]] = data[i];
+    }
+    delete[] data;
+    data = out;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorder the vertices of the mesh in the order the faces first reference them
+void ReorderVerticesForFetch(aiMesh* pMesh)
+{
+    std::vector<unsigned int> remap(pMesh->mNumVertices, UINT_MAX);
+    unsigned int next = 0;
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        const aiFace& face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            if (remap[face.mIndices[i]] == UINT_MAX) {
+                remap[face.mIndices[i]] = next++;
+            }
+        }
+    }
+
+    // unreferenced vertices keep their relative order at the end
+    bool identity = true;
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        if (remap[v] == UINT_MAX) {
+            remap[v] = next++;
+        }
+        identity = identity && remap[v] == v;
+    }
+    if (identity) {
+        return;
+    }
+
+    RemapVertexStream(pMesh->mVertices, remap);
+    RemapVertexStream(pMesh->mNormals, remap);
+    RemapVertexStream(pMesh->mTangents, remap);
+    RemapVertexStream(pMesh->mBitangents, remap);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        RemapVertexStream(pMesh->mColors[i], remap);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        RemapVertexStream(pMesh->mTextureCoords[i], remap);
+    }
+
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+        aiAnimMesh* anim = pMesh->mAnimMeshes[a];
+        RemapVertexStream(anim->mVertices, remap);
+        RemapVertexStream(anim->mNormals, remap);
+        RemapVertexStream(anim->mTangents, remap);
+        RemapVertexStream(anim->mBitangents, remap);
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            RemapVertexStream(anim->mColors[i], remap);
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            RemapVertexStream(anim->mTextureCoords[i], remap);
+        }
+    }
+
+    for (unsigned int b = 0; b < pMesh->mNumBones; ++b) {
+        aiBone* bone = pMesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+        }
+    }
+
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        aiFace& face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            face.mIndices[i] = remap[face.mIndices[i]];
+        }
+    }
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
-ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() {
-    configCacheDepth = PP_ICL_PTCACHE_SIZE;
+ImproveCacheLocalityProcess::ImproveCacheLocalityProcess()
+: configCacheDepth(PP_ICL_PTCACHE_SIZE)
+, configVertexFetch(false)
+, configOverdrawThreshold(0.f) {
+    // empty
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -88,6 +431,8 @@ void ImproveCacheLocalityProcess::SetupProperties(const Importer* pImp)
 {
     // AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
     configCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE,PP_ICL_PTCACHE_SIZE);
+    configVertexFetch = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_VERTEX_FETCH_ORDER,false);
+    configOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD,0.f);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -101,20 +446,49 @@ void ImproveCacheLocalityProcess::Execute( aiScene* pScene)
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
+    // the statistics are only gathered for logging
+    const bool report = !DefaultLogger::isNullLogger();
+    std::vector<float> results(pScene->mNumMeshes, 0.f);
+    std::vector<char> reordered(pScene->mNumMeshes, 0);
+    std::vector<VertexCacheStats> before(pScene->mNumMeshes), after(pScene->mNumMeshes);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
+        aiMesh* const mesh = pScene->mMeshes[a];
+        if (report && mesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE) {
+            before[a] = AnalyzeVertexCache(mesh, configCacheDepth);
+        }
+        results[a] = ProcessMesh( mesh,a);
+        reordered[a] = ReorderMesh( mesh);
+        if (report && (results[a] || reordered[a])) {
+            after[a] = AnalyzeVertexCache(mesh, configCacheDepth);
+        }
+    });
+
     float out = 0.f;
-    unsigned int numf = 0, numm = 0;
+    unsigned int numf = 0, numm = 0, numt = 0;
+    VertexCacheStats statsIn, statsOut;
     for( unsigned int a = 0; a < pScene->mNumMeshes; a++){
-        const float res = ProcessMesh( pScene->mMeshes[a],a);
+        const float res = results[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out  += res;
             ++numm;
         }
+        // the statistics cover every mesh one of the passes has been applied to
+        if (res || reordered[a]) {
+            ++numt;
+            statsIn.Add(before[a]);
+            statsOut.Add(after[a]);
+        }
     }
-    if (!DefaultLogger::isNullLogger()) {
+    if (report) {
         if (numf > 0) {
             ASSIMP_LOG_INFO_F("Cache relevant are ", numm, " meshes (", numf, " faces). Average output ACMR is ", out / numf);
         }
+        if (numt > 0) {
+            ASSIMP_LOG_INFO_F("Vertex cache of ", numt, " meshes: ACMR ", statsIn.ACMR(), " -> ", statsOut.ACMR(),
+                ", ATVR ", statsIn.ATVR(), " -> ", statsOut.ATVR(),
+                ", vertex fetch ratio ", statsIn.FetchRatio(), " -> ", statsOut.FetchRatio());
+        }
         ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess finished. ");
     }
 }
@@ -384,3 +758,25 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 
     return fACMR2;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the faces for less overdraw and the vertices for fetch order, if requested. This
+// runs after ProcessMesh(), independently of whether it optimized the mesh.
+bool ImproveCacheLocalityProcess::ReorderMesh( aiMesh* pMesh)
+{
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        return false;
+    }
+
+    // the vertex order depends on the final face order, so it comes last
+    bool applied = false;
+    if (configOverdrawThreshold >= 1.f) {
+        ReduceOverdraw(pMesh, configCacheDepth, configOverdrawThreshold);
+        applied = true;
+    }
+    if (configVertexFetch) {
+        ReorderVerticesForFetch(pMesh);
+        applied = true;
+    }
+    return applied;
+}
@@ -56,7 +56,9 @@ namespace Assimp
 // ---------------------------------------------------------------------------
 /** The ImproveCacheLocalityProcess reorders all faces for improved vertex
  *  cache locality. It tries to arrange all faces to fans and to render
- *  faces which share vertices directly one after the other.
+ *  faces which share vertices directly one after the other. Optionally the
+ *  faces are then clustered and sorted for less overdraw and the vertices
+ *  are reordered to match the order they are fetched in.
  *
  *  @note This step expects triagulated input data.
  */
@@ -89,10 +91,26 @@ protected:
      */
     float ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
 
+    // -------------------------------------------------------------------
+    /** Applies the overdraw and vertex fetch reordering to the given mesh,
+     *  if they are enabled.
+     * @param pMesh The mesh to process.
+     * @return true if one of the passes has been applied.
+     */
+    bool ReorderMesh( aiMesh* pMesh);
+
 private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int configCacheDepth;
+
+    //! Configuration parameter: reorder the vertices in the order of
+    //! their first use after the faces have been reordered.
+    bool configVertexFetch;
+
+    //! Configuration parameter: ACMR degradation accepted to reduce
+    //! overdraw. Values below 1 disable the overdraw optimization.
+    float configOverdrawThreshold;
 };
 
 } // end of namespace Assimp
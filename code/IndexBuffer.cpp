@@ -0,0 +1,152 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file IndexBuffer.cpp
+ *  @brief Implementation of the conversion between faces and index buffers
+ */
+
+#include <assimp/IndexBuffer.h>
+#include <assimp/scene.h>
+
+#include <stdint.h>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+template <typename IndexType>
+void FillIndexBuffer(const aiMesh* mesh, IndexType* out) {
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        const unsigned int* idx = mesh->mFaces[i].mIndices;
+        *out++ = static_cast<IndexType>(idx[0]);
+        *out++ = static_cast<IndexType>(idx[1]);
+        *out++ = static_cast<IndexType>(idx[2]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename IndexType>
+void FillFaces(const IndexType* in, aiMesh* mesh) {
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i, in += 3) {
+        aiFace& face = mesh->mFaces[i];
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3];
+        face.mIndices[0] = in[0];
+        face.mIndices[1] = in[1];
+        face.mIndices[2] = in[2];
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool BuildIndexBuffer(aiMesh* mesh, unsigned int indexSize) {
+    if (nullptr == mesh || mesh->HasIndexBuffer() || !mesh->HasFaces()) {
+        return false;
+    }
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        if (mesh->mFaces[i].mNumIndices != 3) {
+            return false;
+        }
+    }
+
+    // 16 bit indices address vertices 0..65535
+    if (indexSize != 2 || mesh->mNumVertices > 0x10000) {
+        indexSize = 4;
+    }
+
+    const size_t numIndices = mesh->mNumFaces * size_t(3);
+    const size_t numWords = (numIndices * indexSize + sizeof(unsigned int) - 1) / sizeof(unsigned int);
+    unsigned int* buffer = new unsigned int[numWords];
+    if (indexSize == 2) {
+        FillIndexBuffer(mesh, reinterpret_cast<uint16_t*>(buffer));
+    } else {
+        FillIndexBuffer(mesh, buffer);
+    }
+
+    delete[] mesh->mFaces;
+    mesh->mFaces = nullptr;
+    mesh->mIndexBuffer = buffer;
+    mesh->mIndexSize = indexSize;
+    mesh->mNumIndices = static_cast<unsigned int>(numIndices);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExpandIndexBuffer(aiMesh* mesh) {
+    if (nullptr == mesh || nullptr == mesh->mIndexBuffer) {
+        return;
+    }
+
+    unsigned int* buffer = static_cast<unsigned int*>(mesh->mIndexBuffer);
+    delete[] mesh->mFaces;
+    mesh->mNumFaces = mesh->mNumIndices / 3;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    if (mesh->mIndexSize == 2) {
+        FillFaces(reinterpret_cast<const uint16_t*>(buffer), mesh);
+    } else {
+        FillFaces(buffer, mesh);
+    }
+
+    delete[] buffer;
+    mesh->mIndexBuffer = nullptr;
+    mesh->mIndexSize = 0;
+    mesh->mNumIndices = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BuildIndexBuffers(aiScene* scene, unsigned int indexSize) {
+    for (unsigned int i = 0; scene && scene->mMeshes && i < scene->mNumMeshes; ++i) {
+        BuildIndexBuffer(scene->mMeshes[i], indexSize);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExpandIndexBuffers(aiScene* scene) {
+    for (unsigned int i = 0; scene && scene->mMeshes && i < scene->mNumMeshes; ++i) {
+        ExpandIndexBuffer(scene->mMeshes[i]);
+    }
+}
+
+} // Namespace Assimp
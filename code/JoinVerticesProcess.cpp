@@ -53,12 +53,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Vertex.h>
 #include <assimp/TinyFormatter.h>
 #include <stdio.h>
+#include <string.h>
 #include <unordered_set>
 
 using namespace Assimp;
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 JoinVerticesProcess::JoinVerticesProcess()
+: configSpatialSortBackend( SpatialSort::Backend_PlaneSort )
+, configExactMatch( false )
 {
     // nothing to do here
 }
@@ -76,6 +79,14 @@ bool JoinVerticesProcess::IsActive( unsigned int pFlags) const
 {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Setup import configuration
+void JoinVerticesProcess::SetupProperties(const Importer* pImp)
+{
+    configSpatialSortBackend = GetSpatialSortBackend(pImp);
+    configExactMatch = pImp->GetPropertyBool(AI_CONFIG_PP_JIV_EXACT_MATCH, false);
+}
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene)
@@ -91,9 +102,14 @@ void JoinVerticesProcess::Execute( aiScene* pScene)
     }
 
     // execute the step
+    std::vector<int> numVertices(pScene->mNumMeshes, 0);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
+        numVertices[a] = ProcessMesh( pScene->mMeshes[a],a);
+    });
+
     int iNumVertices = 0;
     for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+        iNumVertices += numVertices[a];
 
     // if logging is active, print detailed statistics
     if (!DefaultLogger::isNullLogger()) {
@@ -226,6 +242,143 @@ void updateXMeshVertices(XMesh *pMesh, std::vector<Vertex> &uniqueVertices) {
         }
     }
 }
+
+// ------------------------------------------------------------------------------------------------
+// Hashes and compares the full record of a vertex: all vertex attributes of the mesh and its
+// anim meshes plus the bone weights. Two vertices are equal if all of them are bitwise equal,
+// except for -0 and +0 which are treated as the same value.
+class ExactVertexKey {
+public:
+    explicit ExactVertexKey(const aiMesh* pMesh)
+    : mWeights(ComputeVertexBoneWeightTable(pMesh)) {
+        AddStreams(pMesh);
+        for (unsigned int i = 0; i < pMesh->mNumAnimMeshes; ++i) {
+            AddStreams(pMesh->mAnimMeshes[i]);
+        }
+    }
+
+    ~ExactVertexKey() {
+        delete [] mWeights;
+    }
+
+    uint64_t Hash(unsigned int idx) const {
+        uint64_t hash = 14695981039346656037ull;
+        for (const Stream& stream : mStreams) {
+            const ai_real* value = stream.first + idx * stream.second;
+            for (unsigned int c = 0; c < stream.second; ++c) {
+                hash = (hash ^ ToBits(value[c])) * 1099511628211ull;
+            }
+        }
+        if (mWeights) {
+            for (const PerVertexWeight& w : mWeights[idx]) {
+                hash = (hash ^ w.first) * 1099511628211ull;
+                hash = (hash ^ ToBits(w.second)) * 1099511628211ull;
+            }
+        }
+        // the table is indexed by the low bits, so mix the high bits into them
+        return hash ^ (hash >> 29) ^ (hash >> 47);
+    }
+
+    bool Equal(unsigned int a, unsigned int b) const {
+        for (const Stream& stream : mStreams) {
+            const ai_real* lhs = stream.first + a * stream.second;
+            const ai_real* rhs = stream.first + b * stream.second;
+            for (unsigned int c = 0; c < stream.second; ++c) {
+                if (ToBits(lhs[c]) != ToBits(rhs[c])) {
+                    return false;
+                }
+            }
+        }
+        return !mWeights || mWeights[a] == mWeights[b];
+    }
+
+private:
+    typedef std::pair<const ai_real*, unsigned int> Stream;
+
+    template <typename T>
+    static uint64_t ToBits(T value) {
+        // adding zero turns -0 into +0
+        value += T(0);
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(T));
+        return bits;
+    }
+
+    template <class XMesh>
+    void AddStreams(const XMesh* pMesh) {
+        static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D must be tightly packed");
+        static_assert(sizeof(aiColor4D) == 4 * sizeof(ai_real), "aiColor4D must be tightly packed");
+        AddStream(pMesh->mVertices, 3);
+        AddStream(pMesh->mNormals, 3);
+        AddStream(pMesh->mTangents, 3);
+        AddStream(pMesh->mBitangents, 3);
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            AddStream(pMesh->mColors[i], 4);
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            AddStream(pMesh->mTextureCoords[i], 3);
+        }
+    }
+
+    template <typename T>
+    void AddStream(const T* data, unsigned int numComponents) {
+        if (data) {
+            mStreams.push_back(Stream(reinterpret_cast<const ai_real*>(data), numComponents));
+        }
+    }
+
+    std::vector<Stream> mStreams;
+    const VertexWeightTable* mWeights;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Finds bitwise identical vertices by looking up their hashes in an open-addressing table, in
+// expected linear time. Fills the same structures as the epsilon-based search in ProcessMesh().
+void JoinExactVertices(aiMesh* pMesh, const std::unordered_set<unsigned int>& usedVertexIndices,
+        std::vector<unsigned int>& replaceIndex, std::vector<Vertex>& uniqueVertices,
+        std::vector<std::vector<Vertex>>& uniqueAnimatedVertices)
+{
+    const ExactVertexKey key(pMesh);
+
+    // keep the load factor below 0.5 so probe sequences stay short
+    size_t tableSize = 16;
+    while (tableSize < usedVertexIndices.size() * 2) {
+        tableSize <<= 1;
+    }
+    const size_t mask = tableSize - 1;
+
+    // each slot holds the hash and the index of a unique vertex in the source mesh
+    std::vector<std::pair<uint64_t, unsigned int> > table(tableSize, std::make_pair(uint64_t(0), 0xffffffffu));
+
+    for (unsigned int a = 0; a < pMesh->mNumVertices; a++) {
+        if (usedVertexIndices.find(a) == usedVertexIndices.end()) {
+            continue;
+        }
+
+        const uint64_t hash = key.Hash(a);
+        size_t slot = static_cast<size_t>(hash) & mask;
+        unsigned int matchIndex = 0xffffffff;
+        while (table[slot].second != 0xffffffff) {
+            if (table[slot].first == hash && key.Equal(table[slot].second, a)) {
+                matchIndex = replaceIndex[table[slot].second];
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        if (matchIndex != 0xffffffff) {
+            replaceIndex[a] = matchIndex | 0x80000000;
+        } else {
+            table[slot] = std::make_pair(hash, a);
+            replaceIndex[a] = (unsigned int)uniqueVertices.size();
+            uniqueVertices.push_back(Vertex(pMesh, a));
+            for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+                uniqueAnimatedVertices[animMeshIndex].push_back(Vertex(pMesh->mAnimMeshes[animMeshIndex], a));
+            }
+        }
+    }
+}
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -265,31 +418,6 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
     static_assert(AI_MAX_VERTICES == 0x7fffffff, "AI_MAX_VERTICES == 0x7fffffff");
     std::vector<unsigned int> replaceIndex( pMesh->mNumVertices, 0xffffffff);
 
-    // float posEpsilonSqr;
-    SpatialSort* vertexFinder = NULL;
-    SpatialSort _vertexFinder;
-
-    typedef std::pair<SpatialSort,float> SpatPair;
-    if (shared) {
-        std::vector<SpatPair >* avf;
-        shared->GetProperty(AI_SPP_SPATIAL_SORT,avf);
-        if (avf)    {
-            SpatPair& blubb = (*avf)[meshIndex];
-            vertexFinder  = &blubb.first;
-            // posEpsilonSqr = blubb.second;
-        }
-    }
-    if (!vertexFinder)  {
-        // bad, need to compute it.
-        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
-        vertexFinder = &_vertexFinder;
-        // posEpsilonSqr = ComputePositionEpsilon(pMesh);
-    }
-
-    // Again, better waste some bytes than a realloc ...
-    std::vector<unsigned int> verticesFound;
-    verticesFound.reserve(10);
-
     // Run an optimized code path if we don't have multiple UVs or vertex colors.
     // This should yield false in more than 99% of all imports ...
     const bool complex = ( pMesh->GetNumColorChannels() > 0 || pMesh->GetNumUVChannels() > 1);
@@ -304,69 +432,99 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
         }
     }
 
-    // Now check each vertex if it brings something new to the table
-    for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
-        if (usedVertexIndices.find(a) == usedVertexIndices.end()) {
-            continue;
+    if (configExactMatch) {
+        JoinExactVertices(pMesh, usedVertexIndices, replaceIndex, uniqueVertices, uniqueAnimatedVertices);
+    } else {
+        // float posEpsilonSqr;
+        SpatialSort* vertexFinder = NULL;
+        SpatialSort _vertexFinder;
+
+        typedef std::pair<SpatialSort,float> SpatPair;
+        if (shared) {
+            std::vector<SpatPair >* avf;
+            shared->GetProperty(AI_SPP_SPATIAL_SORT,avf);
+            if (avf)    {
+                SpatPair& blubb = (*avf)[meshIndex];
+                vertexFinder  = &blubb.first;
+                // posEpsilonSqr = blubb.second;
+            }
+        }
+        if (!vertexFinder)  {
+            // bad, need to compute it.
+            _vertexFinder.SetBackend(configSpatialSortBackend);
+            _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
+            vertexFinder = &_vertexFinder;
+            // posEpsilonSqr = ComputePositionEpsilon(pMesh);
         }
 
-        // collect the vertex data
-        Vertex v(pMesh,a);
+        // Again, better waste some bytes than a realloc ...
+        std::vector<unsigned int> verticesFound;
+        verticesFound.reserve(10);
 
-        // collect all vertices that are close enough to the given position
-        vertexFinder->FindIdenticalPositions( v.position, verticesFound);
-        unsigned int matchIndex = 0xffffffff;
-
-        // check all unique vertices close to the position if this vertex is already present among them
-        for( unsigned int b = 0; b < verticesFound.size(); b++) {
-            const unsigned int vidx = verticesFound[b];
-            const unsigned int uidx = replaceIndex[ vidx];
-            if( uidx & 0x80000000)
+        // Now check each vertex if it brings something new to the table
+        for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
+            if (usedVertexIndices.find(a) == usedVertexIndices.end()) {
                 continue;
+            }
 
-            const Vertex& uv = uniqueVertices[ uidx];
+            // collect the vertex data
+            Vertex v(pMesh,a);
 
-            if (!areVerticesEqual(v, uv, complex)) {
-                continue;
-            }
+            // collect all vertices that are close enough to the given position
+            vertexFinder->FindIdenticalPositions( v.position, verticesFound);
+            unsigned int matchIndex = 0xffffffff;
 
-            if (hasAnimMeshes) {
-                // If given vertex is animated, then it has to be preserver 1 to 1 (base mesh and animated mesh require same topology)
-                // NOTE: not doing this totaly breaks anim meshes as they don't have their own faces (they use pMesh->mFaces)
-                bool breaksAnimMesh = false;
-                for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-                    const Vertex& animatedUV = uniqueAnimatedVertices[animMeshIndex][ uidx];
-                    Vertex aniMeshVertex(pMesh->mAnimMeshes[animMeshIndex], a);
-                    if (!areVerticesEqual(aniMeshVertex, animatedUV, complex)) {
-                        breaksAnimMesh = true;
-                        break;
-                    }
-                }
-                if (breaksAnimMesh) {
+            // check all unique vertices close to the position if this vertex is already present among them
+            for( unsigned int b = 0; b < verticesFound.size(); b++) {
+                const unsigned int vidx = verticesFound[b];
+                const unsigned int uidx = replaceIndex[ vidx];
+                if( uidx & 0x80000000)
+                    continue;
+
+                const Vertex& uv = uniqueVertices[ uidx];
+
+                if (!areVerticesEqual(v, uv, complex)) {
                     continue;
                 }
-            }
 
-            // we're still here -> this vertex perfectly matches our given vertex
-            matchIndex = uidx;
-            break;
-        }
+                if (hasAnimMeshes) {
+                    // If given vertex is animated, then it has to be preserver 1 to 1 (base mesh and animated mesh require same topology)
+                    // NOTE: not doing this totaly breaks anim meshes as they don't have their own faces (they use pMesh->mFaces)
+                    bool breaksAnimMesh = false;
+                    for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+                        const Vertex& animatedUV = uniqueAnimatedVertices[animMeshIndex][ uidx];
+                        Vertex aniMeshVertex(pMesh->mAnimMeshes[animMeshIndex], a);
+                        if (!areVerticesEqual(aniMeshVertex, animatedUV, complex)) {
+                            breaksAnimMesh = true;
+                            break;
+                        }
+                    }
+                    if (breaksAnimMesh) {
+                        continue;
+                    }
+                }
 
-        // found a replacement vertex among the uniques?
-        if( matchIndex != 0xffffffff)
-        {
-            // store where to found the matching unique vertex
-            replaceIndex[a] = matchIndex | 0x80000000;
-        }
-        else
-        {
-            // no unique vertex matches it up to now -> so add it
-            replaceIndex[a] = (unsigned int)uniqueVertices.size();
-            uniqueVertices.push_back( v);
-            if (hasAnimMeshes) {
-                for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-                    Vertex aniMeshVertex(pMesh->mAnimMeshes[animMeshIndex], a);
-                    uniqueAnimatedVertices[animMeshIndex].push_back(aniMeshVertex);
+                // we're still here -> this vertex perfectly matches our given vertex
+                matchIndex = uidx;
+                break;
+            }
+
+            // found a replacement vertex among the uniques?
+            if( matchIndex != 0xffffffff)
+            {
+                // store where to found the matching unique vertex
+                replaceIndex[a] = matchIndex | 0x80000000;
+            }
+            else
+            {
+                // no unique vertex matches it up to now -> so add it
+                replaceIndex[a] = (unsigned int)uniqueVertices.size();
+                uniqueVertices.push_back( v);
+                if (hasAnimMeshes) {
+                    for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+                        Vertex aniMeshVertex(pMesh->mAnimMeshes[animMeshIndex], a);
+                        uniqueAnimatedVertices[animMeshIndex].push_back(aniMeshVertex);
+                    }
                 }
             }
         }
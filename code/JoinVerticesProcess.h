@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include <assimp/types.h>
+#include <assimp/SpatialSort.h>
 
 struct aiMesh;
 
@@ -83,6 +84,13 @@ public:
     */
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    /** Called prior to ExecuteOnScene().
+    * The function is a request to the process to update its configuration
+    * basing on the Importer's configuration property list.
+    */
+    void SetupProperties(const Importer* pImp);
+
 public:
     // -------------------------------------------------------------------
     /** Unites identical vertices in the given mesh.
@@ -92,6 +100,11 @@ public:
     int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
 
 private:
+    /** Configuration option: SpatialSort backend if no shared one is available */
+    SpatialSort::Backend configSpatialSortBackend;
+
+    /** Configuration option: only join bitwise identical vertices, found through hashing */
+    bool configExactMatch;
 };
 
 } // end of namespace Assimp
@@ -78,9 +78,9 @@ bool LimitBoneWeightsProcess::IsActive( unsigned int pFlags) const
 // Executes the post processing step on the given imported data.
 void LimitBoneWeightsProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess begin");
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a ) {
+    ExecutePerMesh(pScene, [&](unsigned int a) {
         ProcessMesh(pScene->mMeshes[a]);
-    }
+    });
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess end");
 }
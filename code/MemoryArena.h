@@ -0,0 +1,206 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MemoryArena.h
+ *  @brief Defines a monotonic allocator for data that is freed all at once.
+ */
+#ifndef AI_MEMORYARENA_H_INC
+#define AI_MEMORYARENA_H_INC
+
+#include <assimp/defs.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A monotonic ('bump pointer') allocator.
+ *
+ *  Memory is carved from a small number of large blocks and can't be freed
+ *  individually; all of it is released when the arena is destroyed. This
+ *  trades some slack for allocation and teardown costs that no longer depend
+ *  on the number of allocations. No constructors or destructors are run,
+ *  the arena hands out raw storage only.
+ */
+class MemoryArena {
+public:
+    /** Maximum alignment of the storage returned by Allocate() */
+    static const size_t MaxAlignment = 16;
+
+    // -------------------------------------------------------------------
+    /** @brief Constructs an empty arena.
+     *  @param blockSize Minimum size of a block, in bytes. Larger requests
+     *    get a block of their own size.
+     */
+    explicit MemoryArena(size_t blockSize = 64 * 1024)
+    : mBlockSize(blockSize)
+    , mCur(nullptr)
+    , mEnd(nullptr)
+    , mCapacity(0)
+    , mUsed(0) {
+        // empty
+    }
+
+    ~MemoryArena() {
+        Clear();
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Returns uninitialized storage of the given size.
+     *  @param bytes Number of bytes to allocate
+     *  @param alignment Alignment of the storage, a power of two that
+     *    does not exceed MaxAlignment.
+     */
+    void* Allocate(size_t bytes, size_t alignment = MaxAlignment) {
+        char* p = Align(mCur, alignment);
+        if (nullptr == mCur || p + bytes > mEnd) {
+            AddBlock(bytes + alignment);
+            p = Align(mCur, alignment);
+        }
+        mCur = p + bytes;
+        mUsed += bytes;
+        return p;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Returns uninitialized storage for an array of T. */
+    template <typename T>
+    T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Constructs an object in arena storage.
+     *
+     *  The destructor is never run, hence this is restricted to trivially
+     *  destructible types.
+     */
+    template <typename T, typename... Args>
+    T* New(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value,
+            "MemoryArena::New() never runs destructors");
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Makes sure that the next allocations totalling 'bytes'
+     *  (including alignment padding) are served from a single block.
+     */
+    void Reserve(size_t bytes) {
+        if (nullptr == mCur || mCur + bytes > mEnd) {
+            AddBlock(bytes);
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Checks whether a pointer refers to storage of this arena. */
+    bool Contains(const void* p) const {
+        const char* c = static_cast<const char*>(p);
+        for (const Block& block : mBlocks) {
+            if (c >= block.mBegin && c < block.mEnd) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Releases all blocks. Pointers handed out before become invalid. */
+    void Clear() {
+        for (const Block& block : mBlocks) {
+            ::operator delete(block.mBegin);
+        }
+        mBlocks.clear();
+        mCur = mEnd = nullptr;
+        mCapacity = mUsed = 0;
+    }
+
+    /** Number of blocks allocated from the heap */
+    size_t GetNumBlocks() const { return mBlocks.size(); }
+
+    /** Total size of all blocks, in bytes */
+    size_t GetCapacity() const { return mCapacity; }
+
+    /** Number of bytes handed out, not counting alignment padding */
+    size_t GetBytesUsed() const { return mUsed; }
+
+private:
+    struct Block {
+        char* mBegin;
+        char* mEnd;
+    };
+
+    static char* Align(char* p, size_t alignment) {
+        const size_t mask = alignment - 1;
+        return reinterpret_cast<char*>((reinterpret_cast<size_t>(p) + mask) & ~mask);
+    }
+
+    void AddBlock(size_t minBytes) {
+        const size_t size = minBytes > mBlockSize ? minBytes : mBlockSize;
+        mBlocks.reserve(mBlocks.size() + 1);
+        Block block;
+        block.mBegin = static_cast<char*>(::operator new(size));
+        block.mEnd = block.mBegin + size;
+        mBlocks.push_back(block);
+        mCur = block.mBegin;
+        mEnd = block.mEnd;
+        mCapacity += size;
+    }
+
+    MemoryArena(const MemoryArena&);
+    MemoryArena& operator=(const MemoryArena&);
+
+    std::vector<Block> mBlocks;
+    size_t mBlockSize;
+    char* mCur;
+    char* mEnd;
+    size_t mCapacity;
+    size_t mUsed;
+};
+
+} // Namespace Assimp
+
+#endif // AI_MEMORYARENA_H_INC
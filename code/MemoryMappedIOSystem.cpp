@@ -0,0 +1,229 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file Implementation of the memory mapped IOSystem */
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Maps the whole file read-only into memory. Returns NULL if this is not possible.
+const uint8_t* MapFile(const char* pFile, size_t& length) {
+    length = 0;
+#ifdef _WIN32
+    wchar_t fileName16[MAX_PATH];
+    if (0 == MultiByteToWideChar(CP_UTF8, 0, pFile, -1, fileName16, MAX_PATH)) {
+        return nullptr;
+    }
+
+    HANDLE file = ::CreateFileW(fileName16, GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (INVALID_HANDLE_VALUE == file) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size) || 0 == size.QuadPart) {
+        ::CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (nullptr == mapping) {
+        return nullptr;
+    }
+
+    // the view keeps the mapping alive
+    void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (nullptr == data) {
+        return nullptr;
+    }
+    length = static_cast<size_t>(size.QuadPart);
+    return static_cast<const uint8_t*>(data);
+#else
+    const int fd = ::open(pFile, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    // mmap() refuses empty files, and special files have no meaningful size
+    struct stat info;
+    if (0 != ::fstat(fd, &info) || !S_ISREG(info.st_mode) || 0 == info.st_size) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (MAP_FAILED == data) {
+        return nullptr;
+    }
+    length = static_cast<size_t>(info.st_size);
+    return static_cast<const uint8_t*>(data);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(const uint8_t* data, size_t length) {
+#ifdef _WIN32
+    (void)length;
+    ::UnmapViewOfFile(data);
+#else
+    ::munmap(const_cast<uint8_t*>(data), length);
+#endif
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(const uint8_t* data, size_t length, const std::string& filename) AI_NO_EXCEPT
+: mData( data )
+, mLength( length )
+, mPos( 0 )
+, mFilename( filename ) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream() {
+    UnmapFile(mData, mLength);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void* pvBuffer, size_t pSize, size_t pCount) {
+    ai_assert(nullptr != pvBuffer);
+    ai_assert(0 != pSize);
+
+    const size_t cnt = std::min(pCount, (mLength - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void* /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/) {
+    // the file has been opened read-only
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    if (aiOrigin_SET == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        mPos = pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        mPos = mLength - pOffset;
+    } else {
+        if (pOffset + mPos > mLength) {
+            return AI_FAILURE;
+        }
+        mPos += pOffset;
+    }
+    return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const {
+    return mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const {
+    return mLength;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush() {
+    // nothing to do, the stream is read-only
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t* MemoryMappedIOStream::GetMappedData() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream* MemoryMappedIOSystem::Open( const char* strFile, const char* strMode) {
+    ai_assert(nullptr != strFile);
+    ai_assert(nullptr != strMode);
+
+    // Only binary read access can be served from a read-only mapping,
+    // text mode would need the line endings to be translated.
+    if (nullptr == ::strpbrk(strMode, "wa+t")) {
+        size_t length = 0;
+        const uint8_t* data = MapFile(strFile, length);
+        if (nullptr != data) {
+            return new MemoryMappedIOStream(data, length, strFile);
+        }
+    }
+
+    return DefaultIOSystem::Open(strFile, strMode);
+}
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileImporter.h"
 #include "ObjFileParser.h"
 #include "ObjFileData.h"
+#include "ThreadPool.h"
 #include <assimp/IOStreamBuffer.h>
 #include <memory>
 #include <assimp/DefaultIOSystem.h>
@@ -54,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ai_assert.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/importerdesc.h>
+#include <assimp/config.h>
 
 static const aiImporterDesc desc = {
     "Wavefront Object Importer",
@@ -79,7 +81,8 @@ using namespace std;
 ObjFileImporter::ObjFileImporter()
 : m_Buffer()
 , m_pRootObject( nullptr )
-, m_strAbsPath( "" ) {
+, m_strAbsPath( "" )
+, m_numThreads( 1 ) {
     DefaultIOSystem io;
     m_strAbsPath = io.getOsSeparator();
 }
@@ -104,6 +107,12 @@ bool ObjFileImporter::CanRead( const std::string& pFile, IOSystem*  pIOHandler ,
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+//  Reads the import settings.
+void ObjFileImporter::SetupProperties( const Importer* pImp ) {
+    m_numThreads = ThreadPool::ResolveThreadCount( pImp->GetPropertyInteger( AI_CONFIG_IMPORT_OBJ_NUM_THREADS, 1 ) );
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc* ObjFileImporter::GetInfo() const {
     return &desc;
@@ -145,7 +154,7 @@ void ObjFileImporter::InternReadFile( const std::string &file, aiScene* pScene,
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser( streamedBuffer, modelName, pIOHandler, m_progress, file);
+    ObjFileParser parser( streamedBuffer, modelName, pIOHandler, m_progress, file, m_numThreads );
 
     // And create the proper return structures out of it
     CreateDataFromImport(parser.GetModel(), pScene);
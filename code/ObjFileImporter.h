@@ -73,6 +73,9 @@ public:
     /// \remark See BaseImporter::CanRead() for details.
     bool CanRead( const std::string& pFile, IOSystem* pIOHandler, bool checkSig) const;
 
+    /// \brief  Reads the import settings.
+    void SetupProperties( const Importer* pImp );
+
 private:
     //! \brief  Appends the supported extension.
     const aiImporterDesc* GetInfo () const;
@@ -114,6 +117,8 @@ private:
     ObjFile::Object *m_pRootObject;
     //! Absolute pathname of model in file system
     std::string m_strAbsPath;
+    //! Number of threads the file is parsed on
+    unsigned int m_numThreads;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -52,12 +52,53 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/material.h>
 #include <assimp/Importer.hpp>
+#include "ThreadPool.h"
+#include <algorithm>
 #include <cstdlib>
 
 namespace Assimp {
 
 const std::string ObjFileParser::DEFAULT_MATERIAL = AI_DEFAULT_MATERIAL_NAME;
 
+// -------------------------------------------------------------------
+/// A range of complete lines of a block which is parsed by one thread.
+/// Vertex data is parsed into the chunk's own arrays, all other lines
+/// which might change the model are kept to be replayed in file order.
+struct ObjFileParser::DataChunk {
+    /// A face or a statement which depends on the parser state
+    struct Line {
+        /// Offsets of the line into the block, end is behind the line end
+        size_t begin, end;
+        /// Number of data records in the chunk in front of the line
+        size_t numVertices, numTextureCoords, numNormals;
+        /// The parsed face for face, line and point statements
+        std::unique_ptr<ObjFile::Face> face;
+    };
+
+    DataChunk( size_t b, size_t e )
+    : begin( b )
+    , end( e )
+    , textureCoordDim( 0 ) {
+        // empty
+    }
+
+    size_t begin, end;
+    std::vector<aiVector3D> vertices;
+    std::vector<aiVector3D> vertexColors;
+    std::vector<aiVector3D> textureCoords;
+    std::vector<aiVector3D> normals;
+    unsigned int textureCoordDim;
+    std::vector<Line> lines;
+};
+
+static bool isFaceStatement( char c ) {
+    return c == 'f' || c == 'l' || c == 'p';
+}
+
+static aiPrimitiveType getFaceType( char c ) {
+    return c == 'f' ? aiPrimitiveType_POLYGON : ( c == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT );
+}
+
 ObjFileParser::ObjFileParser()
 : m_DataIt()
 , m_DataItEnd()
@@ -71,7 +112,7 @@ ObjFileParser::ObjFileParser()
 
 ObjFileParser::ObjFileParser( IOStreamBuffer<char> &streamBuffer, const std::string &modelName,
                               IOSystem *io, ProgressHandler* progress,
-                              const std::string &originalObjFileName) :
+                              const std::string &originalObjFileName, unsigned int numThreads ) :
     m_DataIt(),
     m_DataItEnd(),
     m_pModel(nullptr),
@@ -93,7 +134,11 @@ ObjFileParser::ObjFileParser( IOStreamBuffer<char> &streamBuffer, const std::str
     m_pModel->m_MaterialMap[ DEFAULT_MATERIAL ] = m_pModel->m_pDefaultMaterial;
 
     // Start parsing the file
-    parseFile( streamBuffer );
+    if ( numThreads > 1 ) {
+        parseFileParallel( streamBuffer, numThreads );
+    } else {
+        parseFile( streamBuffer );
+    }
 }
 
 ObjFileParser::~ObjFileParser() {
@@ -131,112 +176,281 @@ void ObjFileParser::parseFile( IOStreamBuffer<char> &streamBuffer ) {
             m_progress->UpdateFileRead( processed, progressTotal );
         }
 
-        // parse line
-        switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-            {
-                ++m_DataIt;
-                if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                    size_t numComponents = getNumComponentsInDataDefinition();
-                    if (numComponents == 3) {
-                        // read in vertex definition
-                        getVector3(m_pModel->m_Vertices);
-                    } else if (numComponents == 4) {
-                        // read in vertex definition (homogeneous coords)
-                        getHomogeneousVector3(m_pModel->m_Vertices);
-                    } else if (numComponents == 6) {
-                        // read vertex and vertex-color
-                        getTwoVectors3(m_pModel->m_Vertices, m_pModel->m_VertexColors);
+        parseLine();
+    }
+}
+
+void ObjFileParser::parseFileParallel( IOStreamBuffer<char> &streamBuffer, unsigned int numThreads ) {
+    ThreadPool pool( numThreads );
+    const unsigned int progressTotal = static_cast<unsigned int>( streamBuffer.size() );
+
+    // The file is read in blocks, the incomplete last line of a block is kept for the next one
+    std::vector<char> buffer, data;
+    for ( ;; ) {
+        const bool eof = !streamBuffer.getNextBlock( data );
+        if ( !eof ) {
+            // the last block of the file is shorter than the cache
+            data.resize( std::min( data.size(), streamBuffer.cacheSize() ) );
+            buffer.insert( buffer.end(), data.begin(), data.end() );
+        } else if ( buffer.empty() ) {
+            break;
+        } else {
+            buffer.push_back( '\n' );
+        }
+
+        size_t blockEnd = buffer.size();
+        while ( blockEnd > 0 && buffer[ blockEnd - 1 ] != '\n' ) {
+            --blockEnd;
+        }
+        if ( 0 == blockEnd ) {
+            continue;
+        }
+        if ( blockEnd == buffer.size() ) {
+            // The statement parsers expect data behind the line end,
+            // the extra line end becomes an empty line of the next block
+            buffer.push_back( '\n' );
+        }
+
+        // Split the block into chunks at line boundaries
+        std::vector<DataChunk> chunks;
+        const size_t numChunks = pool.GetNumThreads() * 4;
+        const size_t chunkSize = std::max( blockEnd / numChunks, static_cast<size_t>( 1 ) );
+        for ( size_t begin = 0; begin < blockEnd; ) {
+            size_t end = std::min( begin + chunkSize, blockEnd );
+            while ( buffer[ end - 1 ] != '\n' ) {
+                ++end;
+            }
+            chunks.push_back( DataChunk( begin, end ) );
+            begin = end;
+        }
+
+        // Parse the vertex data, then the faces, which need the number of
+        // vertices in front of them to resolve relative indices
+        const DataArrayIt blockBegin = buffer.begin();
+        const unsigned int count = static_cast<unsigned int>( chunks.size() );
+        pool.ParallelFor( count, [&]( unsigned int i ) {
+            ObjFileParser worker;
+            worker.parseChunkData( blockBegin, chunks[ i ] );
+        } );
+
+        std::vector<size_t> numVertices( count ), numTextureCoords( count ), numNormals( count );
+        size_t v = m_pModel->m_Vertices.size(), vt = m_pModel->m_TextureCoord.size(), vn = m_pModel->m_Normals.size();
+        for ( unsigned int i = 0; i < count; ++i ) {
+            numVertices[ i ] = v;
+            numTextureCoords[ i ] = vt;
+            numNormals[ i ] = vn;
+            v += chunks[ i ].vertices.size();
+            vt += chunks[ i ].textureCoords.size();
+            vn += chunks[ i ].normals.size();
+        }
+        pool.ParallelFor( count, [&]( unsigned int i ) {
+            ObjFileParser worker;
+            worker.parseChunkFaces( blockBegin, chunks[ i ], numVertices[ i ], numTextureCoords[ i ], numNormals[ i ] );
+        } );
+
+        // Merge the chunks and replay the remaining lines in file order
+        m_pModel->m_Vertices.reserve( v );
+        m_pModel->m_TextureCoord.reserve( vt );
+        m_pModel->m_Normals.reserve( vn );
+        for ( DataChunk &chunk : chunks ) {
+            m_pModel->m_Vertices.insert( m_pModel->m_Vertices.end(), chunk.vertices.begin(), chunk.vertices.end() );
+            m_pModel->m_VertexColors.insert( m_pModel->m_VertexColors.end(), chunk.vertexColors.begin(), chunk.vertexColors.end() );
+            m_pModel->m_TextureCoord.insert( m_pModel->m_TextureCoord.end(), chunk.textureCoords.begin(), chunk.textureCoords.end() );
+            m_pModel->m_Normals.insert( m_pModel->m_Normals.end(), chunk.normals.begin(), chunk.normals.end() );
+            m_pModel->m_TextureCoordDim = std::max( m_pModel->m_TextureCoordDim, chunk.textureCoordDim );
+
+            for ( DataChunk::Line &line : chunk.lines ) {
+                m_DataIt = blockBegin + line.begin;
+                m_DataItEnd = buffer.end();
+                if ( isFaceStatement( *m_DataIt ) ) {
+                    if ( line.face ) {
+                        storeFace( line.face.release() );
                     }
-                } else if (*m_DataIt == 't') {
-                    // read in texture coordinate ( 2D or 3D )
-                    ++m_DataIt;
-                    size_t dim = getVector(m_pModel->m_TextureCoord);
-                    m_pModel->m_TextureCoordDim = std::max(m_pModel->m_TextureCoordDim, (unsigned int)dim);
-                } else if (*m_DataIt == 'n') {
-                    // Read in normal vector definition
-                    ++m_DataIt;
-                    getVector3( m_pModel->m_Normals );
+                } else {
+                    parseLine();
                 }
             }
-            break;
+        }
 
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f':
-            {
-                getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l'
-                    ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-            }
+        buffer.erase( buffer.begin(), buffer.begin() + blockEnd );
+        m_progress->UpdateFileRead( static_cast<unsigned int>( streamBuffer.getFilePos() ), progressTotal );
+        if ( eof ) {
             break;
+        }
+    }
+}
 
-        case '#': // Parse a comment
-            {
-                getComment();
+void ObjFileParser::parseLine() {
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex texture coordinate
+        {
+            ++m_DataIt;
+            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+                size_t numComponents = getNumComponentsInDataDefinition();
+                if (numComponents == 3) {
+                    // read in vertex definition
+                    getVector3(m_pModel->m_Vertices);
+                } else if (numComponents == 4) {
+                    // read in vertex definition (homogeneous coords)
+                    getHomogeneousVector3(m_pModel->m_Vertices);
+                } else if (numComponents == 6) {
+                    // read vertex and vertex-color
+                    getTwoVectors3(m_pModel->m_Vertices, m_pModel->m_VertexColors);
+                }
+            } else if (*m_DataIt == 't') {
+                // read in texture coordinate ( 2D or 3D )
+                ++m_DataIt;
+                size_t dim = getVector(m_pModel->m_TextureCoord);
+                m_pModel->m_TextureCoordDim = std::max(m_pModel->m_TextureCoordDim, (unsigned int)dim);
+            } else if (*m_DataIt == 'n') {
+                // Read in normal vector definition
+                ++m_DataIt;
+                getVector3( m_pModel->m_Normals );
             }
-            break;
+        }
+        break;
 
-        case 'u': // Parse a material desc. setter
-            {
-                std::string name;
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f':
+        {
+            getFace( getFaceType( *m_DataIt ) );
+        }
+        break;
 
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    case '#': // Parse a comment
+        {
+            getComment();
+        }
+        break;
 
-                size_t nextSpace = name.find(" ");
-                if (nextSpace != std::string::npos)
-                    name = name.substr(0, nextSpace);
+    case 'u': // Parse a material desc. setter
+        {
+            std::string name;
 
-                if(name == "usemtl")
-                {
-                    getMaterialDesc();
-                }
-            }
-            break;
+            getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-        case 'm': // Parse a material library or merging group ('mg')
+            size_t nextSpace = name.find(" ");
+            if (nextSpace != std::string::npos)
+                name = name.substr(0, nextSpace);
+
+            if(name == "usemtl")
             {
-                std::string name;
+                getMaterialDesc();
+            }
+        }
+        break;
 
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    case 'm': // Parse a material library or merging group ('mg')
+        {
+            std::string name;
 
-                size_t nextSpace = name.find(" ");
-                if (nextSpace != std::string::npos)
-                    name = name.substr(0, nextSpace);
+            getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-                if (name == "mg")
-                    getGroupNumberAndResolution();
-                else if(name == "mtllib")
-                    getMaterialLib();
-				else
-					goto pf_skip_line;
-            }
-            break;
+            size_t nextSpace = name.find(" ");
+            if (nextSpace != std::string::npos)
+                name = name.substr(0, nextSpace);
 
-        case 'g': // Parse group name
-            {
-                getGroupName();
-            }
-            break;
+            if (name == "mg")
+                getGroupNumberAndResolution();
+            else if(name == "mtllib")
+                getMaterialLib();
+            else
+                goto pf_skip_line;
+        }
+        break;
 
-        case 's': // Parse group number
-            {
-                getGroupNumber();
+    case 'g': // Parse group name
+        {
+            getGroupName();
+        }
+        break;
+
+    case 's': // Parse group number
+        {
+            getGroupNumber();
+        }
+        break;
+
+    case 'o': // Parse object name
+        {
+            getObjectName();
+        }
+        break;
+
+    default:
+        {
+pf_skip_line:
+            m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
+        }
+        break;
+    }
+}
+
+void ObjFileParser::parseChunkData( DataArrayIt blockBegin, DataChunk &chunk ) {
+    const DataArrayIt chunkEnd = blockBegin + chunk.end;
+    DataArrayIt lineBegin = blockBegin + chunk.begin;
+    while ( lineBegin != chunkEnd ) {
+        // A chunk always ends behind a line end
+        DataArrayIt lineEnd = lineBegin;
+        while ( !IsLineEnd( *lineEnd ) ) {
+            ++lineEnd;
+        }
+        ++lineEnd;
+
+        m_DataIt = lineBegin;
+        m_DataItEnd = lineEnd;
+        switch ( *m_DataIt ) {
+        case 'v':
+            ++m_DataIt;
+            if ( *m_DataIt == ' ' || *m_DataIt == '\t' ) {
+                size_t numComponents = getNumComponentsInDataDefinition();
+                if ( numComponents == 3 ) {
+                    getVector3( chunk.vertices );
+                } else if ( numComponents == 4 ) {
+                    getHomogeneousVector3( chunk.vertices );
+                } else if ( numComponents == 6 ) {
+                    getTwoVectors3( chunk.vertices, chunk.vertexColors );
+                }
+            } else if ( *m_DataIt == 't' ) {
+                ++m_DataIt;
+                size_t dim = getVector( chunk.textureCoords );
+                chunk.textureCoordDim = std::max( chunk.textureCoordDim, (unsigned int) dim );
+            } else if ( *m_DataIt == 'n' ) {
+                ++m_DataIt;
+                getVector3( chunk.normals );
             }
             break;
 
-        case 'o': // Parse object name
-            {
-                getObjectName();
-            }
+        case '#':
+        case 's':
+            // comments and smoothing groups don't change the model
             break;
 
         default:
-            {
-pf_skip_line:
-                m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
+            if ( !IsLineEnd( *m_DataIt ) ) {
+                DataChunk::Line line;
+                line.begin = lineBegin - blockBegin;
+                line.end = lineEnd - blockBegin;
+                line.numVertices = chunk.vertices.size();
+                line.numTextureCoords = chunk.textureCoords.size();
+                line.numNormals = chunk.normals.size();
+                chunk.lines.push_back( std::move( line ) );
             }
             break;
         }
+        lineBegin = lineEnd;
+    }
+}
+
+void ObjFileParser::parseChunkFaces( DataArrayIt blockBegin, DataChunk &chunk, size_t numVertices, size_t numTextureCoords, size_t numNormals ) {
+    for ( DataChunk::Line &line : chunk.lines ) {
+        m_DataIt = blockBegin + line.begin;
+        m_DataItEnd = blockBegin + line.end;
+        if ( isFaceStatement( *m_DataIt ) ) {
+            line.face.reset( parseFace( getFaceType( *m_DataIt ), numVertices + line.numVertices,
+                numTextureCoords + line.numTextureCoords, numNormals + line.numNormals ) );
+        }
     }
 }
 
@@ -297,105 +511,76 @@ size_t ObjFileParser::getNumComponentsInDataDefinition() {
     return numComponents;
 }
 
-size_t ObjFileParser::getVector( std::vector<aiVector3D> &point3d_array ) {
-    size_t numComponents = getNumComponentsInDataDefinition();
-    ai_real x, y, z;
-    if( 2 == numComponents ) {
-        copyNextWord( m_buffer, Buffersize );
-        x = ( ai_real ) fast_atof( m_buffer );
-
-        copyNextWord( m_buffer, Buffersize );
-        y = ( ai_real ) fast_atof( m_buffer );
-        z = 0.0;
-    } else if( 3 == numComponents ) {
-        copyNextWord( m_buffer, Buffersize );
-        x = ( ai_real ) fast_atof( m_buffer );
+void ObjFileParser::getReals( ai_real *values, size_t count ) {
+    // Parse all numbers of the line at once
+    DataArrayIt lineEnd = m_DataIt;
+    while ( lineEnd != m_DataItEnd && !IsLineEnd( *lineEnd ) ) {
+        ++lineEnd;
+    }
+    if ( m_DataIt != lineEnd ) {
+        const char *begin = &( *m_DataIt );
+        const char *in = begin;
+        if ( fast_atoreal_array( &in, begin + ( lineEnd - m_DataIt ), values, count ) == count ) {
+            m_DataIt += in - begin;
+            return;
+        }
+    }
 
+    // Malformed numbers and line continuations are left to the word-wise parser
+    for ( size_t i = 0; i < count; ++i ) {
         copyNextWord( m_buffer, Buffersize );
-        y = ( ai_real ) fast_atof( m_buffer );
+        values[ i ] = ( ai_real ) fast_atof( m_buffer );
+    }
+}
 
-        copyNextWord( m_buffer, Buffersize );
-        z = ( ai_real ) fast_atof( m_buffer );
+size_t ObjFileParser::getVector( std::vector<aiVector3D> &point3d_array ) {
+    size_t numComponents = getNumComponentsInDataDefinition();
+    ai_real v[ 3 ] = { 0.0, 0.0, 0.0 };
+    if( 2 == numComponents || 3 == numComponents ) {
+        getReals( v, numComponents );
     } else {
         throw DeadlyImportError( "OBJ: Invalid number of components" );
     }
-    point3d_array.push_back( aiVector3D( x, y, z ) );
+    point3d_array.push_back( aiVector3D( v[ 0 ], v[ 1 ], v[ 2 ] ) );
     m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
     return numComponents;
 }
 
 void ObjFileParser::getVector3( std::vector<aiVector3D> &point3d_array ) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real) fast_atof(m_buffer);
+    ai_real v[ 3 ];
+    getReals( v, 3 );
 
-    copyNextWord( m_buffer, Buffersize );
-    z = ( ai_real ) fast_atof( m_buffer );
-
-    point3d_array.push_back( aiVector3D( x, y, z ) );
+    point3d_array.push_back( aiVector3D( v[ 0 ], v[ 1 ], v[ 2 ] ) );
     m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
 }
 
 void ObjFileParser::getHomogeneousVector3( std::vector<aiVector3D> &point3d_array ) {
-    ai_real x, y, z, w;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord( m_buffer, Buffersize );
-    z = ( ai_real ) fast_atof( m_buffer );
-
-    copyNextWord( m_buffer, Buffersize );
-    w = ( ai_real ) fast_atof( m_buffer );
+    ai_real v[ 4 ];
+    getReals( v, 4 );
 
+    const ai_real w = v[ 3 ];
     if (w == 0)
       throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
 
-    point3d_array.push_back( aiVector3D( x/w, y/w, z/w ) );
+    point3d_array.push_back( aiVector3D( v[ 0 ]/w, v[ 1 ]/w, v[ 2 ]/w ) );
     m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
 }
 
 void ObjFileParser::getTwoVectors3( std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b ) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord( m_buffer, Buffersize );
-    z = ( ai_real ) fast_atof( m_buffer );
+    ai_real v[ 6 ];
+    getReals( v, 6 );
 
-    point3d_array_a.push_back( aiVector3D( x, y, z ) );
-
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real) fast_atof(m_buffer);
-
-    copyNextWord( m_buffer, Buffersize );
-    z = ( ai_real ) fast_atof( m_buffer );
-
-    point3d_array_b.push_back( aiVector3D( x, y, z ) );
+    point3d_array_a.push_back( aiVector3D( v[ 0 ], v[ 1 ], v[ 2 ] ) );
+    point3d_array_b.push_back( aiVector3D( v[ 3 ], v[ 4 ], v[ 5 ] ) );
 
     m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
 }
 
 void ObjFileParser::getVector2( std::vector<aiVector2D> &point2d_array ) {
-    ai_real x, y;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real) fast_atof(m_buffer);
+    ai_real v[ 2 ];
+    getReals( v, 2 );
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real) fast_atof(m_buffer);
-
-    point2d_array.push_back(aiVector2D(x, y));
+    point2d_array.push_back( aiVector2D( v[ 0 ], v[ 1 ] ) );
 
     m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
 }
@@ -403,20 +588,28 @@ void ObjFileParser::getVector2( std::vector<aiVector2D> &point2d_array ) {
 static const std::string DefaultObjName = "defaultobject";
 
 void ObjFileParser::getFace( aiPrimitiveType type ) {
+    ObjFile::Face *face = parseFace( type, m_pModel->m_Vertices.size(), m_pModel->m_TextureCoord.size(), m_pModel->m_Normals.size() );
+    if ( nullptr != face ) {
+        storeFace( face );
+    }
+    // Skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
+}
+
+ObjFile::Face *ObjFileParser::parseFace( aiPrimitiveType type, size_t numVertices, size_t numTextureCoords, size_t numNormals ) {
     m_DataIt = getNextToken<DataArrayIt>( m_DataIt, m_DataItEnd );
     if ( m_DataIt == m_DataItEnd || *m_DataIt == '\0' ) {
-        return;
+        return nullptr;
     }
 
     ObjFile::Face *face = new ObjFile::Face( type );
-    bool hasNormal = false;
 
-    const int vSize = static_cast<unsigned int>(m_pModel->m_Vertices.size());
-    const int vtSize = static_cast<unsigned int>(m_pModel->m_TextureCoord.size());
-    const int vnSize = static_cast<unsigned int>(m_pModel->m_Normals.size());
+    const int vSize = static_cast<unsigned int>(numVertices);
+    const int vtSize = static_cast<unsigned int>(numTextureCoords);
+    const int vnSize = static_cast<unsigned int>(numNormals);
 
-    const bool vt = (!m_pModel->m_TextureCoord.empty());
-    const bool vn = (!m_pModel->m_Normals.empty());
+    const bool vt = (0 != numTextureCoords);
+    const bool vn = (0 != numNormals);
     int iStep = 0, iPos = 0;
     while ( m_DataIt != m_DataItEnd ) {
         iStep = 1;
@@ -460,9 +653,9 @@ void ObjFileParser::getFace( aiPrimitiveType type ) {
                     face->m_texturCoords.push_back( iVal - 1 );
                 } else if ( 2 == iPos ) {
                     face->m_normals.push_back( iVal - 1 );
-                    hasNormal = true;
                 } else {
                     reportErrorTokenInFace();
+                    break;
                 }
             } else if ( iVal < 0 ) {
                 // Store relatively index
@@ -472,9 +665,9 @@ void ObjFileParser::getFace( aiPrimitiveType type ) {
                     face->m_texturCoords.push_back( vtSize + iVal );
                 } else if ( 2 == iPos ) {
                     face->m_normals.push_back( vnSize + iVal );
-                    hasNormal = true;
                 } else {
                     reportErrorTokenInFace();
+                    break;
                 }
             } else {
                 //On error, std::atoi will return 0 which is not a valid value
@@ -488,12 +681,13 @@ void ObjFileParser::getFace( aiPrimitiveType type ) {
 
     if ( face->m_vertices.empty() ) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
-        m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
         delete face;
-        return;
+        return nullptr;
     }
+    return face;
+}
 
+void ObjFileParser::storeFace( ObjFile::Face *face ) {
     // Set active material, if one set
     if( NULL != m_pModel->m_pCurrentMaterial ) {
         face->m_pMaterial = m_pModel->m_pCurrentMaterial;
@@ -515,11 +709,9 @@ void ObjFileParser::getFace( aiPrimitiveType type ) {
     m_pModel->m_pCurrentMesh->m_Faces.push_back( face );
     m_pModel->m_pCurrentMesh->m_uiNumIndices += (unsigned int) face->m_vertices.size();
     m_pModel->m_pCurrentMesh->m_uiUVCoordinates[ 0 ] += (unsigned int) face->m_texturCoords.size();
-    if( !m_pModel->m_pCurrentMesh->m_hasNormals && hasNormal ) {
+    if( !m_pModel->m_pCurrentMesh->m_hasNormals && !face->m_normals.empty() ) {
         m_pModel->m_pCurrentMesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>( m_DataIt, m_DataItEnd, m_uiLine );
 }
 
 void ObjFileParser::getMaterialDesc() {
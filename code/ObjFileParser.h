@@ -59,6 +59,7 @@ namespace ObjFile {
     struct Material;
     struct Point3;
     struct Point2;
+    struct Face;
 }
 
 class ObjFileImporter;
@@ -78,7 +79,10 @@ public:
     /// @brief  The default constructor.
     ObjFileParser();
     /// @brief  Constructor with data array.
-    ObjFileParser( IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem* io, ProgressHandler* progress, const std::string &originalObjFileName);
+    /// @param  numThreads  Number of threads to parse the data on. With more than one
+    ///         thread the file is parsed in blocks, see parseFileParallel().
+    ObjFileParser( IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem* io, ProgressHandler* progress,
+        const std::string &originalObjFileName, unsigned int numThreads = 1 );
     /// @brief  Destructor
     ~ObjFileParser();
     /// @brief  If you want to load in-core data.
@@ -87,14 +91,27 @@ public:
     ObjFile::Model *GetModel() const;
 
 protected:
+    /// Results of parsing a range of lines, see parseChunkData()
+    struct DataChunk;
+
     /// Parse the loaded file
     void parseFile( IOStreamBuffer<char> &streamBuffer );
+    /// Parse the loaded file in blocks of complete lines on several threads
+    void parseFileParallel( IOStreamBuffer<char> &streamBuffer, unsigned int numThreads );
+    /// Parse the line the data iterator points to
+    void parseLine();
+    /// Parses the vertex data of a chunk and collects the lines which depend on the parser state
+    void parseChunkData( DataArrayIt blockBegin, DataChunk &chunk );
+    /// Parses the faces collected by parseChunkData(), the sizes are the numbers of data records before the chunk
+    void parseChunkFaces( DataArrayIt blockBegin, DataChunk &chunk, size_t numVertices, size_t numTextureCoords, size_t numNormals );
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
     /// Method to copy the new line.
 //    void copyNextLine(char *pBuffer, size_t length);
     /// Get the number of components in a line.
     size_t getNumComponentsInDataDefinition();
+    /// Reads the following numbers of the current line.
+    void getReals( ai_real *values, size_t count );
     /// Stores the vector
     size_t getVector( std::vector<aiVector3D> &point3d_array );
     /// Stores the following 3d vector.
@@ -107,6 +124,10 @@ protected:
     void getVector2(std::vector<aiVector2D> &point2d_array);
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Parses the following face, the sizes are used to resolve relative indices.
+    ObjFile::Face *parseFace( aiPrimitiveType type, size_t numVertices, size_t numTextureCoords, size_t numNormals );
+    /// Adds a parsed face to the current mesh.
+    void storeFace( ObjFile::Face *face );
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
@@ -0,0 +1,337 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to remove redundant animation keys.
+ */
+
+#include "OptimizeAnimationsProcess.h"
+#include "ThreadPool.h"
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// relative error considered to be float rounding
+const ai_real RoundingError = ai_real(1e-5);
+
+// maximum number of keys a single segment may replace, each new key is
+// checked against all keys of its segment
+const unsigned int MaxSegmentKeys = 256;
+
+// ------------------------------------------------------------------------------------------------
+// Value of a track between two keys, linear for vectors and spherical for rotations
+aiVector3D Interpolate(const aiVectorKey& a, const aiVectorKey& b, double time)
+{
+    if (b.mTime <= a.mTime) {
+        return b.mValue;
+    }
+    const ai_real f = static_cast<ai_real>((time - a.mTime) / (b.mTime - a.mTime));
+    return a.mValue + (b.mValue - a.mValue) * f;
+}
+
+aiQuaternion Interpolate(const aiQuatKey& a, const aiQuatKey& b, double time)
+{
+    if (b.mTime <= a.mTime) {
+        return b.mValue;
+    }
+    aiQuaternion out;
+    aiQuaternion::Interpolate(out, a.mValue, b.mValue, static_cast<ai_real>((time - a.mTime) / (b.mTime - a.mTime)));
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Deviation between two values, the distance for vectors and the angle for rotations
+ai_real Error(const aiVector3D& a, const aiVector3D& b)
+{
+    return (a - b).Length();
+}
+
+ai_real Error(aiQuaternion a, aiQuaternion b)
+{
+    a.Normalize();
+    b.Normalize();
+
+    // q and -q are the same rotation, the chord is more accurate than acos()
+    const ai_real d0 = std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z) + (a.w - b.w) * (a.w - b.w));
+    const ai_real d1 = std::sqrt((a.x + b.x) * (a.x + b.x) + (a.y + b.y) * (a.y + b.y) + (a.z + b.z) * (a.z + b.z) + (a.w + b.w) * (a.w + b.w));
+    return 4 * std::asin(std::min(std::min(d0, d1) / 2, ai_real(1)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether a value reproduces a key within the given error. Differences
+// in the range of the float precision are always accepted.
+bool IsReproduced(const aiVector3D& value, const aiVector3D& key, ai_real maxError)
+{
+    return Error(value, key) <= maxError + RoundingError * std::max(key.Length(), ai_real(1));
+}
+
+bool IsReproduced(const aiQuaternion& value, const aiQuaternion& key, ai_real maxError)
+{
+    return Error(value, key) <= maxError + RoundingError;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether interpolating between the keys first and last reproduces all keys in between
+template <typename Key>
+bool IsRedundant(const Key* keys, unsigned int first, unsigned int last, ai_real maxError)
+{
+    const Key& a = keys[first];
+    const Key& b = keys[last];
+
+    for (unsigned int i = first + 1; i < last; ++i) {
+        if (!IsReproduced(Interpolate(a, b, keys[i].mTime), keys[i].mValue, maxError)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replaces the keys of a track
+template <typename Key>
+void SetKeys(Key*& keys, unsigned int& num, const std::vector<Key>& out)
+{
+    delete[] keys;
+    num = static_cast<unsigned int>(out.size());
+    keys = new Key[num];
+    std::copy(out.begin(), out.end(), keys);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Removes all keys interpolation of the remaining ones reproduces within maxError
+template <typename Key>
+void ReduceKeys(Key*& keys, unsigned int& num, ai_real maxError)
+{
+    if (num < 2) {
+        return;
+    }
+
+    // a constant track needs a single key
+    std::vector<Key> out;
+    out.push_back(keys[0]);
+    bool constant = true;
+    for (unsigned int i = 1; i < num && constant; ++i) {
+        constant = IsReproduced(keys[0].mValue, keys[i].mValue, maxError);
+    }
+
+    // otherwise grow each segment as long as it covers the keys in between.
+    // The length of the segments is limited to keep this linear in the
+    // number of keys, long linear sections keep a key every MaxSegmentKeys.
+    if (!constant) {
+        unsigned int anchor = 0;
+        for (unsigned int i = 2; i < num; ++i) {
+            if (i - anchor > MaxSegmentKeys || !IsRedundant(keys, anchor, i, maxError)) {
+                anchor = i - 1;
+                out.push_back(keys[anchor]);
+            }
+        }
+        out.push_back(keys[num - 1]);
+    }
+    if (out.size() < num) {
+        SetKeys(keys, num, out);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replaces the keys of a track by samples in fixed intervals
+template <typename Key>
+void ResampleKeys(Key*& keys, unsigned int& num, double step)
+{
+    if (num < 2) {
+        return;
+    }
+    const double start = keys[0].mTime, end = keys[num - 1].mTime;
+    if (!(end > start) || (end - start) / step > 1e8) {
+        return;
+    }
+
+    std::vector<Key> out;
+    out.push_back(keys[0]);
+    unsigned int segment = 0;
+    for (unsigned int k = 1; ; ++k) {
+        const double time = start + k * step;
+
+        // don't put a sample right before the last key
+        if (time >= end - step * 1e-3) {
+            break;
+        }
+        while (segment + 2 < num && keys[segment + 1].mTime <= time) {
+            ++segment;
+        }
+        Key key;
+        key.mTime = time;
+        key.mValue = Interpolate(keys[segment], keys[segment + 1], time);
+        out.push_back(key);
+    }
+    out.push_back(keys[num - 1]);
+    SetKeys(keys, num, out);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+OptimizeAnimationsProcess::OptimizeAnimationsProcess()
+: configEnable(false)
+, configPositionError(0)
+, configRotationError(0)
+, configScalingError(0)
+, configResampleRate(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Destructor, private as well
+OptimizeAnimationsProcess::~OptimizeAnimationsProcess()
+{
+    // nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool OptimizeAnimationsProcess::IsActive( unsigned int /*pFlags*/) const
+{
+    // there is no flag, see IsRequested()
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the key reduction has been requested through AI_CONFIG_PP_OA_ENABLE
+bool OptimizeAnimationsProcess::IsRequested( const Importer* pImp) const
+{
+    return pImp->GetPropertyBool(AI_CONFIG_PP_OA_ENABLE, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void OptimizeAnimationsProcess::SetupProperties(const Importer* pImp)
+{
+    configEnable = pImp->GetPropertyBool(AI_CONFIG_PP_OA_ENABLE, false);
+    SetErrors(pImp->GetPropertyFloat(AI_CONFIG_PP_OA_POSITION_ERROR, 0.f),
+        pImp->GetPropertyFloat(AI_CONFIG_PP_OA_ROTATION_ERROR, 0.f),
+        pImp->GetPropertyFloat(AI_CONFIG_PP_OA_SCALING_ERROR, 0.f));
+    SetResampleRate(pImp->GetPropertyFloat(AI_CONFIG_PP_OA_RESAMPLE_RATE, 0.f));
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsProcess::SetErrors( ai_real position, ai_real rotation, ai_real scaling)
+{
+    configPositionError = std::max(position, ai_real(0));
+    configRotationError = AI_DEG_TO_RAD(std::max(rotation, ai_real(0)));
+    configScalingError = std::max(scaling, ai_real(0));
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsProcess::SetResampleRate( ai_real rate)
+{
+    configResampleRate = std::max(rate, ai_real(0));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void OptimizeAnimationsProcess::Execute( aiScene* pScene)
+{
+    if (!configEnable) {
+        return;
+    }
+    ASSIMP_LOG_DEBUG("OptimizeAnimationsProcess begin");
+
+    std::vector<std::pair<aiNodeAnim*, double> > channels;
+    for (unsigned int a = 0; a < pScene->mNumAnimations; ++a) {
+        const aiAnimation* anim = pScene->mAnimations[a];
+        for (unsigned int i = 0; i < anim->mNumChannels; ++i) {
+            channels.push_back(std::make_pair(anim->mChannels[i], anim->mTicksPerSecond));
+        }
+    }
+
+    size_t numKeys = 0;
+    for (const auto& channel : channels) {
+        numKeys += channel.first->mNumPositionKeys + channel.first->mNumRotationKeys + channel.first->mNumScalingKeys;
+    }
+
+    const std::function<void(unsigned int)> job = [&](unsigned int i) {
+        ProcessChannel(channels[i].first, channels[i].second);
+    };
+    if (threadPool) {
+        threadPool->ParallelFor(static_cast<unsigned int>(channels.size()), job);
+    }
+    else for (unsigned int i = 0; i < channels.size(); ++i) {
+        job(i);
+    }
+
+    size_t numOutKeys = 0;
+    for (const auto& channel : channels) {
+        numOutKeys += channel.first->mNumPositionKeys + channel.first->mNumRotationKeys + channel.first->mNumScalingKeys;
+    }
+    if (numOutKeys != numKeys) {
+        ASSIMP_LOG_INFO_F("OptimizeAnimationsProcess finished. Reduced ", numKeys, " animation keys to ", numOutKeys);
+    }
+    else {
+        ASSIMP_LOG_DEBUG("OptimizeAnimationsProcess finished. No redundant animation keys found");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reduces the keys of a specific channel
+void OptimizeAnimationsProcess::ProcessChannel( aiNodeAnim* pChannel, double ticksPerSecond) const
+{
+    ai_assert(nullptr != pChannel);
+
+    if (configResampleRate > 0 && ticksPerSecond > 0) {
+        const double step = ticksPerSecond / configResampleRate;
+        ResampleKeys(pChannel->mPositionKeys, pChannel->mNumPositionKeys, step);
+        ResampleKeys(pChannel->mRotationKeys, pChannel->mNumRotationKeys, step);
+        ResampleKeys(pChannel->mScalingKeys, pChannel->mNumScalingKeys, step);
+    }
+
+    ReduceKeys(pChannel->mPositionKeys, pChannel->mNumPositionKeys, configPositionError);
+    ReduceKeys(pChannel->mRotationKeys, pChannel->mNumRotationKeys, configRotationError);
+    ReduceKeys(pChannel->mScalingKeys, pChannel->mNumScalingKeys, configScalingError);
+}
@@ -0,0 +1,126 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Defines a post processing step to remove redundant animation keys */
+#ifndef AI_OPTIMIZEANIMATIONSPROCESS_H_INC
+#define AI_OPTIMIZEANIMATIONSPROCESS_H_INC
+
+#include "BaseProcess.h"
+#include <assimp/types.h>
+
+struct aiAnimation;
+struct aiNodeAnim;
+
+namespace Assimp
+{
+
+// ---------------------------------------------------------------------------
+/** The OptimizeAnimationsProcess reduces the keys of all node animation
+ *  channels to those needed to reproduce the channel within a configurable
+ *  error. Channels may be resampled to a fixed rate first.
+ *
+ *  There is no post processing flag of its own left, the step runs whenever
+ *  #AI_CONFIG_PP_OA_ENABLE is set.
+ */
+class ASSIMP_API OptimizeAnimationsProcess : public BaseProcess
+{
+public:
+
+    OptimizeAnimationsProcess();
+    ~OptimizeAnimationsProcess();
+
+public:
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is active
+    bool IsActive( unsigned int pFlags) const;
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is enabled by the importer's properties
+    bool IsRequested( const Importer* pImp) const;
+
+    // -------------------------------------------------------------------
+    // Executes the pp step on a given scene
+    void Execute( aiScene* pScene);
+
+    // -------------------------------------------------------------------
+    // Configures the pp step
+    void SetupProperties(const Importer* pImp);
+
+    // -------------------------------------------------------------------
+    /** Reduces the keys of a single animation channel.
+     * @param pChannel The channel to process.
+     * @param ticksPerSecond Tick rate of the animation, 0 if unknown. */
+    void ProcessChannel( aiNodeAnim* pChannel, double ticksPerSecond) const;
+
+    // -------------------------------------------------------------------
+    /** Sets the maximum errors, these are otherwise configured by
+     *  #AI_CONFIG_PP_OA_POSITION_ERROR, #AI_CONFIG_PP_OA_ROTATION_ERROR
+     *  and #AI_CONFIG_PP_OA_SCALING_ERROR.
+     *  @param rotation Maximum rotation error, in degrees */
+    void SetErrors( ai_real position, ai_real rotation, ai_real scaling);
+
+    // -------------------------------------------------------------------
+    /** Sets the rate to resample to, in keys per second. 0 disables
+     *  resampling. */
+    void SetResampleRate( ai_real rate);
+
+private:
+    //! Configuration parameter: reduce the keys at all?
+    bool configEnable;
+
+    //! Configuration parameter: maximum position error
+    ai_real configPositionError;
+
+    //! Configuration parameter: maximum rotation error, in radians
+    ai_real configRotationError;
+
+    //! Configuration parameter: maximum scaling error
+    ai_real configScalingError;
+
+    //! Configuration parameter: keys per second to resample to
+    ai_real configResampleRate;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_OPTIMIZEANIMATIONSPROCESS_H_INC
@@ -144,11 +144,28 @@ void OptimizeMeshesProcess::Execute( aiScene* pScene)
         throw DeadlyImportError("OptimizeMeshes: No meshes remaining; there's definitely something wrong");
     }
 
+    // levels of detail aren't referenced by any node, keep them after the other meshes
+    for (size_t i = 0, end = output.size(); i < end; ++i) {
+        const aiMesh* mesh = output[i];
+        for (unsigned int a = 0; a < mesh->mNumLODs; ++a) {
+            const unsigned int lod = mesh->mLODs[a];
+            if (lod < num_old && meshes[lod].output_id == NotSet) {
+                meshes[lod].output_id = static_cast<unsigned int>(output.size());
+                output.push_back(mScene->mMeshes[lod]);
+            }
+        }
+    }
+
+    std::vector<unsigned int> mapping(num_old);
+    for (unsigned int i = 0; i < num_old; ++i) {
+        mapping[i] = meshes[i].output_id;
+    }
     meshes.resize( 0 );
     ai_assert(output.size() <= num_old);
 
     mScene->mNumMeshes = static_cast<unsigned int>(output.size());
     std::copy(output.begin(),output.end(),mScene->mMeshes);
+    UpdateMeshLODs(mScene,&mapping[0],num_old);
 
     if (output.size() != num_old) {
         ASSIMP_LOG_DEBUG_F("OptimizeMeshesProcess finished. Input meshes: ", num_old, ", Output meshes: ", pScene->mNumMeshes);
@@ -194,6 +211,7 @@ void OptimizeMeshesProcess::ProcessNode( aiNode* pNode)
                 SceneCombiner::MergeMeshes(&out,0,merge_list.begin(),merge_list.end());
                 output.push_back(out);
             } else {
+                meshes[im].output_id = static_cast<unsigned int>(output.size());
                 output.push_back(mScene->mMeshes[im]);
             }
             im = static_cast<unsigned int>(output.size()-1);
@@ -224,6 +242,10 @@ bool OptimizeMeshesProcess::CanJoin ( unsigned int a, unsigned int b, unsigned i
     if (ma->mMaterialIndex != mb->mMaterialIndex || ma->HasBones() != mb->HasBones())
         return false;
 
+    // The levels of detail belong to a single mesh
+    if (ma->HasLODs() || mb->HasLODs())
+        return false;
+
     // Never merge meshes with different kinds of primitives if SortByPType did already
     // do its work. We would destroy everything again ...
     if (pts && ma->mPrimitiveTypes != mb->mPrimitiveTypes)
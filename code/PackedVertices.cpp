@@ -0,0 +1,489 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file PackedVertices.cpp
+ *  @brief Implementation of the quantized vertex layout
+ */
+
+#include <assimp/PackedVertices.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// IEEE 754 half precision conversions, rounding to nearest even
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const int exponent = static_cast<int>((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (((bits >> 23) & 0xff) == 0xff) {
+        // infinity or NaN
+        return static_cast<uint16_t>(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+    }
+    if (exponent >= 0x1f) {
+        return static_cast<uint16_t>(sign | 0x7c00);
+    }
+    if (exponent <= 0) {
+        // denormalized half or zero
+        if (exponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000;
+        const unsigned int shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1))) {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // a carry out of the mantissa correctly bumps the exponent
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t rest = mantissa & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float HalfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1f;
+    const uint32_t mantissa = half & 0x3ff;
+
+    if (exponent == 0) {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    }
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    float value;
+    ::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Unsigned normalized integers
+uint16_t ToUnorm16(ai_real value, ai_real min, ai_real scale) {
+    if (scale <= 0) {
+        return 0;
+    }
+    const ai_real q = std::floor((value - min) / scale + ai_real(0.5));
+    return static_cast<uint16_t>(std::min(std::max(q, ai_real(0)), ai_real(65535)));
+}
+
+uint8_t ToUnorm8(ai_real value) {
+    const ai_real q = std::floor(value * 255 + ai_real(0.5));
+    return static_cast<uint8_t>(std::min(std::max(q, ai_real(0)), ai_real(255)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Octahedral encoding of unit vectors, the octants of the lower hemisphere
+// are folded onto the corners of the square
+void EncodeOctahedral(const aiVector3D& v, int16_t* out) {
+    const ai_real l1 = std::fabs(v.x) + std::fabs(v.y) + std::fabs(v.z);
+    if (l1 <= 0) {
+        out[0] = out[1] = 0;
+        return;
+    }
+    ai_real x = v.x / l1, y = v.y / l1;
+    if (v.z < 0) {
+        const ai_real fx = (1 - std::fabs(y)) * (x >= 0 ? 1 : -1);
+        const ai_real fy = (1 - std::fabs(x)) * (y >= 0 ? 1 : -1);
+        x = fx;
+        y = fy;
+    }
+    out[0] = static_cast<int16_t>(std::floor(std::min(std::max(x, ai_real(-1)), ai_real(1)) * 32767 + ai_real(0.5)));
+    out[1] = static_cast<int16_t>(std::floor(std::min(std::max(y, ai_real(-1)), ai_real(1)) * 32767 + ai_real(0.5)));
+}
+
+aiVector3D DecodeOctahedral(const int16_t* in) {
+    ai_real x = in[0] / ai_real(32767), y = in[1] / ai_real(32767);
+    const ai_real z = 1 - std::fabs(x) - std::fabs(y);
+    const ai_real t = std::max(-z, ai_real(0));
+    x += x >= 0 ? -t : t;
+    y += y >= 0 ? -t : t;
+    return aiVector3D(x, y, z).Normalize();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decoding of the streams of a single packed vertex
+const unsigned char* PackedVertex(const aiMesh* mesh, unsigned int vertex) {
+    return static_cast<const unsigned char*>(mesh->mPackedVertices) + size_t(vertex) * mesh->mPackedLayout.mStride;
+}
+
+aiVector3D DecodePosition(const aiMesh* mesh, unsigned int vertex) {
+    const aiPackedVertexLayout& layout = mesh->mPackedLayout;
+    const uint16_t* q = reinterpret_cast<const uint16_t*>(PackedVertex(mesh, vertex) + layout.mPositionOffset);
+    return aiVector3D(layout.mPositionMin.x + q[0] * layout.mPositionScale.x,
+        layout.mPositionMin.y + q[1] * layout.mPositionScale.y,
+        layout.mPositionMin.z + q[2] * layout.mPositionScale.z);
+}
+
+aiVector3D DecodeDirection(const aiMesh* mesh, unsigned int vertex, unsigned int offset) {
+    return DecodeOctahedral(reinterpret_cast<const int16_t*>(PackedVertex(mesh, vertex) + offset));
+}
+
+aiVector3D DecodeTexCoords(const aiMesh* mesh, unsigned int channel, unsigned int vertex) {
+    const aiPackedVertexLayout& layout = mesh->mPackedLayout;
+    const uint16_t* q = reinterpret_cast<const uint16_t*>(PackedVertex(mesh, vertex) + layout.mTexCoordOffset[channel]);
+    if (layout.mStreams & aiPackedVertexStream_HalfTexCoords) {
+        return aiVector3D(HalfToFloat(q[0]), HalfToFloat(q[1]), 0);
+    }
+    return aiVector3D(layout.mTexCoordMin[channel].x + q[0] * layout.mTexCoordScale[channel].x,
+        layout.mTexCoordMin[channel].y + q[1] * layout.mTexCoordScale[channel].y, 0);
+}
+
+aiColor4D DecodeColor(const aiMesh* mesh, unsigned int set, unsigned int vertex) {
+    const uint8_t* q = PackedVertex(mesh, vertex) + mesh->mPackedLayout.mColorOffset[set];
+    return aiColor4D(q[0] / ai_real(255), q[1] / ai_real(255), q[2] / ai_real(255), q[3] / ai_real(255));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bounding box of a vertex array, as minimum and scale of the 16 bit quantization
+void ComputeQuantization(const aiVector3D* values, unsigned int num, aiVector3D& min, aiVector3D& scale) {
+    min = values[0];
+    aiVector3D max = values[0];
+    for (unsigned int i = 1; i < num; ++i) {
+        min.x = std::min(min.x, values[i].x);
+        min.y = std::min(min.y, values[i].y);
+        min.z = std::min(min.z, values[i].z);
+        max.x = std::max(max.x, values[i].x);
+        max.y = std::max(max.y, values[i].y);
+        max.z = std::max(max.z, values[i].z);
+    }
+    scale = (max - min) / ai_real(65535);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool BuildPackedVertices(aiMesh* mesh, unsigned int streams) {
+    if (nullptr == mesh || mesh->mPackedVertices || 0 == mesh->mNumVertices) {
+        return false;
+    }
+    if (streams & aiPackedVertexStream_HalfTexCoords) {
+        streams |= aiPackedVertexStream_TexCoords;
+    }
+
+    // 16 bit texture coordinates only hold two components
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+        if (mesh->HasTextureCoords(a) && mesh->mNumUVComponents[a] > 2) {
+            streams &= ~(aiPackedVertexStream_TexCoords | aiPackedVertexStream_HalfTexCoords);
+        }
+    }
+
+    // assign the offsets, all entries are 4 byte aligned
+    aiPackedVertexLayout layout;
+    unsigned int stride = 0;
+    if ((streams & aiPackedVertexStream_Positions) && mesh->HasPositions()) {
+        layout.mPositionOffset = stride;
+        stride += 8;
+        layout.mStreams |= aiPackedVertexStream_Positions;
+    }
+    if (streams & aiPackedVertexStream_Normals) {
+        if (mesh->HasNormals()) {
+            layout.mNormalOffset = stride;
+            stride += 4;
+            layout.mStreams |= aiPackedVertexStream_Normals;
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            layout.mTangentOffset = stride;
+            layout.mBitangentOffset = stride + 4;
+            stride += 8;
+            layout.mStreams |= aiPackedVertexStream_Normals;
+        }
+    }
+    if (streams & aiPackedVertexStream_TexCoords) {
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+            if (mesh->HasTextureCoords(a)) {
+                layout.mTexCoordOffset[a] = stride;
+                stride += 4;
+                layout.mStreams |= streams & (aiPackedVertexStream_TexCoords | aiPackedVertexStream_HalfTexCoords);
+            }
+        }
+    }
+    if (streams & aiPackedVertexStream_Colors) {
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+            if (mesh->HasVertexColors(a)) {
+                layout.mColorOffset[a] = stride;
+                stride += 4;
+                layout.mStreams |= aiPackedVertexStream_Colors;
+            }
+        }
+    }
+    if (0 == stride) {
+        return false;
+    }
+    layout.mStride = stride;
+
+    const unsigned int n = mesh->mNumVertices;
+    unsigned int* buffer = new unsigned int[size_t(n) * (stride / 4)];
+    unsigned char* data = reinterpret_cast<unsigned char*>(buffer);
+
+    if (layout.mPositionOffset != AI_PACKED_VERTEX_NONE) {
+        ComputeQuantization(mesh->mVertices, n, layout.mPositionMin, layout.mPositionScale);
+        for (unsigned int i = 0; i < n; ++i) {
+            uint16_t* q = reinterpret_cast<uint16_t*>(data + size_t(i) * stride + layout.mPositionOffset);
+            q[0] = ToUnorm16(mesh->mVertices[i].x, layout.mPositionMin.x, layout.mPositionScale.x);
+            q[1] = ToUnorm16(mesh->mVertices[i].y, layout.mPositionMin.y, layout.mPositionScale.y);
+            q[2] = ToUnorm16(mesh->mVertices[i].z, layout.mPositionMin.z, layout.mPositionScale.z);
+            q[3] = 0;
+        }
+        delete[] mesh->mVertices;
+        mesh->mVertices = nullptr;
+    }
+
+    aiVector3D** directions[] = { &mesh->mNormals, &mesh->mTangents, &mesh->mBitangents };
+    const unsigned int directionOffsets[] = { layout.mNormalOffset, layout.mTangentOffset, layout.mBitangentOffset };
+    for (unsigned int d = 0; d < 3; ++d) {
+        if (directionOffsets[d] == AI_PACKED_VERTEX_NONE) {
+            continue;
+        }
+        for (unsigned int i = 0; i < n; ++i) {
+            EncodeOctahedral((*directions[d])[i], reinterpret_cast<int16_t*>(data + size_t(i) * stride + directionOffsets[d]));
+        }
+        delete[] *directions[d];
+        *directions[d] = nullptr;
+    }
+
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+        if (layout.mTexCoordOffset[a] == AI_PACKED_VERTEX_NONE) {
+            continue;
+        }
+        const aiVector3D* uv = mesh->mTextureCoords[a];
+        if (layout.mStreams & aiPackedVertexStream_HalfTexCoords) {
+            for (unsigned int i = 0; i < n; ++i) {
+                uint16_t* q = reinterpret_cast<uint16_t*>(data + size_t(i) * stride + layout.mTexCoordOffset[a]);
+                q[0] = FloatToHalf(static_cast<float>(uv[i].x));
+                q[1] = FloatToHalf(static_cast<float>(uv[i].y));
+            }
+        } else {
+            ComputeQuantization(uv, n, layout.mTexCoordMin[a], layout.mTexCoordScale[a]);
+            layout.mTexCoordMin[a].z = layout.mTexCoordScale[a].z = 0;
+            for (unsigned int i = 0; i < n; ++i) {
+                uint16_t* q = reinterpret_cast<uint16_t*>(data + size_t(i) * stride + layout.mTexCoordOffset[a]);
+                q[0] = ToUnorm16(uv[i].x, layout.mTexCoordMin[a].x, layout.mTexCoordScale[a].x);
+                q[1] = ToUnorm16(uv[i].y, layout.mTexCoordMin[a].y, layout.mTexCoordScale[a].y);
+            }
+        }
+        delete[] mesh->mTextureCoords[a];
+        mesh->mTextureCoords[a] = nullptr;
+    }
+
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+        if (layout.mColorOffset[a] == AI_PACKED_VERTEX_NONE) {
+            continue;
+        }
+        for (unsigned int i = 0; i < n; ++i) {
+            uint8_t* q = data + size_t(i) * stride + layout.mColorOffset[a];
+            const aiColor4D& c = mesh->mColors[a][i];
+            q[0] = ToUnorm8(c.r);
+            q[1] = ToUnorm8(c.g);
+            q[2] = ToUnorm8(c.b);
+            q[3] = ToUnorm8(c.a);
+        }
+        delete[] mesh->mColors[a];
+        mesh->mColors[a] = nullptr;
+    }
+
+    mesh->mPackedLayout = layout;
+    mesh->mPackedVertices = buffer;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExpandPackedVertices(aiMesh* mesh) {
+    if (nullptr == mesh || nullptr == mesh->mPackedVertices) {
+        return;
+    }
+
+    const aiPackedVertexLayout& layout = mesh->mPackedLayout;
+    const unsigned int n = mesh->mNumVertices;
+    if (layout.mPositionOffset != AI_PACKED_VERTEX_NONE) {
+        delete[] mesh->mVertices;
+        mesh->mVertices = new aiVector3D[n];
+        for (unsigned int i = 0; i < n; ++i) {
+            mesh->mVertices[i] = DecodePosition(mesh, i);
+        }
+    }
+
+    aiVector3D** directions[] = { &mesh->mNormals, &mesh->mTangents, &mesh->mBitangents };
+    const unsigned int directionOffsets[] = { layout.mNormalOffset, layout.mTangentOffset, layout.mBitangentOffset };
+    for (unsigned int d = 0; d < 3; ++d) {
+        if (directionOffsets[d] == AI_PACKED_VERTEX_NONE) {
+            continue;
+        }
+        delete[] *directions[d];
+        *directions[d] = new aiVector3D[n];
+        for (unsigned int i = 0; i < n; ++i) {
+            (*directions[d])[i] = DecodeDirection(mesh, i, directionOffsets[d]);
+        }
+    }
+
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+        if (layout.mTexCoordOffset[a] != AI_PACKED_VERTEX_NONE) {
+            delete[] mesh->mTextureCoords[a];
+            mesh->mTextureCoords[a] = new aiVector3D[n];
+            for (unsigned int i = 0; i < n; ++i) {
+                mesh->mTextureCoords[a][i] = DecodeTexCoords(mesh, a, i);
+            }
+        }
+    }
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+        if (layout.mColorOffset[a] != AI_PACKED_VERTEX_NONE) {
+            delete[] mesh->mColors[a];
+            mesh->mColors[a] = new aiColor4D[n];
+            for (unsigned int i = 0; i < n; ++i) {
+                mesh->mColors[a][i] = DecodeColor(mesh, a, i);
+            }
+        }
+    }
+
+    delete[] static_cast<unsigned int*>(mesh->mPackedVertices);
+    mesh->mPackedVertices = nullptr;
+    mesh->mPackedLayout = aiPackedVertexLayout();
+}
+
+// ------------------------------------------------------------------------------------------------
+void BuildPackedVertices(aiScene* scene, unsigned int streams) {
+    for (unsigned int i = 0; scene && scene->mMeshes && i < scene->mNumMeshes; ++i) {
+        BuildPackedVertices(scene->mMeshes[i], streams);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExpandPackedVertices(aiScene* scene) {
+    for (unsigned int i = 0; scene && scene->mMeshes && i < scene->mNumMeshes; ++i) {
+        ExpandPackedVertices(scene->mMeshes[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D GetVertexPosition(const aiMesh* mesh, unsigned int vertex) {
+    if (mesh->mVertices) {
+        return mesh->mVertices[vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mPositionOffset != AI_PACKED_VERTEX_NONE) {
+        return DecodePosition(mesh, vertex);
+    }
+    return aiVector3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D GetVertexNormal(const aiMesh* mesh, unsigned int vertex) {
+    if (mesh->mNormals) {
+        return mesh->mNormals[vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mNormalOffset != AI_PACKED_VERTEX_NONE) {
+        return DecodeDirection(mesh, vertex, mesh->mPackedLayout.mNormalOffset);
+    }
+    return aiVector3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D GetVertexTangent(const aiMesh* mesh, unsigned int vertex) {
+    if (mesh->mTangents) {
+        return mesh->mTangents[vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mTangentOffset != AI_PACKED_VERTEX_NONE) {
+        return DecodeDirection(mesh, vertex, mesh->mPackedLayout.mTangentOffset);
+    }
+    return aiVector3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D GetVertexBitangent(const aiMesh* mesh, unsigned int vertex) {
+    if (mesh->mBitangents) {
+        return mesh->mBitangents[vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mBitangentOffset != AI_PACKED_VERTEX_NONE) {
+        return DecodeDirection(mesh, vertex, mesh->mPackedLayout.mBitangentOffset);
+    }
+    return aiVector3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D GetVertexTextureCoords(const aiMesh* mesh, unsigned int channel, unsigned int vertex) {
+    if (channel >= AI_MAX_NUMBER_OF_TEXTURECOORDS) {
+        return aiVector3D();
+    }
+    if (mesh->mTextureCoords[channel]) {
+        return mesh->mTextureCoords[channel][vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mTexCoordOffset[channel] != AI_PACKED_VERTEX_NONE) {
+        return DecodeTexCoords(mesh, channel, vertex);
+    }
+    return aiVector3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiColor4D GetVertexColor(const aiMesh* mesh, unsigned int set, unsigned int vertex) {
+    if (set >= AI_MAX_NUMBER_OF_COLOR_SETS) {
+        return aiColor4D();
+    }
+    if (mesh->mColors[set]) {
+        return mesh->mColors[set][vertex];
+    }
+    if (mesh->mPackedVertices && mesh->mPackedLayout.mColorOffset[set] != AI_PACKED_VERTEX_NONE) {
+        return DecodeColor(mesh, set, vertex);
+    }
+    return aiColor4D();
+}
+
+} // Namespace Assimp
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "PlyLoader.h"
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/ByteSwapper.h>
 #include <assimp/Macros.h>
 #include <memory>
 #include <assimp/IOSystem.hpp>
@@ -85,6 +86,87 @@ namespace {
 
         return props[idx];
     }
+
+    // ------------------------------------------------------------------------------------------------
+    // Normalize a color component to [0...1], depending on its binary type
+    inline ai_real NormalizeColor(float v)    { return v; }
+    inline ai_real NormalizeColor(double v)   { return (ai_real)v; }
+    inline ai_real NormalizeColor(uint8_t v)  { return (ai_real)v / (ai_real)0xFF; }
+    inline ai_real NormalizeColor(int8_t v)   { return (ai_real)(v + (0xFF / 2)) / (ai_real)0xFF; }
+    inline ai_real NormalizeColor(uint16_t v) { return (ai_real)v / (ai_real)0xFFFF; }
+    inline ai_real NormalizeColor(int16_t v)  { return (ai_real)(v + (0xFFFF / 2)) / (ai_real)0xFFFF; }
+    inline ai_real NormalizeColor(uint32_t v) { return (ai_real)v / (ai_real)0xFFFF; }
+    inline ai_real NormalizeColor(int32_t v)  { return ((ai_real)v / (ai_real)0xFF) + 0.5f; }
+
+    // ------------------------------------------------------------------------------------------------
+    // Read a binary value, the byte order is fixed at compile time
+    template <typename T, bool Swap>
+    inline T ReadBinary(const char* src) {
+        T t;
+        ::memcpy(&t, src, sizeof(T));
+        Intern::ByteSwapper<T, (Swap && sizeof(T) > 1)>()(&t);
+        return t;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Readers for the steps of a vertex decode plan, specialized per binary type and byte order
+    typedef void (*BinaryReader)(const char* src, ai_real* dst);
+
+    template <typename T, bool Swap>
+    struct RealReader {
+        static void Read(const char* src, ai_real* dst) {
+            *dst = (ai_real)ReadBinary<T, Swap>(src);
+        }
+    };
+
+    // three consecutive components of the same type, e.g. float x,y,z
+    template <typename T, bool Swap>
+    struct Real3Reader {
+        static void Read(const char* src, ai_real* dst) {
+            dst[0] = (ai_real)ReadBinary<T, Swap>(src);
+            dst[1] = (ai_real)ReadBinary<T, Swap>(src + sizeof(T));
+            dst[2] = (ai_real)ReadBinary<T, Swap>(src + 2 * sizeof(T));
+        }
+    };
+
+    template <typename T, bool Swap>
+    struct ColorReader {
+        static void Read(const char* src, ai_real* dst) {
+            *dst = NormalizeColor(ReadBinary<T, Swap>(src));
+        }
+    };
+
+    template <template <typename, bool> class Reader, bool Swap>
+    BinaryReader SelectReader(PLY::EDataType eType) {
+        switch (eType) {
+            case EDT_Char:   return &Reader<int8_t, Swap>::Read;
+            case EDT_UChar:  return &Reader<uint8_t, Swap>::Read;
+            case EDT_Short:  return &Reader<int16_t, Swap>::Read;
+            case EDT_UShort: return &Reader<uint16_t, Swap>::Read;
+            case EDT_Int:    return &Reader<int32_t, Swap>::Read;
+            case EDT_UInt:   return &Reader<uint32_t, Swap>::Read;
+            case EDT_Float:  return &Reader<float, Swap>::Read;
+            case EDT_Double: return &Reader<double, Swap>::Read;
+            default:
+                break;
+        }
+        return nullptr;
+    }
+
+    template <template <typename, bool> class Reader>
+    BinaryReader SelectReader(PLY::EDataType eType, bool p_bBE) {
+        return p_bBE ? SelectReader<Reader, true>(eType) : SelectReader<Reader, false>(eType);
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // One step of a vertex decode plan: read the value(s) at a fixed offset
+    // in the record and store them to an output array of ai_real
+    struct DecodeStep {
+        unsigned int offset;
+        BinaryReader read;
+        ai_real* dest;
+        unsigned int stride;
+    };
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -476,26 +558,206 @@ void PLYImporter::LoadVertex(const PLY::Element* pcElement, const PLY::ElementIn
 }
 
 
+// ------------------------------------------------------------------------------------------------
+bool PLYImporter::LoadVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const PLY::Element* pcElement, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+
+    // a second vertex element is left to LoadVertex()
+    if (nullptr != mGeneratedMesh && nullptr != mGeneratedMesh->mVertices) {
+        return false;
+    }
+
+    // x y z, nx ny nz, r g b a, u v
+    static const PLY::ESemantic channels[] = {
+        PLY::EST_XCoord, PLY::EST_YCoord, PLY::EST_ZCoord,
+        PLY::EST_XNormal, PLY::EST_YNormal, PLY::EST_ZNormal,
+        PLY::EST_Red, PLY::EST_Green, PLY::EST_Blue, PLY::EST_Alpha,
+        PLY::EST_UTextureCoord, PLY::EST_VTextureCoord
+    };
+    static const unsigned int numChannels = sizeof(channels) / sizeof(channels[0]);
+
+    // byte offset of each channel within a record
+    unsigned int offsets[numChannels];
+    PLY::EDataType types[numChannels];
+    std::fill(offsets, offsets + numChannels, 0xFFFFFFFF);
+    std::fill(types, types + numChannels, EDT_Char);
+
+    unsigned int recordSize = 0, cnt = 0;
+    for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
+            a != pcElement->alProperties.end(); ++a) {
+        const unsigned int size = PLY::PropertyInstance::BinarySize((*a).eType);
+        if ((*a).bIsList || 0 == size) {
+            return false;
+        }
+
+        for (unsigned int c = 0; c < numChannels; ++c) {
+            if (channels[c] == (*a).Semantic) {
+                offsets[c] = recordSize;
+                types[c] = (*a).eType;
+                ++cnt;
+            }
+        }
+        recordSize += size;
+    }
+
+    if (0 == recordSize) {
+        return true;
+    }
+
+    // allocate the mesh up front, the vertex count is known from the header
+    aiMesh* mesh = nullptr;
+    if (0 != cnt && 0 != pcElement->NumOccur) {
+        if (nullptr == mGeneratedMesh) {
+            mGeneratedMesh = new aiMesh();
+            mGeneratedMesh->mMaterialIndex = 0;
+        }
+        mesh = mGeneratedMesh;
+
+        mesh->mNumVertices = pcElement->NumOccur;
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        if (0xFFFFFFFF != offsets[3] || 0xFFFFFFFF != offsets[4] || 0xFFFFFFFF != offsets[5]) {
+            mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+        }
+        if (0xFFFFFFFF != offsets[6] || 0xFFFFFFFF != offsets[7] ||
+                0xFFFFFFFF != offsets[8] || 0xFFFFFFFF != offsets[9]) {
+            mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+        }
+        if (0xFFFFFFFF != offsets[10] || 0xFFFFFFFF != offsets[11]) {
+            mesh->mNumUVComponents[0] = 2;
+            mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+        }
+    }
+
+    // Build the decode plan once from the header: one step per channel, or
+    // one per vector if its three components share a type and are packed
+    std::vector<DecodeStep> plan;
+    if (nullptr != mesh) {
+        ai_real* const targets[] = {
+            &mesh->mVertices[0].x, mesh->mNormals ? &mesh->mNormals[0].x : nullptr,
+            mesh->mColors[0] ? &mesh->mColors[0][0].r : nullptr,
+            mesh->mTextureCoords[0] ? &mesh->mTextureCoords[0][0].x : nullptr
+        };
+        static const unsigned int firstChannel[] = { 0, 3, 6, 10, 12 };
+        static const unsigned int strides[] = { 3, 3, 4, 3 };
+
+        for (unsigned int t = 0; t < 4; ++t) {
+            const unsigned int c0 = firstChannel[t], numComponents = firstChannel[t + 1] - c0;
+            if (3 == numComponents && 0xFFFFFFFF != offsets[c0] &&
+                    types[c0] == types[c0 + 1] && types[c0] == types[c0 + 2] &&
+                    offsets[c0 + 1] == offsets[c0] + PLY::PropertyInstance::BinarySize(types[c0]) &&
+                    offsets[c0 + 2] == offsets[c0 + 1] + PLY::PropertyInstance::BinarySize(types[c0])) {
+                DecodeStep step = { offsets[c0], SelectReader<Real3Reader>(types[c0], p_bBE), targets[t], strides[t] };
+                plan.push_back(step);
+                continue;
+            }
+            for (unsigned int c = 0; c < numComponents; ++c) {
+                if (0xFFFFFFFF == offsets[c0 + c]) {
+                    continue;
+                }
+                DecodeStep step = { offsets[c0 + c], 2 == t ? SelectReader<ColorReader>(types[c0 + c], p_bBE) :
+                    SelectReader<RealReader>(types[c0 + c], p_bBE), targets[t] + c, strides[t] };
+                plan.push_back(step);
+            }
+        }
+
+        // assume 1.0 for the alpha channel if it is not set
+        if (nullptr != mesh->mColors[0] && 0xFFFFFFFF == offsets[9]) {
+            for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+                mesh->mColors[0][i].a = 1.0;
+            }
+        }
+    }
+
+    const DecodeStep* const planBegin = plan.empty() ? nullptr : &plan[0];
+    const DecodeStep* const planEnd = planBegin + plan.size();
+
+    unsigned int i = 0;
+    while (i < pcElement->NumOccur) {
+        // decode all complete records the current block holds at once
+        PLY::PropertyInstance::RequireBinary(streamBuffer, buffer, pCur, bufferSize, recordSize);
+        const unsigned int end = std::min(pcElement->NumOccur, i + bufferSize / recordSize);
+        for (; i < end; ++i, pCur += recordSize, bufferSize -= recordSize) {
+            for (const DecodeStep* step = planBegin; step != planEnd; ++step) {
+                step->read(pCur + step->offset, step->dest + i * step->stride);
+            }
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLYImporter::LoadFacesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const PLY::Element* pcElement, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+
+    if (1 != pcElement->alProperties.size()) {
+        return false;
+    }
+
+    const PLY::Property& prop = pcElement->alProperties.front();
+    const unsigned int countSize = PLY::PropertyInstance::BinarySize(prop.eFirstType);
+    const unsigned int indexSize = PLY::PropertyInstance::BinarySize(prop.eType);
+    if (!prop.bIsList || PLY::EST_VertexIndex != prop.Semantic || 0 == countSize || 0 == indexSize) {
+        return false;
+    }
+
+    if (0 == pcElement->NumOccur) {
+        return true;
+    }
+    if (mGeneratedMesh == nullptr) {
+        throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
+    }
+
+    // a second face element is left to LoadFace()
+    if (mGeneratedMesh->mFaces != nullptr) {
+        return false;
+    }
+
+    mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+    mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+
+    for (unsigned int i = 0; i < pcElement->NumOccur; ++i) {
+        PLY::PropertyInstance::RequireBinary(streamBuffer, buffer, pCur, bufferSize, countSize);
+        const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(
+            PLY::PropertyInstance::DecodeValueBinary(pCur, prop.eFirstType, p_bBE), prop.eFirstType);
+        pCur += countSize;
+        bufferSize -= countSize;
+
+        PLY::PropertyInstance::RequireBinary(streamBuffer, buffer, pCur, bufferSize, iNum * indexSize);
+        aiFace& face = mGeneratedMesh->mFaces[i];
+        face.mNumIndices = iNum;
+        face.mIndices = new unsigned int[iNum];
+        for (unsigned int a = 0; a < iNum; ++a, pCur += indexSize) {
+            face.mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(
+                PLY::PropertyInstance::DecodeValueBinary(pCur, prop.eType, p_bBE), prop.eType);
+        }
+        bufferSize -= iNum * indexSize;
+    }
+    return true;
+}
+
+
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
 ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
     switch (eType) {
         case EDT_Float:
-            return val.fFloat;
+            return NormalizeColor(val.fFloat);
         case EDT_Double:
-            return (ai_real)val.fDouble;
+            return NormalizeColor(val.fDouble);
         case EDT_UChar:
-            return (ai_real)val.iUInt / (ai_real)0xFF;
+            return NormalizeColor((uint8_t)val.iUInt);
         case EDT_Char:
-            return (ai_real)(val.iInt + (0xFF / 2)) / (ai_real)0xFF;
+            return NormalizeColor((int8_t)val.iInt);
         case EDT_UShort:
-            return (ai_real)val.iUInt / (ai_real)0xFFFF;
+            return NormalizeColor((uint16_t)val.iUInt);
         case EDT_Short:
-            return (ai_real)(val.iInt + (0xFFFF / 2)) / (ai_real)0xFFFF;
+            return NormalizeColor((int16_t)val.iInt);
         case EDT_UInt:
-            return (ai_real)val.iUInt / (ai_real)0xFFFF;
+            return NormalizeColor(val.iUInt);
         case EDT_Int:
-            return ((ai_real)val.iInt / (ai_real)0xFF) + 0.5f;
+            return NormalizeColor(val.iInt);
         default:
             break;
     }
@@ -87,6 +87,26 @@ public:
     */
     void LoadFace(const PLY::Element* pcElement, const PLY::ElementInstance* instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Decode a binary vertex element made of fixed-size records straight
+     *  into the mesh, block by block as the stream delivers them. A decode
+     *  plan of readers specialized for the value types and byte order is
+     *  built once from the header and run for every record.
+     *  @return false, without consuming any data, if the element has
+     *    list properties and must go through LoadVertex() instead.
+     */
+    bool LoadVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const PLY::Element* pcElement, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    /** Decode a binary face element that holds nothing but the vertex
+     *  index list straight into the mesh faces.
+     *  @return false, without consuming any data, if the element has
+     *    other properties and must go through LoadFace() instead.
+     */
+    bool LoadFacesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const PLY::Element* pcElement, bool p_bBE);
+
 protected:
 
     // -------------------------------------------------------------------
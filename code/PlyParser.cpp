@@ -740,6 +740,24 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
   // we can't skip it as a whole block (we don't know its exact size
   // due to the fact that lists could be contained in the property list
   // of the unknown element)
+
+  // vertices and faces the importer can decode in place skip the
+  // ElementInstance round trip entirely
+  if (NULL == p_pcOut)
+  {
+    ai_assert(NULL != loader);
+    if (pcElement->eSemantic == EEST_Vertex &&
+        loader->LoadVerticesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, p_bBE))
+    {
+      return true;
+    }
+    if (pcElement->eSemantic == EEST_Face &&
+        loader->LoadFacesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, p_bBE))
+    {
+      return true;
+    }
+  }
+
   for (unsigned int i = 0; i < pcElement->NumOccur; ++i)
   {
     if (p_pcOut)
@@ -981,47 +999,42 @@ bool PLY::PropertyInstance::ParseValue(const char* &pCur,
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
-  std::vector<char> &buffer,
-  const char* &pCur,
-  unsigned int &bufferSize,
-  PLY::EDataType eType,
-  PLY::PropertyInstance::ValueUnion* out,
-  bool p_bBE)
+unsigned int PLY::PropertyInstance::BinarySize(PLY::EDataType eType)
 {
-  ai_assert(NULL != out);
-
-  //calc element size
-  unsigned int lsize = 0;
   switch (eType)
   {
   case EDT_Char:
   case EDT_UChar:
-    lsize = 1;
-    break;
+    return 1;
 
   case EDT_UShort:
   case EDT_Short:
-    lsize = 2;
-    break;
+    return 2;
 
   case EDT_UInt:
   case EDT_Int:
   case EDT_Float:
-    lsize = 4;
-    break;
+    return 4;
 
   case EDT_Double:
-    lsize = 8;
-    break;
+    return 8;
 
   case EDT_INVALID:
   default:
-      break;
+    break;
   }
+  return 0;
+}
 
-  //read the next file block if needed
-  if (bufferSize < lsize)
+// ------------------------------------------------------------------------------------------------
+void PLY::PropertyInstance::RequireBinary(IOStreamBuffer<char> &streamBuffer,
+  std::vector<char> &buffer,
+  const char* &pCur,
+  unsigned int &bufferSize,
+  unsigned int numBytes)
+{
+  //read the next file block(s) if needed
+  while (bufferSize < numBytes)
   {
     std::vector<char> nbuffer;
     if (streamBuffer.getNextBlock(nbuffer))
@@ -1038,19 +1051,27 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
       throw DeadlyImportError("Invalid .ply file: File corrupted");
     }
   }
+}
 
-  bool ret = true;
+// ------------------------------------------------------------------------------------------------
+PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DecodeValueBinary(const char* pCur,
+  PLY::EDataType eType,
+  bool p_bBE)
+{
+  ai_assert(NULL != pCur);
+
+  PLY::PropertyInstance::ValueUnion out;
+  out.iUInt = 0;
   switch (eType)
   {
   case EDT_UInt:
   {
     uint32_t t;
     memcpy(&t, pCur, sizeof(uint32_t));
-    pCur += sizeof(uint32_t);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->iUInt = t;
+    out.iUInt = t;
     break;
   }
 
@@ -1058,11 +1079,10 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     uint16_t t;
     memcpy(&t, pCur, sizeof(uint16_t));
-    pCur += sizeof(uint16_t);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->iUInt = t;
+    out.iUInt = t;
     break;
   }
 
@@ -1070,8 +1090,7 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     uint8_t t;
     memcpy(&t, pCur, sizeof(uint8_t));
-    pCur += sizeof(uint8_t);
-    out->iUInt = t;
+    out.iUInt = t;
     break;
   }
 
@@ -1079,11 +1098,10 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     int32_t t;
     memcpy(&t, pCur, sizeof(int32_t));
-    pCur += sizeof(int32_t);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->iInt = t;
+    out.iInt = t;
     break;
   }
 
@@ -1091,11 +1109,10 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     int16_t t;
     memcpy(&t, pCur, sizeof(int16_t));
-    pCur += sizeof(int16_t);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->iInt = t;
+    out.iInt = t;
     break;
   }
 
@@ -1103,8 +1120,7 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     int8_t t;
     memcpy(&t, pCur, sizeof(int8_t));
-    pCur += sizeof(int8_t);
-    out->iInt = t;
+    out.iInt = t;
     break;
   }
 
@@ -1112,31 +1128,53 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
   {
     float t;
     memcpy(&t, pCur, sizeof(float));
-    pCur += sizeof(float);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->fFloat = t;
+    out.fFloat = t;
     break;
   }
   case EDT_Double:
   {
     double t;
     memcpy(&t, pCur, sizeof(double));
-    pCur += sizeof(double);
 
     // Swap endianness
     if (p_bBE)ByteSwap::Swap(&t);
-    out->fDouble = t;
+    out.fDouble = t;
     break;
   }
   default:
-    ret = false;
+    break;
+  }
+  return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
+  std::vector<char> &buffer,
+  const char* &pCur,
+  unsigned int &bufferSize,
+  PLY::EDataType eType,
+  PLY::PropertyInstance::ValueUnion* out,
+  bool p_bBE)
+{
+  ai_assert(NULL != out);
+
+  //calc element size
+  const unsigned int lsize = BinarySize(eType);
+  if (0 == lsize)
+  {
+    return false;
   }
 
+  RequireBinary(streamBuffer, buffer, pCur, bufferSize, lsize);
+
+  *out = DecodeValueBinary(pCur, eType, p_bBE);
+  pCur += lsize;
   bufferSize -= lsize;
 
-  return ret;
+  return true;
 }
 
 #endif // !! ASSIMP_BUILD_NO_PLY_IMPORTER
@@ -348,6 +348,20 @@ public:
     static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
 
+    // -------------------------------------------------------------------
+    //! Size of a binary value in bytes, 0 for invalid types
+    static unsigned int BinarySize(EDataType eType);
+
+    // -------------------------------------------------------------------
+    //! Make sure at least numBytes bytes are left in the binary buffer,
+    //! fetching further blocks from the stream if necessary
+    static void RequireBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, unsigned int numBytes);
+
+    // -------------------------------------------------------------------
+    //! Decode a binary value at a given position without advancing
+    static ValueUnion DecodeValueBinary(const char* pCur, EDataType eType, bool p_bBE);
+
     // -------------------------------------------------------------------
     //! Convert a property value to a given type TYPE
     template <typename TYPE>
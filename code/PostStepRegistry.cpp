@@ -89,6 +89,12 @@ corresponding preprocessor flag to selectively disable steps.
 #ifndef ASSIMP_BUILD_NO_IMPROVECACHELOCALITY_PROCESS
 #   include "ImproveCacheLocality.h"
 #endif
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+#   include "GenMeshletsProcess.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+#   include "GenLODsProcess.h"
+#endif
 #ifndef ASSIMP_BUILD_NO_FIXINFACINGNORMALS_PROCESS
 #   include "FixNormalsStep.h"
 #endif
@@ -101,6 +107,9 @@ corresponding preprocessor flag to selectively disable steps.
 #ifndef ASSIMP_BUILD_NO_FINDINVALIDDATA_PROCESS
 #   include "FindInvalidDataProcess.h"
 #endif
+#ifndef ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS
+#   include "OptimizeAnimationsProcess.h"
+#endif
 #ifndef ASSIMP_BUILD_NO_FINDDEGENERATES_PROCESS
 #   include "FindDegenerates.h"
 #endif
@@ -134,6 +143,14 @@ corresponding preprocessor flag to selectively disable steps.
 
 namespace Assimp {
 
+// ------------------------------------------------------------------------------------------------
+// Assign the name a step is reported under in the import statistics
+static BaseProcess* NamedStep(BaseProcess* step, const char* name)
+{
+    step->SetName(name);
+    return step;
+}
+
 // ------------------------------------------------------------------------------------------------
 void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out)
 {
@@ -144,107 +161,116 @@ void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out)
     // ----------------------------------------------------------------------------
     out.reserve(31);
 #if (!defined ASSIMP_BUILD_NO_MAKELEFTHANDED_PROCESS)
-    out.push_back( new MakeLeftHandedProcess());
+    out.push_back( NamedStep( new MakeLeftHandedProcess(), "MakeLeftHandedProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FLIPUVS_PROCESS)
-    out.push_back( new FlipUVsProcess());
+    out.push_back( NamedStep( new FlipUVsProcess(), "FlipUVsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FLIPWINDINGORDER_PROCESS)
-    out.push_back( new FlipWindingOrderProcess());
+    out.push_back( NamedStep( new FlipWindingOrderProcess(), "FlipWindingOrderProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_REMOVEVC_PROCESS)
-    out.push_back( new RemoveVCProcess());
+    out.push_back( NamedStep( new RemoveVCProcess(), "RemoveVCProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_REMOVE_REDUNDANTMATERIALS_PROCESS)
-    out.push_back( new RemoveRedundantMatsProcess());
+    out.push_back( NamedStep( new RemoveRedundantMatsProcess(), "RemoveRedundantMatsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_EMBEDTEXTURES_PROCESS)
-    out.push_back( new EmbedTexturesProcess());
+    out.push_back( NamedStep( new EmbedTexturesProcess(), "EmbedTexturesProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FINDINSTANCES_PROCESS)
-    out.push_back( new FindInstancesProcess());
+    out.push_back( NamedStep( new FindInstancesProcess(), "FindInstancesProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_OPTIMIZEGRAPH_PROCESS)
-    out.push_back( new OptimizeGraphProcess());
+    out.push_back( NamedStep( new OptimizeGraphProcess(), "OptimizeGraphProcess"));
 #endif
 #ifndef ASSIMP_BUILD_NO_GENUVCOORDS_PROCESS
-    out.push_back( new ComputeUVMappingProcess());
+    out.push_back( NamedStep( new ComputeUVMappingProcess(), "ComputeUVMappingProcess"));
 #endif
 #ifndef ASSIMP_BUILD_NO_TRANSFORMTEXCOORDS_PROCESS
-    out.push_back( new TextureTransformStep());
+    out.push_back( NamedStep( new TextureTransformStep(), "TextureTransformStep"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_GLOBALSCALE_PROCESS)
-    out.push_back( new ScaleProcess());
+    out.push_back( NamedStep( new ScaleProcess(), "ScaleProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_PRETRANSFORMVERTICES_PROCESS)
-    out.push_back( new PretransformVertices());
+    out.push_back( NamedStep( new PretransformVertices(), "PretransformVertices"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_TRIANGULATE_PROCESS)
-    out.push_back( new TriangulateProcess());
+    out.push_back( NamedStep( new TriangulateProcess(), "TriangulateProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FINDDEGENERATES_PROCESS)
     //find degenerates should run after triangulation (to sort out small
     //generated triangles) but before sort by p types (in case there are lines
     //and points generated and inserted into a mesh)
-    out.push_back( new FindDegeneratesProcess());
+    out.push_back( NamedStep( new FindDegeneratesProcess(), "FindDegeneratesProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_SORTBYPTYPE_PROCESS)
-    out.push_back( new SortByPTypeProcess());
+    out.push_back( NamedStep( new SortByPTypeProcess(), "SortByPTypeProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FINDINVALIDDATA_PROCESS)
-    out.push_back( new FindInvalidDataProcess());
+    out.push_back( NamedStep( new FindInvalidDataProcess(), "FindInvalidDataProcess"));
+#endif
+#if (!defined ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS)
+    out.push_back( NamedStep( new OptimizeAnimationsProcess(), "OptimizeAnimationsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_OPTIMIZEMESHES_PROCESS)
-    out.push_back( new OptimizeMeshesProcess());
+    out.push_back( NamedStep( new OptimizeMeshesProcess(), "OptimizeMeshesProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_FIXINFACINGNORMALS_PROCESS)
-    out.push_back( new FixInfacingNormalsProcess());
+    out.push_back( NamedStep( new FixInfacingNormalsProcess(), "FixInfacingNormalsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_SPLITBYBONECOUNT_PROCESS)
-    out.push_back( new SplitByBoneCountProcess());
+    out.push_back( NamedStep( new SplitByBoneCountProcess(), "SplitByBoneCountProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_SPLITLARGEMESHES_PROCESS)
-    out.push_back( new SplitLargeMeshesProcess_Triangle());
+    out.push_back( NamedStep( new SplitLargeMeshesProcess_Triangle(), "SplitLargeMeshesProcess_Triangle"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_GENFACENORMALS_PROCESS)
-    out.push_back( new DropFaceNormalsProcess());
+    out.push_back( NamedStep( new DropFaceNormalsProcess(), "DropFaceNormalsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_GENFACENORMALS_PROCESS)
-    out.push_back( new GenFaceNormalsProcess());
+    out.push_back( NamedStep( new GenFaceNormalsProcess(), "GenFaceNormalsProcess"));
 #endif
     // .........................................................................
     // DON'T change the order of these five ..
     // XXX this is actually a design weakness that dates back to the time
     // when Importer would maintain the postprocessing step list exclusively.
     // Now that others access it too, we need a better solution.
-    out.push_back( new ComputeSpatialSortProcess());
+    out.push_back( NamedStep( new ComputeSpatialSortProcess(), "ComputeSpatialSortProcess"));
     // .........................................................................
 
 #if (!defined ASSIMP_BUILD_NO_GENVERTEXNORMALS_PROCESS)
-    out.push_back( new GenVertexNormalsProcess());
+    out.push_back( NamedStep( new GenVertexNormalsProcess(), "GenVertexNormalsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_CALCTANGENTS_PROCESS)
-    out.push_back( new CalcTangentsProcess());
+    out.push_back( NamedStep( new CalcTangentsProcess(), "CalcTangentsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_JOINVERTICES_PROCESS)
-    out.push_back( new JoinVerticesProcess());
+    out.push_back( NamedStep( new JoinVerticesProcess(), "JoinVerticesProcess"));
 #endif
 
     // .........................................................................
-    out.push_back( new DestroySpatialSortProcess());
+    out.push_back( NamedStep( new DestroySpatialSortProcess(), "DestroySpatialSortProcess"));
     // .........................................................................
 
 #if (!defined ASSIMP_BUILD_NO_SPLITLARGEMESHES_PROCESS)
-    out.push_back( new SplitLargeMeshesProcess_Vertex());
+    out.push_back( NamedStep( new SplitLargeMeshesProcess_Vertex(), "SplitLargeMeshesProcess_Vertex"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_DEBONE_PROCESS)
-    out.push_back( new DeboneProcess());
+    out.push_back( NamedStep( new DeboneProcess(), "DeboneProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_LIMITBONEWEIGHTS_PROCESS)
-    out.push_back( new LimitBoneWeightsProcess());
+    out.push_back( NamedStep( new LimitBoneWeightsProcess(), "LimitBoneWeightsProcess"));
+#endif
+#if (!defined ASSIMP_BUILD_NO_GENLODS_PROCESS)
+    out.push_back( NamedStep( new GenLODsProcess(), "GenLODsProcess"));
 #endif
 #if (!defined ASSIMP_BUILD_NO_IMPROVECACHELOCALITY_PROCESS)
-    out.push_back( new ImproveCacheLocalityProcess());
+    out.push_back( NamedStep( new ImproveCacheLocalityProcess(), "ImproveCacheLocalityProcess"));
+#endif
+#if (!defined ASSIMP_BUILD_NO_GENMESHLETS_PROCESS)
+    out.push_back( NamedStep( new GenMeshletsProcess(), "GenMeshletsProcess"));
 #endif
 }
 
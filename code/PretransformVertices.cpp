@@ -407,6 +407,11 @@ void PretransformVertices::BuildWCSMeshes(std::vector<aiMesh*>& out, aiMesh** in
                 ntz->mNumBones = node->mMeshes[i];
                 ntz->mBones = reinterpret_cast<aiBone**> (&node->mTransformation);
 
+                // the levels of detail are transformed along with the original
+                delete[] ntz->mLODs;
+                ntz->mLODs = NULL;
+                ntz->mNumLODs = 0;
+
                 out.push_back(ntz);
 
                 node->mMeshes[i] = static_cast<unsigned int>(numIn + out.size() - 1);
@@ -499,8 +504,25 @@ void PretransformVertices::Execute( aiScene* pScene)
             delete[] pScene->mMeshes; pScene->mMeshes = npp;
         }
 
+        // levels of detail aren't referenced by any node, they share the
+        // transformation of their mesh
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            const aiMesh* mesh = pScene->mMeshes[i];
+            for (unsigned int a = 0; a < mesh->mNumLODs; ++a) {
+                aiMesh* lod = pScene->mMeshes[mesh->mLODs[a]];
+                if (!lod->mBones) {
+                    lod->mBones = mesh->mBones;
+                }
+            }
+        }
+
         // now iterate through all meshes and transform them to worldspace
         for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            if (!pScene->mMeshes[i]->mBones) {
+                // not referenced at all
+                pScene->mMeshes[i]->mNumBones = 0;
+                continue;
+            }
             ApplyTransform(pScene->mMeshes[i],*reinterpret_cast<aiMatrix4x4*>( pScene->mMeshes[i]->mBones ));
 
             // prevent improper destruction
@@ -514,6 +536,9 @@ void PretransformVertices::Execute( aiScene* pScene)
         std::vector<unsigned int> s(pScene->mNumMeshes,0);
         BuildMeshRefCountArray(pScene->mRootNode,&s[0]);
 
+        // CollectData() counts the references down again
+        const std::vector<unsigned int> refs = s;
+
         for (unsigned int i = 0; i < pScene->mNumMaterials;++i)     {
             // get the list of all vertex formats for this material
             aiVFormats.clear();
@@ -572,8 +597,9 @@ void PretransformVertices::Execute( aiScene* pScene)
                 mesh->mNumBones = 0;
                 mesh->mBones    = NULL;
 
-                // we're reusing the face index arrays. avoid destruction
-                for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+                // we're reusing the face index arrays of all referenced
+                // meshes. avoid destruction
+                for (unsigned int a = 0; refs[i] && a < mesh->mNumFaces; ++a) {
                     mesh->mFaces[a].mNumIndices = 0;
                     mesh->mFaces[a].mIndices = NULL;
                 }
@@ -45,7 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "ProcessHelper.h"
-
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
 
 #include <limits>
 
@@ -176,6 +177,17 @@ ai_real ComputePositionEpsilon(const aiMesh* const* pMeshes, size_t num)
 }
 
 
+// -------------------------------------------------------------------------------
+SpatialSort::Backend GetSpatialSortBackend(const Importer* pImp)
+{
+    const int backend = pImp->GetPropertyInteger(AI_CONFIG_PP_SPATIAL_SORT_BACKEND, SpatialSort::Backend_PlaneSort);
+    if (backend < SpatialSort::Backend_Auto || backend > SpatialSort::Backend_Grid) {
+        ASSIMP_LOG_WARN_F("Invalid value for " AI_CONFIG_PP_SPATIAL_SORT_BACKEND ": ", backend, ", using the plane sort");
+        return SpatialSort::Backend_PlaneSort;
+    }
+    return static_cast<SpatialSort::Backend>(backend);
+}
+
 // -------------------------------------------------------------------------------
 unsigned int GetMeshVFormatUnique(const aiMesh* pcMesh)
 {
@@ -440,4 +452,28 @@ aiMesh* MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
     return oMesh;
 }
 
+// -------------------------------------------------------------------------------
+void UpdateMeshLODs(aiScene* pScene, const unsigned int* pMapping, unsigned int pNumOld)
+{
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        aiMesh* mesh = pScene->mMeshes[a];
+        if (!mesh->mNumLODs) {
+            continue;
+        }
+
+        unsigned int numLODs = 0;
+        for (unsigned int i = 0; i < mesh->mNumLODs; ++i) {
+            const unsigned int lod = mesh->mLODs[i] < pNumOld ? pMapping[mesh->mLODs[i]] : UINT_MAX;
+            if (lod < pScene->mNumMeshes && lod != a) {
+                mesh->mLODs[numLODs++] = lod;
+            }
+        }
+        if (!numLODs) {
+            delete[] mesh->mLODs;
+            mesh->mLODs = NULL;
+        }
+        mesh->mNumLODs = numLODs;
+    }
+}
+
 } // namespace Assimp
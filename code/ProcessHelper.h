@@ -334,11 +334,33 @@ const char* MappingTypeToString(aiTextureMapping in);
 // Split a mesh given a list of faces to be contained in the sub mesh
 aiMesh* MakeSubmesh(const aiMesh *superMesh, const std::vector<unsigned int> &subMeshFaces, unsigned int subFlags);
 
+// -------------------------------------------------------------------------------
+// Read the SpatialSort backend selected by AI_CONFIG_PP_SPATIAL_SORT_BACKEND
+SpatialSort::Backend GetSpatialSortBackend(const Importer* pImp);
+
+// -------------------------------------------------------------------------------
+// Update aiMesh::mLODs after the meshes of a scene have been renumbered.
+// pMapping holds the new index of each of the pNumOld old meshes, or UINT_MAX
+// if a mesh doesn't exist as it was anymore. Lost levels are dropped.
+void UpdateMeshLODs(aiScene* pScene, const unsigned int* pMapping, unsigned int pNumOld);
+
 // -------------------------------------------------------------------------------
 // Utility postprocess step to share the spatial sort tree between
 // all steps which use it to speedup its computations.
 class ComputeSpatialSortProcess : public BaseProcess
 {
+public:
+    ComputeSpatialSortProcess()
+    : configBackend( SpatialSort::Backend_PlaneSort ) {
+        // empty
+    }
+
+private:
+    void SetupProperties(const Importer* pImp)
+    {
+        configBackend = GetSpatialSortBackend(pImp);
+    }
+
     bool IsActive( unsigned int pFlags) const
     {
         return NULL != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace |
@@ -351,17 +373,19 @@ class ComputeSpatialSortProcess : public BaseProcess
         ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
 
         std::vector<_Type>* p = new std::vector<_Type>(pScene->mNumMeshes);
-        std::vector<_Type>::iterator it = p->begin();
 
-        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i, ++it) {
+        ExecutePerMesh(pScene, [&](unsigned int i) {
             aiMesh* mesh = pScene->mMeshes[i];
-            _Type& blubb = *it;
+            _Type& blubb = (*p)[i];
+            blubb.first.SetBackend(configBackend);
             blubb.first.Fill(mesh->mVertices,mesh->mNumVertices,sizeof(aiVector3D));
             blubb.second = ComputePositionEpsilon(mesh);
-        }
+        });
 
         shared->AddProperty(AI_SPP_SPATIAL_SORT,p);
     }
+
+    SpatialSort::Backend configBackend;
 };
 
 // -------------------------------------------------------------------------------
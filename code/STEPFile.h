@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_AI_STEPFILE_H
 #define INCLUDED_AI_STEPFILE_H
 
+#include <algorithm>
 #include <bitset>
 #include <memory>
 #include <typeinfo>
@@ -819,6 +820,81 @@ namespace STEP {
         return InternGenericConvertList<T1,N1,N2>()(a,b,db);
     }
 
+    // ------------------------------------------------------------------------------
+    /** Table of all object records in a STEP file, indexed by id. Ids are
+     *  mostly dense and start near 1, so the records are kept in a flat vector
+     *  indexed by id. Ids beyond the dense range reserved up front (sparse
+     *  files, or records inserted without reserving) go to a map instead. */
+    // -------------------------------------------------------------------------------
+    class ObjectTable
+    {
+    public:
+        ObjectTable()
+            : count()
+        {}
+
+        // make room for the given number of records with ids up to maxId. The
+        // flat part is capped to a few slots per record, so a handful of huge
+        // ids cannot blow up the table.
+        void Reserve(uint64_t maxId, size_t numRecords) {
+            const uint64_t limit = static_cast<uint64_t>(numRecords) * 4 + 1024;
+            const uint64_t size = std::min(maxId, limit) + 1;
+            if (size > dense.size()) {
+                dense.resize(static_cast<size_t>(size), nullptr);
+            }
+        }
+
+        // store a record, returns the record previously stored under its id
+        const LazyObject* Insert(uint64_t id, const LazyObject* obj) {
+            const LazyObject* old = nullptr;
+            if (id < dense.size()) {
+                old = dense[static_cast<size_t>(id)];
+                dense[static_cast<size_t>(id)] = obj;
+            }
+            else {
+                const LazyObject*& slot = sparse[id];
+                old = slot;
+                slot = obj;
+            }
+            if (!old) {
+                ++count;
+            }
+            return old;
+        }
+
+        const LazyObject* Find(uint64_t id) const {
+            if (id < dense.size()) {
+                return dense[static_cast<size_t>(id)];
+            }
+            const SparseMap::const_iterator it = sparse.find(id);
+            return it != sparse.end() ? (*it).second : nullptr;
+        }
+
+        size_t size() const {
+            return count;
+        }
+
+        // invoke fn on each record, in no particular order
+        template <typename Fn>
+        void ForEach(Fn fn) const {
+            for(const LazyObject* o : dense) {
+                if (o) {
+                    fn(o);
+                }
+            }
+            for(const SparseMap::value_type& o : sparse) {
+                fn(o.second);
+            }
+        }
+
+    private:
+        typedef std::step_unordered_map<uint64_t, const LazyObject*> SparseMap;
+
+        std::vector<const LazyObject*> dense;
+        SparseMap sparse;
+        size_t count;
+    };
+
     // ------------------------------------------------------------------------------
     /** Lightweight manager class that holds the map of all objects in a
      *  STEP file. DB's are exclusively maintained by the functions in
@@ -829,15 +905,16 @@ namespace STEP {
         friend DB* ReadFileHeader(std::shared_ptr<IOStream> stream);
         friend void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
             const char* const* types_to_track, size_t len,
-            const char* const* inverse_indices_to_track, size_t len2
+            const char* const* inverse_indices_to_track, size_t len2,
+            unsigned int numThreads
         );
 
         friend class LazyObject;
 
     public:
         // objects indexed by ID - this can grow pretty large (i.e some hundred million
-        // entries), so use raw pointers to avoid *any* overhead.
-        typedef std::map<uint64_t,const LazyObject* > ObjectMap;
+        // entries), so use raw pointers in a flat table to avoid *any* overhead.
+        typedef ObjectTable ObjectMap;
 
         // objects indexed by their declarative type, but only for those that we truly want
         typedef std::set< const LazyObject*> ObjectSet;
@@ -860,13 +937,15 @@ namespace STEP {
             , splitter(*reader,true,true)
             , evaluated_count()
             , schema( nullptr )
+            , data_begin( nullptr )
+            , data_line()
         {}
 
     public:
         ~DB() {
-            for(ObjectMap::value_type& o : objects) {
-                delete o.second;
-            }
+            objects.ForEach([](const LazyObject* o) {
+                delete o;
+            });
         }
 
         uint64_t GetObjectCount() const {
@@ -904,11 +983,7 @@ namespace STEP {
 
         // get the yet unevaluated object record with a given id
         const LazyObject* GetObject(uint64_t id) const {
-            const ObjectMap::const_iterator it = objects.find(id);
-            if (it != objects.end()) {
-                return (*it).second;
-            }
-            return nullptr;
+            return objects.Find(id);
         }
 
 
@@ -943,9 +1018,9 @@ namespace STEP {
 
         // evaluate *all* entities in the file. this is a power test for the loader
         void EvaluateAll() {
-            for(ObjectMap::value_type& e :objects) {
-                **e.second;
-            }
+            objects.ForEach([](const LazyObject* o) {
+                **o;
+            });
             ai_assert(evaluated_count == objects.size());
         }
 
@@ -960,13 +1035,44 @@ namespace STEP {
             return splitter;
         }
 
+        StreamReaderLE& GetReader() {
+            return *reader;
+        }
+
+        // start of the DATA section in the reader's buffer and its line index
+        void SetDataSection(const char* begin, LineSplitter::line_idx line) {
+            data_begin = begin;
+            data_line = line;
+        }
+
+        const char* GetDataBegin() const {
+            return data_begin;
+        }
+
+        LineSplitter::line_idx GetDataLine() const {
+            return data_line;
+        }
+
+        void ReserveObjects(uint64_t maxId, size_t numRecords) {
+            objects.Reserve(maxId, numRecords);
+        }
+
         void InternInsert(const LazyObject* lz) {
-            objects[lz->GetID()] = lz;
+            const LazyObject* old = objects.Insert(lz->GetID(), lz);
 
             const ObjectMapByType::iterator it = objects_bytype.find( lz->type );
             if (it != objects_bytype.end()) {
                 (*it).second.insert(lz);
             }
+
+            // a later record with the same id replaces the earlier one
+            if (old) {
+                const ObjectMapByType::iterator oit = objects_bytype.find( old->type );
+                if (oit != objects_bytype.end()) {
+                    (*oit).second.erase(old);
+                }
+                delete old;
+            }
         }
 
         void SetSchema(const EXPRESS::ConversionSchema& _schema) {
@@ -1006,6 +1112,8 @@ namespace STEP {
         LineSplitter splitter;
         uint64_t evaluated_count;
         const EXPRESS::ConversionSchema* schema;
+        const char* data_begin;
+        LineSplitter::line_idx data_line;
     };
 
 }
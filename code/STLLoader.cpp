@@ -77,15 +77,21 @@ static const aiImporterDesc desc = {
 // 1) 80 byte header
 // 2) 4 byte face count
 // 3) 50 bytes per face
+static const unsigned int STL_BINARY_HEADER_SIZE = 84;
+static const unsigned int STL_BINARY_FACET_SIZE = 50;
+
+// Number of facets decoded per block when streaming a binary file
+static const unsigned int STL_BINARY_FACETS_PER_BLOCK = 4096;
+
 static bool IsBinarySTL(const char* buffer, unsigned int fileSize) {
-    if( fileSize < 84 ) {
+    if( fileSize < STL_BINARY_HEADER_SIZE ) {
         return false;
     }
 
     const char *facecount_pos = buffer + 80;
     uint32_t faceCount( 0 );
     ::memcpy( &faceCount, facecount_pos, sizeof( uint32_t ) );
-    const uint32_t expectedBinaryFileSize = faceCount * 50 + 84;
+    const uint32_t expectedBinaryFileSize = faceCount * STL_BINARY_FACET_SIZE + STL_BINARY_HEADER_SIZE;
 
     return expectedBinaryFileSize == fileSize;
 }
@@ -188,13 +194,29 @@ void STLImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
 
     fileSize = (unsigned int)file->FileSize();
 
-    // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
+    // Binary files can be read in place if the stream holds them in memory.
+    // If not, only the 84 byte header is read up front and the facets are
+    // streamed from the file in blocks, so the file is never held in memory
+    // as a whole. ASCII files are copied to a zero-terminated buffer.
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(),buffer2);
+    // padded, the search for a Materialise color may read past the header
+    char header[STL_BINARY_HEADER_SIZE + 16] = {};
+    const char* mapped = reinterpret_cast<const char*>(file->GetMappedData());
+    IOStream* facetStream = nullptr;
+    if (nullptr != mapped && IsBinarySTL(mapped, fileSize)) {
+        this->mBuffer = mapped;
+    } else if (nullptr == mapped && fileSize >= STL_BINARY_HEADER_SIZE &&
+            file->Read(header, 1, STL_BINARY_HEADER_SIZE) == STL_BINARY_HEADER_SIZE &&
+            IsBinarySTL(header, fileSize)) {
+        this->mBuffer = header;
+        facetStream = file.get();
+    } else {
+        file->Seek(0, aiOrigin_SET);
+        TextFileToBuffer(file.get(),buffer2);
+        this->mBuffer = &buffer2[0];
+    }
 
     this->pScene = pScene;
-    this->mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     clrColorDefault.r = clrColorDefault.g = clrColorDefault.b = clrColorDefault.a = (ai_real) 0.6;
@@ -204,8 +226,8 @@ void STLImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
 
     bool bMatClr = false;
 
-    if (IsBinarySTL(mBuffer, fileSize)) {
-        bMatClr = LoadBinaryFile();
+    if (nullptr != facetStream || IsBinarySTL(mBuffer, fileSize)) {
+        bMatClr = LoadBinaryFile(facetStream);
     } else if (IsAsciiSTL(mBuffer, fileSize)) {
         LoadASCIIFile( pScene->mRootNode );
     } else {
@@ -313,12 +335,9 @@ void STLImporter::LoadASCIIFile( aiNode *root ) {
                         throw DeadlyImportError("STL: unexpected EOF while parsing facet");
                     }
                     sz += 7;
-                    SkipSpaces(&sz);
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->x );
-                    SkipSpaces(&sz);
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->y );
-                    SkipSpaces(&sz);
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->z );
+                    if (fast_atoreal_array(&sz, bufferEnd, &vn->x, 3) != 3) {
+                        throw DeadlyImportError("STL: invalid facet normal");
+                    }
                     normalBuffer.push_back(*vn);
                     normalBuffer.push_back(*vn);
                 }
@@ -331,14 +350,11 @@ void STLImporter::LoadASCIIFile( aiNode *root ) {
                         throw DeadlyImportError("STL: unexpected EOF while parsing facet");
                     }
                     sz += 7;
-                    SkipSpaces(&sz);
                     positionBuffer.push_back(aiVector3D());
                     aiVector3D* vn = &positionBuffer.back();
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->x );
-                    SkipSpaces(&sz);
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->y );
-                    SkipSpaces(&sz);
-                    sz = fast_atoreal_move<ai_real>(sz, (ai_real&)vn->z );
+                    if (fast_atoreal_array(&sz, bufferEnd, &vn->x, 3) != 3) {
+                        throw DeadlyImportError("STL: invalid vertex");
+                    }
                     faceVertexCounter++;
                 }
             } else if (!::strncmp(sz,"endsolid",8))    {
@@ -408,7 +424,7 @@ void STLImporter::LoadASCIIFile( aiNode *root ) {
 
 // ------------------------------------------------------------------------------------------------
 // Read a binary STL file
-bool STLImporter::LoadBinaryFile()
+bool STLImporter::LoadBinaryFile(IOStream* stream)
 {
     // allocate one mesh
     pScene->mNumMeshes = 1;
@@ -441,13 +457,10 @@ bool STLImporter::LoadBinaryFile()
             break;
         }
     }
-    const unsigned char* sz = (const unsigned char*)mBuffer + 80;
-
     // now read the number of facets
     pScene->mRootNode->mName.Set("<STL_BINARY>");
 
-    pMesh->mNumFaces = *((uint32_t*)sz);
-    sz += 4;
+    ::memcpy(&pMesh->mNumFaces, mBuffer + 80, sizeof(uint32_t));
 
     if (fileSize < 84 + pMesh->mNumFaces*50) {
         throw DeadlyImportError("STL: file is too small to hold all facets");
@@ -466,74 +479,92 @@ bool STLImporter::LoadBinaryFile()
     typedef aiVector3t<float> aiVector3F;
     aiVector3F* theVec;
     aiVector3F theVec3F;
-    
-    for ( unsigned int i = 0; i < pMesh->mNumFaces; ++i ) {
-        // NOTE: Blender sometimes writes empty normals ... this is not
-        // our fault ... the RemoveInvalidData helper step should fix that
-
-        // There's one normal for the face in the STL; use it three times
-        // for vertex normals
-        theVec = (aiVector3F*) sz;
-        ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
-        vn->x = theVec3F.x; vn->y = theVec3F.y; vn->z = theVec3F.z;
-        *(vn+1) = *vn;
-        *(vn+2) = *vn;
-        ++theVec;
-        vn += 3;
-
-        // vertex 1
-        ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
-        vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
-        ++theVec;
-        ++vp;
-
-        // vertex 2
-        ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
-        vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
-        ++theVec;
-        ++vp;
-
-        // vertex 3
-        ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
-        vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
-        ++theVec;
-        ++vp;
-        
-        sz = (const unsigned char*) theVec;
 
-        uint16_t color = *((uint16_t*)sz);
-        sz += 2;
+    // Facets are decoded a block at a time. A mapped file is read in place,
+    // a streamed one is read block by block into a small scratch buffer.
+    std::vector<unsigned char> block;
+    for ( unsigned int first = 0; first < pMesh->mNumFaces; first += STL_BINARY_FACETS_PER_BLOCK ) {
+        const unsigned int count = std::min(STL_BINARY_FACETS_PER_BLOCK, pMesh->mNumFaces - first);
+        const unsigned char* sz;
+        if (nullptr == stream) {
+            sz = (const unsigned char*)mBuffer + STL_BINARY_HEADER_SIZE + first * STL_BINARY_FACET_SIZE;
+        } else {
+            block.resize(count * STL_BINARY_FACET_SIZE);
+            if (stream->Read(&block[0], STL_BINARY_FACET_SIZE, count) != count) {
+                throw DeadlyImportError("STL: file is too small to hold all facets");
+            }
+            sz = &block[0];
+        }
 
-        if (color & (1 << 15))
-        {
-            // seems we need to take the color
-            if (!pMesh->mColors[0])
-            {
-                pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
-                for (unsigned int i = 0; i <pMesh->mNumVertices;++i)
-                    *pMesh->mColors[0]++ = this->clrColorDefault;
-                pMesh->mColors[0] -= pMesh->mNumVertices;
+        for ( unsigned int i = first; i < first + count; ++i ) {
+            // NOTE: Blender sometimes writes empty normals ... this is not
+            // our fault ... the RemoveInvalidData helper step should fix that
+
+            // There's one normal for the face in the STL; use it three times
+            // for vertex normals
+            theVec = (aiVector3F*) sz;
+            ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
+            vn->x = theVec3F.x; vn->y = theVec3F.y; vn->z = theVec3F.z;
+            *(vn+1) = *vn;
+            *(vn+2) = *vn;
+            ++theVec;
+            vn += 3;
+
+            // vertex 1
+            ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
+            vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
+            ++theVec;
+            ++vp;
+
+            // vertex 2
+            ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
+            vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
+            ++theVec;
+            ++vp;
+
+            // vertex 3
+            ::memcpy( &theVec3F, theVec, sizeof(aiVector3F) );
+            vp->x = theVec3F.x; vp->y = theVec3F.y; vp->z = theVec3F.z;
+            ++theVec;
+            ++vp;
+        
+            sz = (const unsigned char*) theVec;
 
-                ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
-            }
-            aiColor4D* clr = &pMesh->mColors[0][i*3];
-            clr->a = 1.0;
-            const ai_real invVal( (ai_real)1.0 / ( ai_real )31.0 );
-            if (bIsMaterialise) // this is reversed
-            {
-                clr->r = (color & 0x31u) *invVal;
-                clr->g = ((color & (0x31u<<5))>>5u) *invVal;
-                clr->b = ((color & (0x31u<<10))>>10u) *invVal;
-            }
-            else
+            uint16_t color;
+            ::memcpy(&color, sz, sizeof(uint16_t));
+            sz += 2;
+
+            if (color & (1 << 15))
             {
-                clr->b = (color & 0x31u) *invVal;
-                clr->g = ((color & (0x31u<<5))>>5u) *invVal;
-                clr->r = ((color & (0x31u<<10))>>10u) *invVal;
+                // seems we need to take the color
+                if (!pMesh->mColors[0])
+                {
+                    pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+                    for (unsigned int i = 0; i <pMesh->mNumVertices;++i)
+                        *pMesh->mColors[0]++ = this->clrColorDefault;
+                    pMesh->mColors[0] -= pMesh->mNumVertices;
+
+                    ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
+                }
+                aiColor4D* clr = &pMesh->mColors[0][i*3];
+                clr->a = 1.0;
+                const ai_real invVal( (ai_real)1.0 / ( ai_real )31.0 );
+                if (bIsMaterialise) // this is reversed
+                {
+                    clr->r = (color & 0x31u) *invVal;
+                    clr->g = ((color & (0x31u<<5))>>5u) *invVal;
+                    clr->b = ((color & (0x31u<<10))>>10u) *invVal;
+                }
+                else
+                {
+                    clr->b = (color & 0x31u) *invVal;
+                    clr->g = ((color & (0x31u<<5))>>5u) *invVal;
+                    clr->r = ((color & (0x31u<<10))>>10u) *invVal;
+                }
+                // assign the color to all vertices of the face
+                *(clr+1) = *clr;
+                *(clr+2) = *clr;
             }
-            // assign the color to all vertices of the face
-            *(clr+1) = *clr;
-            *(clr+2) = *clr;
         }
     }
 
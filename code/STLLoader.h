@@ -94,9 +94,11 @@ protected:
 
     /**
      * @brief   Loads a binary .stl file
+     * @param stream  Stream positioned after the header to read the facets
+     *   from, or nullptr if they follow the header in mBuffer
      * @return true if the default vertex color must be used as material color
      */
-    bool LoadBinaryFile();
+    bool LoadBinaryFile(IOStream* stream = nullptr);
 
     /**
      * @brief   Loads a ASCII text .stl file
@@ -0,0 +1,330 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file SceneArena.cpp
+ *  @brief Implementation of the functions to move scene data into an arena
+ */
+
+#include "SceneArena.h"
+#include "MemoryArena.h"
+#include "ScenePrivate.h"
+
+#include <assimp/scene.h>
+
+#include <memory>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Calls the visitor for each array of a mesh or anim mesh holding per-vertex data
+template <typename MeshType, typename Visitor>
+void VisitVertexStreams(MeshType* mesh, Visitor& visitor) {
+    const unsigned int n = mesh->mNumVertices;
+    visitor.Array(mesh->mVertices, n);
+    visitor.Array(mesh->mNormals, n);
+    visitor.Array(mesh->mTangents, n);
+    visitor.Array(mesh->mBitangents, n);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        visitor.Array(mesh->mTextureCoords[i], n);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        visitor.Array(mesh->mColors[i], n);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Visitor>
+void VisitNode(aiNode* node, Visitor& visitor) {
+    // the child lists stay on the heap, aiNode::~aiNode needs them to
+    // delete the children
+    visitor.Array(node->mMeshes, node->mNumMeshes);
+    for (unsigned int i = 0; node->mChildren && i < node->mNumChildren; ++i) {
+        if (node->mChildren[i]) {
+            VisitNode(node->mChildren[i], visitor);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Calls the visitor for each array of a scene that may be held in the arena. The
+// index arrays of a mesh are visited before its face array.
+template <typename Visitor>
+void VisitSceneArrays(aiScene* scene, Visitor& visitor) {
+    for (unsigned int m = 0; scene->mMeshes && m < scene->mNumMeshes; ++m) {
+        aiMesh* mesh = scene->mMeshes[m];
+        if (!mesh) {
+            continue;
+        }
+        VisitVertexStreams(mesh, visitor);
+        for (unsigned int i = 0; mesh->mFaces && i < mesh->mNumFaces; ++i) {
+            visitor.Array(mesh->mFaces[i].mIndices, mesh->mFaces[i].mNumIndices);
+        }
+        visitor.Faces(mesh->mFaces, mesh->mNumFaces);
+        if (mesh->mIndexBuffer) {
+            // allocated as unsigned int, see IndexBuffer.h
+            unsigned int* buffer = static_cast<unsigned int*>(mesh->mIndexBuffer);
+            visitor.Array(buffer, (mesh->mNumIndices * mesh->mIndexSize + 3) / 4);
+            mesh->mIndexBuffer = buffer;
+        }
+        if (mesh->mPackedVertices) {
+            // allocated as unsigned int, see PackedVertices.h
+            unsigned int* buffer = static_cast<unsigned int*>(mesh->mPackedVertices);
+            visitor.Array(buffer, mesh->mNumVertices * (mesh->mPackedLayout.mStride / 4));
+            mesh->mPackedVertices = buffer;
+        }
+        visitor.Array(mesh->mMeshlets, mesh->mNumMeshlets);
+        visitor.Array(mesh->mMeshletVertices, mesh->mNumMeshletVertices);
+        visitor.Array(mesh->mMeshletIndices, mesh->mNumMeshletIndices);
+        visitor.Array(mesh->mLODs, mesh->mNumLODs);
+        for (unsigned int i = 0; mesh->mBones && i < mesh->mNumBones; ++i) {
+            if (mesh->mBones[i]) {
+                visitor.Array(mesh->mBones[i]->mWeights, mesh->mBones[i]->mNumWeights);
+            }
+        }
+        for (unsigned int i = 0; mesh->mAnimMeshes && i < mesh->mNumAnimMeshes; ++i) {
+            if (mesh->mAnimMeshes[i]) {
+                VisitVertexStreams(mesh->mAnimMeshes[i], visitor);
+            }
+        }
+    }
+
+    if (scene->mRootNode) {
+        VisitNode(scene->mRootNode, visitor);
+    }
+
+    for (unsigned int m = 0; scene->mMaterials && m < scene->mNumMaterials; ++m) {
+        aiMaterial* mat = scene->mMaterials[m];
+        for (unsigned int i = 0; mat && mat->mProperties && i < mat->mNumProperties; ++i) {
+            if (mat->mProperties[i]) {
+                visitor.Array(mat->mProperties[i]->mData, mat->mProperties[i]->mDataLength);
+            }
+        }
+    }
+
+    for (unsigned int a = 0; scene->mAnimations && a < scene->mNumAnimations; ++a) {
+        aiAnimation* anim = scene->mAnimations[a];
+        if (!anim) {
+            continue;
+        }
+        for (unsigned int i = 0; anim->mChannels && i < anim->mNumChannels; ++i) {
+            aiNodeAnim* channel = anim->mChannels[i];
+            if (channel) {
+                visitor.Array(channel->mPositionKeys, channel->mNumPositionKeys);
+                visitor.Array(channel->mRotationKeys, channel->mNumRotationKeys);
+                visitor.Array(channel->mScalingKeys, channel->mNumScalingKeys);
+            }
+        }
+        for (unsigned int i = 0; anim->mMeshChannels && i < anim->mNumMeshChannels; ++i) {
+            if (anim->mMeshChannels[i]) {
+                visitor.Array(anim->mMeshChannels[i]->mKeys, anim->mMeshChannels[i]->mNumKeys);
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Sums up the storage needed for all arrays not yet in the arena
+struct MeasureVisitor {
+    const MemoryArena* mArena;
+    size_t mBytes;
+
+    template <typename T>
+    void Array(T*& p, unsigned int n) {
+        if (p && n && !(mArena && mArena->Contains(p))) {
+            mBytes += n * sizeof(T) + alignof(T) - 1;
+        }
+    }
+
+    void Faces(aiFace*& p, unsigned int n) {
+        Array(p, n);
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Moves heap arrays into the arena
+struct MoveInVisitor {
+    MemoryArena* mArena;
+
+    template <typename T>
+    void Array(T*& p, unsigned int n) {
+        if (!p || !n || mArena->Contains(p)) {
+            return;
+        }
+        T* dest = mArena->AllocateArray<T>(n);
+        std::uninitialized_copy(p, p + n, dest);
+        delete[] p;
+        p = dest;
+    }
+
+    void Faces(aiFace*& p, unsigned int n) {
+        if (!p || !n || mArena->Contains(p)) {
+            return;
+        }
+        // hand the index arrays over instead of copying them
+        aiFace* dest = mArena->AllocateArray<aiFace>(n);
+        for (unsigned int i = 0; i < n; ++i) {
+            new (dest + i) aiFace();
+            dest[i].mNumIndices = p[i].mNumIndices;
+            dest[i].mIndices = p[i].mIndices;
+            p[i].mIndices = nullptr;
+        }
+        delete[] p;
+        p = dest;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Copies arena arrays back to the heap
+struct MoveOutVisitor {
+    const MemoryArena* mArena;
+
+    template <typename T>
+    void Array(T*& p, unsigned int n) {
+        if (!p || !mArena->Contains(p)) {
+            return;
+        }
+        T* dest = new T[n];
+        std::copy(p, p + n, dest);
+        p = dest;
+    }
+
+    void Faces(aiFace*& p, unsigned int n) {
+        if (!p || !mArena->Contains(p)) {
+            return;
+        }
+        aiFace* dest = new aiFace[n];
+        for (unsigned int i = 0; i < n; ++i) {
+            dest[i].mNumIndices = p[i].mNumIndices;
+            dest[i].mIndices = p[i].mIndices;
+            p[i].mIndices = nullptr;
+        }
+        p = dest;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Resets all pointers into the arena so that the destructors skip them
+struct DetachVisitor {
+    const MemoryArena* mArena;
+
+    template <typename T>
+    void Array(T*& p, unsigned int) {
+        if (p && mArena->Contains(p)) {
+            p = nullptr;
+        }
+    }
+
+    void Faces(aiFace*& p, unsigned int n) {
+        if (!p || !mArena->Contains(p)) {
+            return;
+        }
+        // index arrays in the arena have been detached already, the
+        // remaining ones were allocated after the scene was compacted
+        for (unsigned int i = 0; i < n; ++i) {
+            delete[] p[i].mIndices;
+        }
+        p = nullptr;
+    }
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void MoveSceneToArena(aiScene* scene) {
+    ScenePrivateData* priv = ScenePriv(scene);
+    if (nullptr == priv) {
+        return;
+    }
+
+    MeasureVisitor measure = { priv->mArena, 0 };
+    VisitSceneArrays(scene, measure);
+    if (0 == measure.mBytes) {
+        return;
+    }
+
+    if (nullptr == priv->mArena) {
+        priv->mArena = new MemoryArena();
+    }
+    priv->mArena->Reserve(measure.mBytes);
+
+    MoveInVisitor move = { priv->mArena };
+    VisitSceneArrays(scene, move);
+}
+
+// ------------------------------------------------------------------------------------------------
+void MoveSceneFromArena(aiScene* scene) {
+    ScenePrivateData* priv = ScenePriv(scene);
+    if (nullptr == priv || nullptr == priv->mArena) {
+        return;
+    }
+
+    MoveOutVisitor move = { priv->mArena };
+    VisitSceneArrays(scene, move);
+
+    delete priv->mArena;
+    priv->mArena = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ReleaseSceneArena(aiScene* scene) {
+    ScenePrivateData* priv = ScenePriv(scene);
+    if (nullptr == priv || nullptr == priv->mArena) {
+        return;
+    }
+
+    DetachVisitor detach = { priv->mArena };
+    VisitSceneArrays(scene, detach);
+
+    delete priv->mArena;
+    priv->mArena = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+const MemoryArena* GetSceneArena(const aiScene* scene) {
+    const ScenePrivateData* priv = ScenePriv(scene);
+    return priv ? priv->mArena : nullptr;
+}
+
+} // Namespace Assimp
@@ -0,0 +1,107 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SceneArena.h
+ *  @brief Compacts the bulk data of a finished scene into a single arena owned
+ *    by the scene.
+ *
+ *  A scene built by the loaders consists of a separate heap allocation for every
+ *  face index array or index buffer, vertex stream, bone weight table, node mesh list, material
+ *  property value and animation key track. Freeing such a scene costs one call to
+ *  the allocator per array, and keeping many of them alive fragments the heap.
+ *  Once a scene is final, these arrays can be relocated into one MemoryArena that
+ *  is released in a single step by aiScene::~aiScene. The relocation copies the
+ *  data once; building the scene still costs one allocation per array, because
+ *  the loaders and post-processing steps manage the arrays with new[]/delete[].
+ *
+ *  The meshes, nodes, materials and other objects themselves stay on the heap;
+ *  only the arrays they point to are moved. Code that frees or replaces these
+ *  arrays - all post-processing steps do - must move the scene back to the heap
+ *  with MoveSceneFromArena() first. Importer::ApplyPostProcessing() does so.
+ */
+#ifndef AI_SCENEARENA_H_INC
+#define AI_SCENEARENA_H_INC
+
+#include <assimp/defs.h>
+
+struct aiScene;
+
+namespace Assimp {
+
+class MemoryArena;
+
+// ---------------------------------------------------------------------------
+/** @brief Moves the arrays of a scene into the scene's arena.
+ *
+ *  The arena is created if the scene doesn't have one yet; the storage for
+ *  all arrays still on the heap is then allocated as one block. Calling the
+ *  function again on an unchanged scene does nothing.
+ *  @param scene Scene to compact
+ */
+ASSIMP_API void MoveSceneToArena(aiScene* scene);
+
+// ---------------------------------------------------------------------------
+/** @brief Moves all arrays of a scene back to the heap and releases its arena.
+ *
+ *  Afterwards the scene can be modified with new[]/delete[] again.
+ *  @param scene Scene to expand, does nothing if it doesn't own an arena.
+ */
+ASSIMP_API void MoveSceneFromArena(aiScene* scene);
+
+// ---------------------------------------------------------------------------
+/** @brief Detaches all arrays from a scene that live in its arena, so that the
+ *  destructors of the scene's objects skip them, and releases the arena.
+ *
+ *  Called by aiScene::~aiScene(), there is no need to call it manually.
+ *  @param scene Scene being destroyed
+ */
+ASSIMP_API void ReleaseSceneArena(aiScene* scene);
+
+// ---------------------------------------------------------------------------
+/** @brief Returns the arena of a scene, nullptr if the scene's arrays are
+ *  all allocated on the heap.
+ */
+ASSIMP_API const MemoryArena* GetSceneArena(const aiScene* scene);
+
+} // Namespace Assimp
+
+#endif // AI_SCENEARENA_H_INC
@@ -57,6 +57,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/fast_atof.h>
 #include <assimp/metadata.h>
 #include <assimp/Hash.h>
+#include <assimp/IndexBuffer.h>
+#include <assimp/PackedVertices.h>
 #include "time.h"
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/scene.h>
@@ -449,6 +451,10 @@ void SceneCombiner::MergeScenes(aiScene** _dest, aiScene* master, std::vector<At
 
                 // update the material index of the mesh
                 (*pip)->mMaterialIndex +=  offset[n];
+
+                // and its levels of detail, which are stored in the same scene
+                for (unsigned int a = 0; a < (*pip)->mNumLODs;++a)
+                    (*pip)->mLODs[a] += cnt;
                 ++pip;
             }
 
@@ -1087,10 +1093,33 @@ void SceneCombiner::Copy( aiMesh** _dest, const aiMesh* src ) {
 
     // make a deep copy of all faces
     GetArrayCopy(dest->mFaces,dest->mNumFaces);
-    for (unsigned int i = 0; i < dest->mNumFaces;++i) {
+    for (unsigned int i = 0; dest->mFaces && i < dest->mNumFaces;++i) {
         aiFace& f = dest->mFaces[i];
         GetArrayCopy(f.mIndices,f.mNumIndices);
     }
+
+    GetArrayCopy(dest->mMeshlets, dest->mNumMeshlets);
+    GetArrayCopy(dest->mMeshletVertices, dest->mNumMeshletVertices);
+    GetArrayCopy(dest->mMeshletIndices, dest->mNumMeshletIndices);
+    GetArrayCopy(dest->mLODs, dest->mNumLODs);
+
+    // copies always use the classic face and vertex layout
+    if (src->mIndexBuffer) {
+        dest->mIndexBuffer = nullptr;
+        const unsigned int numWords = (src->mNumIndices * src->mIndexSize + 3) / 4;
+        unsigned int* buffer = new unsigned int[numWords];
+        ::memcpy(buffer, src->mIndexBuffer, numWords * sizeof(unsigned int));
+        dest->mIndexBuffer = buffer;
+        ExpandIndexBuffer(dest);
+    }
+    if (src->mPackedVertices) {
+        dest->mPackedVertices = nullptr;
+        const unsigned int numWords = src->mNumVertices * (src->mPackedLayout.mStride / 4);
+        unsigned int* buffer = new unsigned int[numWords];
+        ::memcpy(buffer, src->mPackedVertices, numWords * sizeof(unsigned int));
+        dest->mPackedVertices = buffer;
+        ExpandPackedVertices(dest);
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -53,6 +53,7 @@ namespace Assimp {
 
 // Forward declarations
 class Importer;
+class MemoryArena;
 
 struct ScenePrivateData {
     //  The struct constructor.
@@ -71,13 +72,18 @@ struct ScenePrivateData {
     // and mOrigImporter are no longer safe to rely on and only
     // serve informative purposes.
     bool mIsCopy;
+
+    // Arena holding the bulk arrays of the scene, see SceneArena.h.
+    // If set, this object is owned by this private data instance.
+    MemoryArena* mArena;
 };
 
 inline
 ScenePrivateData::ScenePrivateData() AI_NO_EXCEPT
 : mOrigImporter( nullptr )
 , mPPStepsApplied( 0 )
-, mIsCopy( false ) {
+, mIsCopy( false )
+, mArena( nullptr ) {
     // empty
 }
 
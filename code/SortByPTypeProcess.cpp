@@ -148,6 +148,10 @@ void SortByPTypeProcess::Execute( aiScene* pScene) {
 
     std::vector<unsigned int> replaceMeshIndex(pScene->mNumMeshes*4,UINT_MAX);
     std::vector<unsigned int>::iterator meshIdx = replaceMeshIndex.begin();
+
+    // new index of each mesh which is kept as it is, for aiMesh::mLODs
+    const unsigned int numOldMeshes = pScene->mNumMeshes;
+    std::vector<unsigned int> meshMapping(numOldMeshes,UINT_MAX);
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
         aiMesh* const mesh = pScene->mMeshes[i];
         ai_assert(0 != mesh->mPrimitiveTypes);
@@ -173,7 +177,7 @@ void SortByPTypeProcess::Execute( aiScene* pScene) {
 
         if (1 == num) {
             if (!(configRemoveMeshes & mesh->mPrimitiveTypes)) {
-                *meshIdx = static_cast<unsigned int>( outMeshes.size() );
+                *meshIdx = meshMapping[i] = static_cast<unsigned int>( outMeshes.size() );
                 outMeshes.push_back(mesh);
             } else {
                 delete mesh;
@@ -388,6 +392,11 @@ void SortByPTypeProcess::Execute( aiScene* pScene) {
     }
     ::memcpy(pScene->mMeshes,&outMeshes[0],pScene->mNumMeshes*sizeof(void*));
 
+    if (bAnyChanges)
+    {
+        UpdateMeshLODs(pScene,&meshMapping[0],numOldMeshes);
+    }
+
     if (!DefaultLogger::isNullLogger())
     {
         char buffer[1024];
@@ -46,8 +46,25 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/SpatialSort.h>
 #include <assimp/ai_assert.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace Assimp;
 
+namespace {
+
+    // Backend_Auto keeps the plane sort for small meshes, where sorting is cheap and the
+    // slab to scan is short anyway.
+    const size_t AutoGridMinPositions = 1024;
+
+    // Backend_Auto falls back to the plane sort if a single cell holds more than this
+    // fraction of the positions, i.e. if a few outliers stretch the bounding box so far
+    // that the actual geometry ends up in a handful of cells.
+    const size_t AutoGridMaxCellShare = 16;
+
+} // namespace
+
 // CHAR_BIT seems to be defined under MVSC, but not under GCC. Pray that the correct value is 8.
 #ifndef CHAR_BIT
 #   define CHAR_BIT 8
@@ -61,16 +78,30 @@ SpatialSort::SpatialSort( const aiVector3D* pPositions, unsigned int pNumPositio
     // define the reference plane. We choose some arbitrary vector away from all basic axises
     // in the hope that no model spreads all its vertices along this plane.
     : mPlaneNormal(0.8523f, 0.34321f, 0.5736f)
+    , mPositions()
+    , mBackend(Backend_PlaneSort)
+    , mUseGrid(false)
+    , mGridMin()
+    , mInvCellSize(0)
+    , mCellStart()
 {
     mPlaneNormal.Normalize();
+    mGridDims[0] = mGridDims[1] = mGridDims[2] = 1;
     Fill(pPositions,pNumPositions,pElementOffset);
 }
 
 // ------------------------------------------------------------------------------------------------
 SpatialSort :: SpatialSort()
 : mPlaneNormal(0.8523f, 0.34321f, 0.5736f)
+, mPositions()
+, mBackend(Backend_PlaneSort)
+, mUseGrid(false)
+, mGridMin()
+, mInvCellSize(0)
+, mCellStart()
 {
     mPlaneNormal.Normalize();
+    mGridDims[0] = mGridDims[1] = mGridDims[2] = 1;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -89,12 +120,177 @@ void SpatialSort::Fill( const aiVector3D* pPositions, unsigned int pNumPositions
     Append(pPositions,pNumPositions,pElementOffset,pFinalize);
 }
 
+// ------------------------------------------------------------------------------------------------
+void SpatialSort::SetBackend( Backend pBackend)
+{
+    mBackend = pBackend;
+}
+
+// ------------------------------------------------------------------------------------------------
+SpatialSort::Backend SpatialSort::GetBackend() const
+{
+    return mBackend;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialSort::IsGridActive() const
+{
+    return mUseGrid;
+}
+
 // ------------------------------------------------------------------------------------------------
 void SpatialSort :: Finalize()
 {
+    mUseGrid = false;
+    mCellStart.clear();
+    if (mBackend != Backend_PlaneSort && BuildGrid()) {
+        mUseGrid = true;
+        return;
+    }
     std::sort( mPositions.begin(), mPositions.end());
 }
 
+// ------------------------------------------------------------------------------------------------
+bool SpatialSort::BuildGrid()
+{
+    const size_t count = mPositions.size();
+    if (mBackend == Backend_Auto && count < AutoGridMinPositions) {
+        return false;
+    }
+
+    aiVector3D minVec, maxVec;
+    if (count) {
+        minVec = maxVec = mPositions[0].mPosition;
+    }
+    for (size_t i = 1; i < count; ++i) {
+        const aiVector3D& v = mPositions[i].mPosition;
+        minVec.x = std::min(minVec.x, v.x); maxVec.x = std::max(maxVec.x, v.x);
+        minVec.y = std::min(minVec.y, v.y); maxVec.y = std::max(maxVec.y, v.y);
+        minVec.z = std::min(minVec.z, v.z); maxVec.z = std::max(maxVec.z, v.z);
+    }
+    const aiVector3D extent = maxVec - minVec;
+
+    // Choose the cell size so the grid has about as many cells as there are positions. Axes
+    // along which the data is thinner than a cell are collapsed to a single layer, so flat
+    // meshes get a 2D grid and curves a 1D one.
+    unsigned int order[3] = { 0, 1, 2 };
+    std::sort(order, order + 3, [&extent](unsigned int a, unsigned int b) {
+        return extent[a] > extent[b];
+    });
+    double cellSize = 0.0;
+    for (unsigned int dims = 3; dims > 0 && count; --dims) {
+        double volume = 1.0;
+        for (unsigned int a = 0; a < dims; ++a) {
+            volume *= extent[order[a]];
+        }
+        if (!(volume > 0.0)) {
+            continue;
+        }
+        const double size = std::pow(volume / count, 1.0 / dims);
+        if (extent[order[dims - 1]] >= size) {
+            cellSize = size;
+            break;
+        }
+    }
+
+    const ai_real invCellSize = cellSize > 0.0 ? static_cast<ai_real>(1.0 / cellSize) : ai_real(0.0);
+    unsigned int dims[3];
+    size_t numCells = 1;
+    for (unsigned int a = 0; a < 3; ++a) {
+        const double n = std::floor(extent[a] * invCellSize) + 1.0;
+        dims[a] = static_cast<unsigned int>(std::min(n, static_cast<double>(std::max(count, size_t(1)))));
+        numCells *= dims[a];
+    }
+    // can't happen for sane input, but guard against a degenerate cell size
+    if (numCells > 8 * count + 8) {
+        return false;
+    }
+
+    mGridMin = minVec;
+    mInvCellSize = invCellSize;
+    mGridDims[0] = dims[0];
+    mGridDims[1] = dims[1];
+    mGridDims[2] = dims[2];
+
+    // bucket the positions by cell with a counting sort, which keeps the original
+    // order of the positions within each cell
+    std::vector<unsigned int> cellOf(count);
+    std::vector<unsigned int> cellStart(numCells + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        unsigned int cell[3];
+        GetCell(mPositions[i].mPosition, cell);
+        cellOf[i] = (cell[2] * dims[1] + cell[1]) * dims[0] + cell[0];
+        ++cellStart[cellOf[i] + 1];
+    }
+
+    if (mBackend == Backend_Auto) {
+        const unsigned int densest = *std::max_element(cellStart.begin(), cellStart.end());
+        if (densest > count / AutoGridMaxCellShare) {
+            return false;
+        }
+    }
+
+    for (size_t c = 0; c < numCells; ++c) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    std::vector<Entry> sorted(count);
+    std::vector<unsigned int> next(cellStart.begin(), cellStart.end() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        sorted[next[cellOf[i]]++] = mPositions[i];
+    }
+    mPositions.swap(sorted);
+    mCellStart.swap(cellStart);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialSort::GetCell( const aiVector3D& pPosition, unsigned int pCell[3]) const
+{
+    for (unsigned int a = 0; a < 3; ++a) {
+        const ai_real f = (pPosition[a] - mGridMin[a]) * mInvCellSize;
+        if (!(f > 0)) {
+            pCell[a] = 0;
+        } else if (f >= static_cast<ai_real>(mGridDims[a] - 1)) {
+            pCell[a] = mGridDims[a] - 1;
+        } else {
+            pCell[a] = static_cast<unsigned int>(f);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Filter>
+void SpatialSort::VisitGridCells( const aiVector3D& pPosition, ai_real pRadius, Filter& pFilter) const
+{
+    if (mPositions.empty()) {
+        return;
+    }
+
+    unsigned int lo[3], hi[3];
+    GetCell(pPosition - aiVector3D(pRadius), lo);
+    GetCell(pPosition + aiVector3D(pRadius), hi);
+
+    // for huge radii, touching every cell is more expensive than just testing every position
+    const size_t numCells = size_t(hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1);
+    if (numCells > mPositions.size()) {
+        for (const Entry& e : mPositions) {
+            pFilter(e);
+        }
+        return;
+    }
+
+    for (unsigned int z = lo[2]; z <= hi[2]; ++z) {
+        for (unsigned int y = lo[1]; y <= hi[1]; ++y) {
+            const unsigned int row = (z * mGridDims[1] + y) * mGridDims[0];
+            const unsigned int begin = mCellStart[row + lo[0]], end = mCellStart[row + hi[0] + 1];
+            for (unsigned int i = begin; i < end; ++i) {
+                pFilter(mPositions[i]);
+            }
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void SpatialSort::Append( const aiVector3D* pPositions, unsigned int pNumPositions,
     unsigned int pElementOffset,
@@ -124,6 +320,17 @@ void SpatialSort::Append( const aiVector3D* pPositions, unsigned int pNumPositio
 void SpatialSort::FindPositions( const aiVector3D& pPosition,
     ai_real pRadius, std::vector<unsigned int>& poResults) const
 {
+    if (mUseGrid) {
+        poResults.clear();
+        const ai_real pSquared = pRadius*pRadius;
+        auto filter = [&](const Entry& e) {
+            if ((e.mPosition - pPosition).SquareLength() < pSquared)
+                poResults.push_back(e.mIndex);
+        };
+        VisitGridCells(pPosition, pRadius, filter);
+        return;
+    }
+
     const ai_real dist = pPosition * mPlaneNormal;
     const ai_real minDist = dist - pRadius, maxDist = dist + pRadius;
 
@@ -263,6 +470,21 @@ void SpatialSort::FindIdenticalPositions( const aiVector3D& pPosition,
     //  subtraction.
     static const int distance3DToleranceInULPs = distanceToleranceInULPs + 1;
 
+    if (mUseGrid) {
+        poResults.resize( 0 );
+
+        // Positions within the tolerance differ by far less than this, we just need to look
+        // into the neighbouring cells if the position lies right on a cell border.
+        const ai_real magnitude = std::max(std::fabs(pPosition.x), std::max(std::fabs(pPosition.y), std::fabs(pPosition.z)));
+        const ai_real searchBox = std::numeric_limits<ai_real>::epsilon() * 8 * (1 + magnitude);
+        auto filter = [&](const Entry& e) {
+            if( distance3DToleranceInULPs >= ToBinary((e.mPosition - pPosition).SquareLength()))
+                poResults.push_back(e.mIndex);
+        };
+        VisitGridCells(pPosition, searchBox, filter);
+        return;
+    }
+
     // Convert the plane distance to its signed integer representation so the ULPs tolerance can be
     //  applied. For some reason, VC won't optimize two calls of the bit pattern conversion.
     const BinFloat minDistBinary = ToBinary( pPosition * mPlaneNormal) - distanceToleranceInULPs;
@@ -311,6 +533,28 @@ void SpatialSort::FindIdenticalPositions( const aiVector3D& pPosition,
 // ------------------------------------------------------------------------------------------------
 unsigned int SpatialSort::GenerateMappingTable(std::vector<unsigned int>& fill, ai_real pRadius) const
 {
+    if (mUseGrid) {
+        // greedily assign each position which has not been mapped yet and all unmapped
+        // positions around it to a new output ID
+        fill.assign(mPositions.size(),UINT_MAX);
+        std::vector<unsigned int> found;
+        unsigned int t = 0;
+        for (const Entry& e : mPositions) {
+            if (fill[e.mIndex] != UINT_MAX) {
+                continue;
+            }
+            fill[e.mIndex] = t;
+            FindPositions(e.mPosition, pRadius, found);
+            for (unsigned int idx : found) {
+                if (fill[idx] == UINT_MAX) {
+                    fill[idx] = t;
+                }
+            }
+            ++t;
+        }
+        return t;
+    }
+
     fill.resize(mPositions.size(),UINT_MAX);
     ai_real dist, maxDist;
 
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers of the post-processing framework
 #include "SplitByBoneCountProcess.h"
+#include "ProcessHelper.h"
 #include <assimp/postprocess.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -109,6 +110,10 @@ void SplitByBoneCountProcess::Execute( aiScene* pScene)
     // build a new array of meshes for the scene
     std::vector<aiMesh*> meshes;
 
+    // new place of each mesh which is kept unchanged
+    const unsigned int numOldMeshes = pScene->mNumMeshes;
+    std::vector<unsigned int> mapping( numOldMeshes, UINT_MAX);
+
     for( unsigned int a = 0; a < pScene->mNumMeshes; ++a)
     {
         aiMesh* srcMesh = pScene->mMeshes[a];
@@ -132,6 +137,7 @@ void SplitByBoneCountProcess::Execute( aiScene* pScene)
         else
         {
             // Mesh is kept unchanged - store it's new place in the mesh array
+            mapping[a] = static_cast<unsigned int>(meshes.size());
             mSubMeshIndices[a].push_back( static_cast<unsigned int>(meshes.size()));
             meshes.push_back( srcMesh);
         }
@@ -145,6 +151,7 @@ void SplitByBoneCountProcess::Execute( aiScene* pScene)
 
     // recurse through all nodes and translate the node's mesh indices to fit the new mesh array
     UpdateNode( pScene->mRootNode);
+    UpdateMeshLODs( pScene, &mapping[0], numOldMeshes);
 
     ASSIMP_LOG_DEBUG( format() << "SplitByBoneCountProcess end: split " << mSubMeshIndices.size() << " meshes into " << meshes.size() << " submeshes." );
 }
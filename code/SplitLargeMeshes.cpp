@@ -82,6 +82,7 @@ void SplitLargeMeshesProcess_Triangle::Execute( aiScene* pScene) {
 
     if (avList.size() != pScene->mNumMeshes) {
         // it seems something has been split. rebuild the mesh list
+        const unsigned int numOld = pScene->mNumMeshes;
         delete[] pScene->mMeshes;
         pScene->mNumMeshes = (unsigned int)avList.size();
         pScene->mMeshes = new aiMesh*[avList.size()];
@@ -92,6 +93,7 @@ void SplitLargeMeshesProcess_Triangle::Execute( aiScene* pScene) {
 
         // now we need to update all nodes
         this->UpdateNode(pScene->mRootNode,avList);
+        SplitLargeMeshesProcess_Triangle::UpdateLODs(pScene,numOld,avList);
         ASSIMP_LOG_INFO("SplitLargeMeshesProcess_Triangle finished. Meshes have been split");
     } else {
         ASSIMP_LOG_DEBUG("SplitLargeMeshesProcess_Triangle finished. There was nothing to do");
@@ -135,6 +137,24 @@ void SplitLargeMeshesProcess_Triangle::UpdateNode(aiNode* pcNode,
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Update the levels of detail after some meshes have been split
+void SplitLargeMeshesProcess_Triangle::UpdateLODs(aiScene* pScene, unsigned int numOld,
+        const std::vector<std::pair<aiMesh*, unsigned int> >& avList) {
+    // a mesh which has been split doesn't exist as a whole anymore
+    std::vector<unsigned int> mapping(numOld,UINT_MAX), count(numOld,0);
+    for (unsigned int a = 0; a < avList.size();++a) {
+        mapping[avList[a].second] = a;
+        ++count[avList[a].second];
+    }
+    for (unsigned int i = 0; i < numOld;++i) {
+        if (count[i] != 1) {
+            mapping[i] = UINT_MAX;
+        }
+    }
+    UpdateMeshLODs(pScene,&mapping[0],numOld);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void SplitLargeMeshesProcess_Triangle::SplitMesh(
@@ -367,6 +387,7 @@ void SplitLargeMeshesProcess_Vertex::Execute( aiScene* pScene) {
 
     if (avList.size() != pScene->mNumMeshes) {
         // it seems something has been split. rebuild the mesh list
+        const unsigned int numOld = pScene->mNumMeshes;
         delete[] pScene->mMeshes;
         pScene->mNumMeshes = (unsigned int)avList.size();
         pScene->mMeshes = new aiMesh*[avList.size()];
@@ -377,6 +398,7 @@ void SplitLargeMeshesProcess_Vertex::Execute( aiScene* pScene) {
 
         // now we need to update all nodes
         SplitLargeMeshesProcess_Triangle::UpdateNode(pScene->mRootNode,avList);
+        SplitLargeMeshesProcess_Triangle::UpdateLODs(pScene,numOld,avList);
         ASSIMP_LOG_INFO("SplitLargeMeshesProcess_Vertex finished. Meshes have been split");
     } else {
         ASSIMP_LOG_DEBUG("SplitLargeMeshesProcess_Vertex finished. There was nothing to do");
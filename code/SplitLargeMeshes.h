@@ -140,6 +140,12 @@ public:
     static void UpdateNode(aiNode* pcNode,
         const std::vector<std::pair<aiMesh*, unsigned int> >& avList);
 
+    // -------------------------------------------------------------------
+    //! Update the levels of detail of all meshes after a few
+    //! meshes have been split
+    static void UpdateLODs(aiScene* pScene, unsigned int numOld,
+        const std::vector<std::pair<aiMesh*, unsigned int> >& avList);
+
 public:
     //! Triangle limit
     unsigned int LIMIT;
@@ -198,7 +204,7 @@ public:
     void SplitMesh (unsigned int a, aiMesh* pcMesh,
         std::vector<std::pair<aiMesh*, unsigned int> >& avList);
 
-    // NOTE: Reuse SplitLargeMeshesProcess_Triangle::UpdateNode()
+    // NOTE: Reuse SplitLargeMeshesProcess_Triangle::UpdateNode() and UpdateLODs()
 
 public:
     //! Triangle limit
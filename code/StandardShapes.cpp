@@ -148,7 +148,7 @@ aiMesh* StandardShapes::MakeMesh(const std::vector<aiVector3D>& positions,
         aiFace& f = out->mFaces[i];
         f.mNumIndices = numIndices;
         f.mIndices = new unsigned int[numIndices];
-        for (unsigned int j = 0; i < numIndices; ++i, ++a) {
+        for (unsigned int j = 0; j < numIndices; ++j, ++a) {
             f.mIndices[j] = a;
         }
     }
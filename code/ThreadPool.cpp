@@ -0,0 +1,197 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.cpp
+ *  @brief Implementation of the ThreadPool helper class
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+using namespace Assimp;
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(unsigned int numThreads)
+: mWorkers()
+, mMutex()
+, mWorkAvailable()
+, mWorkDone()
+, mJob( nullptr )
+, mCount( 0 )
+, mNext( 0 )
+, mBusyWorkers( 0 )
+, mGeneration( 0 )
+, mShutdown( false )
+, mError() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    numThreads = ResolveThreadCount( static_cast<int>( numThreads ) );
+
+    // the calling thread is the first member of the pool
+    mWorkers.reserve( numThreads - 1 );
+    for ( unsigned int i = 1; i < numThreads; ++i ) {
+        mWorkers.push_back( std::thread( &ThreadPool::WorkerMain, this ) );
+    }
+#else
+    (void)numThreads;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mShutdown = true;
+    }
+    mWorkAvailable.notify_all();
+    for ( std::thread &worker : mWorkers ) {
+        worker.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetNumThreads() const {
+    return static_cast<unsigned int>( mWorkers.size() ) + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::ResolveThreadCount(int requested) {
+    if ( requested > 0 ) {
+        return static_cast<unsigned int>( requested );
+    }
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // hardware_concurrency() is allowed to return 0 if the value is not computable
+    return std::max( 1u, std::thread::hardware_concurrency() );
+#else
+    return 1;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::ParallelFor(unsigned int count, const std::function<void(unsigned int)>& job) {
+    if ( 0 == count ) {
+        return;
+    }
+
+    // Nothing to distribute, avoid waking up the workers
+    if ( mWorkers.empty() || 1 == count ) {
+        for ( unsigned int i = 0; i < count; ++i ) {
+            job( i );
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mJob = &job;
+        mCount = count;
+        mNext = 0;
+        mError = nullptr;
+        mBusyWorkers = static_cast<unsigned int>( mWorkers.size() );
+        ++mGeneration;
+    }
+    mWorkAvailable.notify_all();
+
+    // the calling thread helps out until the queue is drained
+    RunJobs();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock( mMutex );
+        mWorkDone.wait( lock, [this] { return 0 == mBusyWorkers; } );
+        mJob = nullptr;
+        error = mError;
+        mError = nullptr;
+    }
+
+    if ( error ) {
+        std::rethrow_exception( error );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::WorkerMain() {
+    unsigned int seen = 0;
+    for ( ;; ) {
+        {
+            std::unique_lock<std::mutex> lock( mMutex );
+            mWorkAvailable.wait( lock, [this, seen] { return mShutdown || mGeneration != seen; } );
+            if ( mShutdown ) {
+                return;
+            }
+            seen = mGeneration;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock( mMutex );
+            if ( 0 == --mBusyWorkers ) {
+                mWorkDone.notify_all();
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::RunJobs() {
+    for ( ;; ) {
+        const unsigned int i = mNext.fetch_add( 1 );
+        if ( i >= mCount ) {
+            return;
+        }
+
+        try {
+            ( *mJob )( i );
+        } catch ( ... ) {
+            std::lock_guard<std::mutex> lock( mMutex );
+            if ( !mError ) {
+                mError = std::current_exception();
+            }
+
+            // stop handing out further work items
+            mNext = mCount;
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.h
+ *  @brief Defines a small worker pool used to run independent jobs concurrently.
+ */
+#ifndef AI_THREADPOOL_H_INC
+#define AI_THREADPOOL_H_INC
+
+#include <assimp/defs.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A fixed-size pool of worker threads.
+ *
+ *  The pool is used by post-processing steps (and some importers) to spread
+ *  independent work items, such as the meshes of a scene, across cores. The
+ *  calling thread always takes part in the work, so a pool of N threads spawns
+ *  N-1 workers. If the library was built with ASSIMP_BUILD_SINGLETHREADED no
+ *  workers are spawned at all and every job runs on the calling thread.
+ *
+ *  @note ParallelFor() is not reentrant: a job must not call ParallelFor() on
+ *  the same pool, and the pool may only be driven by one thread at a time.
+ */
+class ASSIMP_API ThreadPool {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Constructs the pool.
+     *  @param numThreads Total number of threads to use, including the
+     *    calling thread. 0 selects the number of hardware threads.
+     */
+    explicit ThreadPool(unsigned int numThreads);
+
+    /** Joins all workers. */
+    ~ThreadPool();
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the number of threads the pool runs jobs on,
+     *  including the calling thread. */
+    unsigned int GetNumThreads() const;
+
+    // -------------------------------------------------------------------
+    /** @brief Invokes job(i) for every i in [0,count) and blocks until all
+     *  invocations have returned.
+     *
+     *  The order in which the indices are processed is unspecified. If a
+     *  job throws, no further indices are handed out and the first
+     *  exception is rethrown on the calling thread once all workers are idle.
+     *  @param count Number of work items
+     *  @param job   Function to be called for each work item
+     */
+    void ParallelFor(unsigned int count, const std::function<void(unsigned int)>& job);
+
+    // -------------------------------------------------------------------
+    /** @brief Maps a user-supplied thread count to the number of threads
+     *  to use. 0 or negative values select the number of hardware threads.
+     */
+    static unsigned int ResolveThreadCount(int requested);
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void WorkerMain();
+    void RunJobs();
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkDone;
+
+    const std::function<void(unsigned int)>* mJob;
+    unsigned int mCount;
+    std::atomic<unsigned int> mNext;
+    unsigned int mBusyWorkers;
+    unsigned int mGeneration;
+    bool mShutdown;
+    std::exception_ptr mError;
+};
+
+} // namespace Assimp
+
+#endif // AI_THREADPOOL_H_INC
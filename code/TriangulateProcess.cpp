@@ -64,6 +64,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProcessHelper.h"
 #include "PolyTools.h"
 #include <memory>
+#include <atomic>
 
 //#define AI_BUILD_TRIANGULATE_COLOR_FACE_WINDING
 //#define AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -102,15 +103,14 @@ void TriangulateProcess::Execute( aiScene* pScene)
 {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
+    std::atomic<bool> bHas(false);
+    ExecutePerMesh(pScene, [&](unsigned int a) {
         if (pScene->mMeshes[ a ]) {
             if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
                 bHas = true;
             }
         }
-    }
+    });
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
@@ -513,6 +513,68 @@ void ValidateDSProcess::Validate( const aiMesh* pMesh)
     {
         ReportError("aiMesh::mBones is non-null although there are no bones");
     }
+
+    // validate the meshlets, each must stay inside of the shared arrays
+    if (pMesh->mNumMeshlets)
+    {
+        if (!pMesh->mMeshlets || !pMesh->mMeshletVertices || !pMesh->mMeshletIndices)
+        {
+            ReportError("aiMesh::mMeshlets, mMeshletVertices or mMeshletIndices is NULL "
+                "(aiMesh::mNumMeshlets is %i)",pMesh->mNumMeshlets);
+        }
+        for (unsigned int i = 0; i < pMesh->mNumMeshletVertices;++i)
+        {
+            if (pMesh->mMeshletVertices[i] >= pMesh->mNumVertices)
+            {
+                ReportError("aiMesh::mMeshletVertices[%i] is out of range",i);
+            }
+        }
+        for (unsigned int i = 0; i < pMesh->mNumMeshlets;++i)
+        {
+            const aiMeshlet& meshlet = pMesh->mMeshlets[i];
+            if (meshlet.mVertexOffset + meshlet.mVertexCount > pMesh->mNumMeshletVertices ||
+                meshlet.mTriangleOffset + meshlet.mTriangleCount * 3 > pMesh->mNumMeshletIndices)
+            {
+                ReportError("aiMesh::mMeshlets[%i] exceeds the meshlet vertex or index array",i);
+            }
+            for (unsigned int a = 0; a < meshlet.mTriangleCount * 3;++a)
+            {
+                if (pMesh->mMeshletIndices[meshlet.mTriangleOffset + a] >= meshlet.mVertexCount)
+                {
+                    ReportError("aiMesh::mMeshlets[%i] references a vertex it doesn't contain",i);
+                }
+            }
+        }
+    }
+    else if (pMesh->mMeshlets)
+    {
+        ReportError("aiMesh::mMeshlets is non-null although there are no meshlets");
+    }
+
+    // check the levels of detail
+    if (pMesh->mNumLODs)
+    {
+        if (!pMesh->mLODs)
+        {
+            ReportError("aiMesh::mLODs is NULL (aiMesh::mNumLODs is %i)",pMesh->mNumLODs);
+        }
+        for (unsigned int i = 0; i < pMesh->mNumLODs;++i)
+        {
+            if (pMesh->mLODs[i] >= mScene->mNumMeshes)
+            {
+                ReportError("aiMesh::mLODs[%i] is out of range (maximum is %i)",
+                    i,mScene->mNumMeshes-1);
+            }
+            if (mScene->mMeshes[pMesh->mLODs[i]] == pMesh)
+            {
+                ReportError("aiMesh::mLODs[%i] references the mesh itself",i);
+            }
+        }
+    }
+    else if (pMesh->mLODs)
+    {
+        ReportError("aiMesh::mLODs is non-null although there are no levels of detail");
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
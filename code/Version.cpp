@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/version.h>
 #include <assimp/scene.h>
 #include "ScenePrivate.h"
+#include "SceneArena.h"
 
 static const unsigned int MajorVersion = 4;
 static const unsigned int MinorVersion = 1;
@@ -139,6 +140,9 @@ ASSIMP_API aiScene::aiScene()
 
 // ------------------------------------------------------------------------------------------------
 ASSIMP_API aiScene::~aiScene() {
+    // arrays held by the arena must not be deleted one by one
+    Assimp::ReleaseSceneArena(this);
+
     // delete all sub-objects recursively
     delete mRootNode;
 
@@ -482,6 +482,44 @@ namespace glTF2
             return Indexer(*this);
         }
 
+        //! Typed, read-only view of the elements. Reads them straight from the
+        //! buffer, which may be memory mapped, instead of copying it first.
+        template<class T>
+        class View
+        {
+            friend struct Accessor;
+
+            const uint8_t* data;
+            size_t count, elemSize, stride;
+
+            View(Accessor& acc);
+
+        public:
+
+            inline bool IsValid() const
+            {
+                return data != 0;
+            }
+
+            inline size_t Count() const
+            {
+                return count;
+            }
+
+            //! Accesses the i-th value, components not present in the accessor
+            //! keep the value of a default constructed T
+            inline T operator[](size_t i) const;
+
+            //! Copies all elements to out, which must hold Count() values
+            inline void CopyTo(T* out) const;
+        };
+
+        template<class T>
+        inline View<T> GetView()
+        {
+            return View<T>(*this);
+        }
+
         Accessor() {}
         void Read(Value& obj, Asset& r);
     };
@@ -575,6 +613,11 @@ namespace glTF2
 
         bool LoadFromStream(IOStream& stream, size_t length = 0, size_t baseOffset = 0);
 
+        /// \fn bool LoadFromStream(const shared_ptr<IOStream>& stream, size_t length, size_t baseOffset)
+        /// Same as above, but if the stream provides its contents in memory (see IOStream::GetMappedData())
+        /// the buffer refers to them instead of making a copy. The buffer keeps the stream alive then.
+        bool LoadFromStream(const shared_ptr<IOStream>& stream, size_t length = 0, size_t baseOffset = 0);
+
 		/// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
 		/// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
 		/// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
@@ -387,11 +387,9 @@ inline void Buffer::Read(Value& obj, Asset& r)
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir + "/") : "";
 
-            IOStream* file = r.OpenFile(dir + uri, "rb");
+            shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
-
+                bool ok = LoadFromStream(file, byteLength);
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"" + std::string(uri) + "\"" );
             }
@@ -418,6 +416,25 @@ inline bool Buffer::LoadFromStream(IOStream& stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromStream(const shared_ptr<IOStream>& stream, size_t length, size_t baseOffset)
+{
+    const uint8_t* mapped = stream->GetMappedData();
+    if (!mapped) {
+        return LoadFromStream(*stream, length, baseOffset);
+    }
+
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
+    if (baseOffset > fileSize || byteLength > fileSize - baseOffset) {
+        return false;
+    }
+
+    // Share ownership of the stream so the mapping outlives the buffer. Imported
+    // buffers are never written to, so dropping the const is safe.
+    mData = shared_ptr<uint8_t>(stream, const_cast<uint8_t*>(mapped + baseOffset));
+    return true;
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
 {
 	// Check pointer to data
@@ -640,28 +657,11 @@ namespace {
 template<class T>
 bool Accessor::ExtractData(T*& outData)
 {
-    uint8_t* data = GetPointer();
-    if (!data) return false;
-
-    const size_t elemSize = GetElementSize();
-    const size_t totalSize = elemSize * count;
-
-    const size_t stride = bufferView && bufferView->byteStride ? bufferView->byteStride : elemSize;
-
-    const size_t targetElemSize = sizeof(T);
-    ai_assert(elemSize <= targetElemSize);
-
-    ai_assert(count*stride <= bufferView->byteLength);
+    const View<T> view = GetView<T>();
+    if (!view.IsValid()) return false;
 
     outData = new T[count];
-    if (stride == elemSize && targetElemSize == elemSize) {
-        memcpy(outData, data, totalSize);
-    }
-    else {
-        for (size_t i = 0; i < count; ++i) {
-            memcpy(outData + i, data + i*stride, elemSize);
-        }
-    }
+    view.CopyTo(outData);
 
     return true;
 }
@@ -703,6 +703,46 @@ T Accessor::Indexer::GetValue(int i)
     return value;
 }
 
+template<class T>
+inline Accessor::View<T>::View(Accessor& acc)
+    : data(acc.GetPointer())
+    , count(acc.count)
+    , elemSize(acc.GetElementSize())
+    , stride(acc.bufferView && acc.bufferView->byteStride ? acc.bufferView->byteStride : elemSize)
+{
+    ai_assert(elemSize <= sizeof(T));
+    ai_assert(!data || count*stride <= acc.bufferView->byteLength);
+}
+
+template<class T>
+inline T Accessor::View<T>::operator[](size_t i) const
+{
+    ai_assert(data && i < count);
+    T value = T();
+    if (elemSize == sizeof(T)) {
+        // constant size, compiles to a plain (unaligned) load
+        memcpy(&value, data + i*stride, sizeof(T));
+    }
+    else {
+        memcpy(&value, data + i*stride, elemSize);
+    }
+    return value;
+}
+
+template<class T>
+inline void Accessor::View<T>::CopyTo(T* out) const
+{
+    ai_assert(data);
+    if (stride == elemSize && elemSize == sizeof(T)) {
+        memcpy(out, data, count * sizeof(T));
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (*this)[i];
+    }
+}
+
 inline Image::Image()
     : width(0)
     , height(0)
@@ -1347,7 +1387,7 @@ inline void Asset::Load(const std::string& pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -73,6 +73,10 @@ namespace {
         aiVector3D xyz;
         ai_real w;
     };
+
+    struct VertexWeights { float values[4]; };
+    struct VertexJoints8 { uint8_t values[4]; };
+    struct VertexJoints16 { uint16_t values[4]; };
 } // namespace
 
 //
@@ -422,19 +426,17 @@ void glTF2Importer::ImportMeshes(glTF2::Asset& r)
                 // only extract tangents if normals are present
                 if (attr.tangent.size() > 0 && attr.tangent[0]) {
                     // generate bitangents from normals and tangents according to spec
-                    Tangent *tangents = nullptr;
-
-                    attr.tangent[0]->ExtractData(tangents);
-
-                    aim->mTangents = new aiVector3D[aim->mNumVertices];
-                    aim->mBitangents = new aiVector3D[aim->mNumVertices];
-
-                    for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                        aim->mTangents[i] = tangents[i].xyz;
-                        aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
+                    const Accessor::View<Tangent> tangents = attr.tangent[0]->GetView<Tangent>();
+                    if (tangents.IsValid() && tangents.Count() >= aim->mNumVertices) {
+                        aim->mTangents = new aiVector3D[aim->mNumVertices];
+                        aim->mBitangents = new aiVector3D[aim->mNumVertices];
+
+                        for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                            const Tangent tangent = tangents[i];
+                            aim->mTangents[i] = tangent.xyz;
+                            aim->mBitangents[i] = (aim->mNormals[i] ^ tangent.xyz) * tangent.w;
+                        }
                     }
-
-                    delete [] tangents;
                 }
             }
 
@@ -444,8 +446,11 @@ void glTF2Importer::ImportMeshes(glTF2::Asset& r)
                         "\" does not match the vertex count");
                     continue;
                 }
-                aim->mColors[c] = new aiColor4D[attr.color[c]->count];
-                attr.color[c]->ExtractData(aim->mColors[c]);
+                const Accessor::View<aiColor4D> colors = attr.color[c]->GetView<aiColor4D>();
+                if (colors.IsValid()) {
+                    aim->mColors[c] = new aiColor4D[colors.Count()];
+                    colors.CopyTo(aim->mColors[c]);
+                }
             }
             for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
                 if (attr.texcoord[tc]->count != aim->mNumVertices) {
@@ -454,11 +459,16 @@ void glTF2Importer::ImportMeshes(glTF2::Asset& r)
                     continue;
                 }
 
-                attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc]);
+                const Accessor::View<aiVector3D> uvs = attr.texcoord[tc]->GetView<aiVector3D>();
+                if (!uvs.IsValid()) {
+                    continue;
+                }
+
                 aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
 
-                aiVector3D* values = aim->mTextureCoords[tc];
+                aiVector3D* values = aim->mTextureCoords[tc] = new aiVector3D[aim->mNumVertices];
                 for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                    values[i] = uvs[i];
                     values[i].y = 1 - values[i].y; // Flip Y coords
                 }
             }
@@ -473,35 +483,33 @@ void glTF2Importer::ImportMeshes(glTF2::Asset& r)
                     Mesh::Primitive::Target& target = targets[i];
 
                     if (target.position.size() > 0) {
-                        aiVector3D *positionDiff = nullptr;
-                        target.position[0]->ExtractData(positionDiff);
-                        for(unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                            aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
+                        const Accessor::View<aiVector3D> positionDiff = target.position[0]->GetView<aiVector3D>();
+                        if (positionDiff.IsValid()) {
+                            for(unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                                aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
+                            }
                         }
-                        delete [] positionDiff;
                     }
                     if (target.normal.size() > 0) {
-                        aiVector3D *normalDiff = nullptr;
-                        target.normal[0]->ExtractData(normalDiff);
-                        for(unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                            aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
+                        const Accessor::View<aiVector3D> normalDiff = target.normal[0]->GetView<aiVector3D>();
+                        if (normalDiff.IsValid()) {
+                            for(unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                                aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
+                            }
                         }
-                        delete [] normalDiff;
                     }
                     if (target.tangent.size() > 0) {
-                        Tangent *tangent = nullptr;
-                        attr.tangent[0]->ExtractData(tangent);
-
-                        aiVector3D *tangentDiff = nullptr;
-                        target.tangent[0]->ExtractData(tangentDiff);
-
-                        for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
-                            tangent[vertexId].xyz += tangentDiff[vertexId];
-                            aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
-                            aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
+                        const Accessor::View<Tangent> tangents = attr.tangent[0]->GetView<Tangent>();
+                        const Accessor::View<aiVector3D> tangentDiff = target.tangent[0]->GetView<aiVector3D>();
+
+                        if (tangents.IsValid() && tangentDiff.IsValid()) {
+                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
+                                Tangent tangent = tangents[vertexId];
+                                tangent.xyz += tangentDiff[vertexId];
+                                aiAnimMesh.mTangents[vertexId] = tangent.xyz;
+                                aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent.xyz) * tangent.w;
+                            }
                         }
-                        delete [] tangent;
-                        delete [] tangentDiff;
                     }
                     if (mesh.weights.size() > i) {
                         aiAnimMesh.mWeight = mesh.weights[i];
@@ -741,52 +749,48 @@ static void GetNodeTransform(aiMatrix4x4& matrix, const glTF2::Node& node) {
     }
 }
 
-static void BuildVertexWeightMapping(Mesh::Primitive& primitive, std::vector<std::vector<aiVertexWeight>>& map)
+template <class Joints>
+static void BuildVertexWeightMapping(const Accessor::View<VertexWeights>& weights, const Accessor::View<Joints>& joints,
+        std::vector<std::vector<aiVertexWeight>>& map)
 {
-    Mesh::Primitive::Attributes& attr = primitive.attributes;
-    if (attr.weight.empty() || attr.joint.empty()) {
-        return;
-    }
-    if (attr.weight[0]->count != attr.joint[0]->count) {
-        return;
-    }
-
-    size_t num_vertices = attr.weight[0]->count;
-
-    struct Weights { float values[4]; };
-    Weights* weights = nullptr;
-    attr.weight[0]->ExtractData(weights);
-
-    struct Indices8 { uint8_t values[4]; };
-    struct Indices16 { uint16_t values[4]; };
-    Indices8* indices8 = nullptr;
-    Indices16* indices16 = nullptr;
-    if (attr.joint[0]->GetElementSize() == 4) {
-        attr.joint[0]->ExtractData(indices8);
-    }else {
-        attr.joint[0]->ExtractData(indices16);
-    }
-    // 
-    if (nullptr == indices8 && nullptr == indices16) {
+    if (!weights.IsValid() || !joints.IsValid()) {
         // Something went completely wrong!
         ai_assert(false);
         return;
     }
 
+    const size_t num_vertices = weights.Count();
     for (size_t i = 0; i < num_vertices; ++i) {
-        for (int j = 0; j < 4; ++j) {
-            const unsigned int bone = (indices8!=nullptr) ? indices8[i].values[j] : indices16[i].values[j];
-            const float weight = weights[i].values[j];
+        const VertexWeights w = weights[i];
+        const Joints j = joints[i];
+        for (int k = 0; k < 4; ++k) {
+            const unsigned int bone = j.values[k];
+            const float weight = w.values[k];
             if (weight > 0 && bone < map.size()) {
                 map[bone].reserve(8);
                 map[bone].emplace_back(static_cast<unsigned int>(i), weight);
             }
         }
     }
+}
 
-    delete[] weights;
-    delete[] indices8;
-    delete[] indices16;
+static void BuildVertexWeightMapping(Mesh::Primitive& primitive, std::vector<std::vector<aiVertexWeight>>& map)
+{
+    Mesh::Primitive::Attributes& attr = primitive.attributes;
+    if (attr.weight.empty() || attr.joint.empty()) {
+        return;
+    }
+    if (attr.weight[0]->count != attr.joint[0]->count) {
+        return;
+    }
+
+    // read both straight from the buffers, without intermediate copies
+    const Accessor::View<VertexWeights> weights = attr.weight[0]->GetView<VertexWeights>();
+    if (attr.joint[0]->GetElementSize() == 4) {
+        BuildVertexWeightMapping(weights, attr.joint[0]->GetView<VertexJoints8>(), map);
+    }else {
+        BuildVertexWeightMapping(weights, attr.joint[0]->GetView<VertexJoints16>(), map);
+    }
 }
 
 aiNode* ImportNode(aiScene* pScene, glTF2::Asset& r, std::vector<unsigned int>& meshOffsets, glTF2::Ref<glTF2::Node>& ptr)
@@ -926,18 +930,14 @@ aiNodeAnim* CreateNodeAnim(glTF2::Asset& r, Node& node, AnimationSamplers& sampl
     static const float kMillisecondsFromSeconds = 1000.f;
 
     if (samplers.translation) {
-        float* times = nullptr;
-        samplers.translation->input->ExtractData(times);
-        aiVector3D* values = nullptr;
-        samplers.translation->output->ExtractData(values);
+        const Accessor::View<float> times = samplers.translation->input->GetView<float>();
+        const Accessor::View<aiVector3D> values = samplers.translation->output->GetView<aiVector3D>();
         anim->mNumPositionKeys = static_cast<uint32_t>(samplers.translation->input->count);
         anim->mPositionKeys = new aiVectorKey[anim->mNumPositionKeys];
         for (unsigned int i = 0; i < anim->mNumPositionKeys; ++i) {
             anim->mPositionKeys[i].mTime = times[i] * kMillisecondsFromSeconds;
             anim->mPositionKeys[i].mValue = values[i];
         }
-        delete[] times;
-        delete[] values;
     } else if (node.translation.isPresent) {
         anim->mNumPositionKeys = 1;
         anim->mPositionKeys = new aiVectorKey();
@@ -948,21 +948,19 @@ aiNodeAnim* CreateNodeAnim(glTF2::Asset& r, Node& node, AnimationSamplers& sampl
     }
 
     if (samplers.rotation) {
-        float* times = nullptr;
-        samplers.rotation->input->ExtractData(times);
-        aiQuaternion* values = nullptr;
-        samplers.rotation->output->ExtractData(values);
+        const Accessor::View<float> times = samplers.rotation->input->GetView<float>();
+        const Accessor::View<aiQuaternion> values = samplers.rotation->output->GetView<aiQuaternion>();
         anim->mNumRotationKeys = static_cast<uint32_t>(samplers.rotation->input->count);
         anim->mRotationKeys = new aiQuatKey[anim->mNumRotationKeys];
         for (unsigned int i = 0; i < anim->mNumRotationKeys; ++i) {
+            // the view reinterprets glTF's (x, y, z, w) as assimp's (w, x, y, z)
+            const aiQuaternion value = values[i];
             anim->mRotationKeys[i].mTime = times[i] * kMillisecondsFromSeconds;
-            anim->mRotationKeys[i].mValue.x = values[i].w;
-            anim->mRotationKeys[i].mValue.y = values[i].x;
-            anim->mRotationKeys[i].mValue.z = values[i].y;
-            anim->mRotationKeys[i].mValue.w = values[i].z;
+            anim->mRotationKeys[i].mValue.x = value.w;
+            anim->mRotationKeys[i].mValue.y = value.x;
+            anim->mRotationKeys[i].mValue.z = value.y;
+            anim->mRotationKeys[i].mValue.w = value.z;
         }
-        delete[] times;
-        delete[] values;
     } else if (node.rotation.isPresent) {
         anim->mNumRotationKeys = 1;
         anim->mRotationKeys = new aiQuatKey();
@@ -974,18 +972,14 @@ aiNodeAnim* CreateNodeAnim(glTF2::Asset& r, Node& node, AnimationSamplers& sampl
     }
 
     if (samplers.scale) {
-        float* times = nullptr;
-        samplers.scale->input->ExtractData(times);
-        aiVector3D* values = nullptr;
-        samplers.scale->output->ExtractData(values);
+        const Accessor::View<float> times = samplers.scale->input->GetView<float>();
+        const Accessor::View<aiVector3D> values = samplers.scale->output->GetView<aiVector3D>();
         anim->mNumScalingKeys = static_cast<uint32_t>(samplers.scale->input->count);
         anim->mScalingKeys = new aiVectorKey[anim->mNumScalingKeys];
         for (unsigned int i = 0; i < anim->mNumScalingKeys; ++i) {
             anim->mScalingKeys[i].mTime = times[i] * kMillisecondsFromSeconds;
             anim->mScalingKeys[i].mValue = values[i];
         }
-        delete[] times;
-        delete[] values;
     } else if (node.scale.isPresent) {
         anim->mNumScalingKeys = 1;
         anim->mScalingKeys = new aiVectorKey();
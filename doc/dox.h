@@ -1310,7 +1310,15 @@ with 'slow' file formats like X or Collada might scale well with multiple concur
 
 @section automt Internal threading
 
-Internal multi-threading is not currently implemented.
+Post-processing steps which work on each mesh independently (#aiProcess_JoinIdenticalVertices,
+#aiProcess_GenSmoothNormals, #aiProcess_CalcTangentSpace, #aiProcess_Triangulate,
+#aiProcess_ImproveCacheLocality and #aiProcess_LimitBoneWeights) can distribute the meshes of a scene
+across a pool of worker threads. This is disabled by default; set the #AI_CONFIG_PP_NUM_THREADS
+property to the desired number of threads (or 0 for one thread per core) to enable it. The results
+are identical to a single-threaded run. Each #Assimp::Importer instance owns its own worker pool.
+
+If assimp is built with the CMake option ASSIMP_BUILD_SINGLETHREADED, no threads are spawned and the
+property is ignored.
 */
 
 /**
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_IOSTREAM_H_INC
 
 #include "types.h"
+#include <stdint.h>
 
 #ifndef __cplusplus
 #   error This header requires C++ to be used. aiFileIO.h is the \
@@ -122,6 +123,19 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Get direct access to the contents of the file
+     *
+     *  Streams which keep the whole file in memory (e.g. memory mapped
+     *  files or memory buffers) can return a pointer to the first byte
+     *  of the file here, so readers can parse the data in place instead
+     *  of copying it. The pointer does not depend on the read cursor and
+     *  stays valid until the stream is destroyed. The data must not be
+     *  modified.
+     *  @return Pointer to FileSize() bytes, NULL if the stream can't
+     *    provide it (default). */
+    virtual const uint8_t* GetMappedData() const;
 }; //! class IOStream
 
 // ----------------------------------------------------------------------------------
@@ -135,6 +149,12 @@ inline
 IOStream::~IOStream() {
     // empty
 }
+
+// ----------------------------------------------------------------------------------
+inline
+const uint8_t* IOStream::GetMappedData() const {
+    return NULL;
+}
 // ----------------------------------------------------------------------------------
 
 } //!namespace Assimp
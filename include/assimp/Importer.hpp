@@ -612,6 +612,18 @@ public:
      *   is (naturally) not included.*/
     void GetMemoryRequirements(aiMemoryInfo& in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns timing and memory statistics of the last import, broken
+     * down by the import phases and by each post-processing step.
+     *
+     * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is
+     * set. They are reset by #ReadFile() and extended by subsequent calls
+     * to #ApplyPostProcessing().
+     * @return NULL if no statistics have been collected. The pointer
+     *   remains valid until the next import or until the Importer is
+     *   destroyed. */
+    const aiImportStatistics* GetLastImportStatistics() const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
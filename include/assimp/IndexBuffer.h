@@ -0,0 +1,86 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file IndexBuffer.h
+ *  @brief Conversion between aiMesh::mFaces and the compact aiMesh::mIndexBuffer
+ */
+#ifndef AI_INDEXBUFFER_H_INC
+#define AI_INDEXBUFFER_H_INC
+
+#include <assimp/defs.h>
+
+struct aiMesh;
+struct aiScene;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Moves the faces of a triangle mesh into a contiguous index buffer.
+ *
+ *  On success aiMesh::mFaces is released and aiMesh::mIndexBuffer holds three
+ *  indices per triangle. The buffer is allocated as an array of unsigned int,
+ *  also if it holds 16 bit indices, and released by aiMesh::~aiMesh().
+ *  @param mesh Mesh to convert.
+ *  @param indexSize 2 to store 16 bit indices if the vertex count permits
+ *    it, 4 to always store 32 bit indices.
+ *  @return false if the mesh was left unchanged because it consists of
+ *    other primitives than triangles or has no faces.
+ */
+ASSIMP_API bool BuildIndexBuffer(aiMesh* mesh, unsigned int indexSize);
+
+// ---------------------------------------------------------------------------
+/** @brief Restores aiMesh::mFaces from the index buffer of a mesh and
+ *  releases the buffer. Meshes without an index buffer are left unchanged.
+ */
+ASSIMP_API void ExpandIndexBuffer(aiMesh* mesh);
+
+// ---------------------------------------------------------------------------
+/** @brief Calls BuildIndexBuffer() for all meshes of a scene. */
+ASSIMP_API void BuildIndexBuffers(aiScene* scene, unsigned int indexSize);
+
+// ---------------------------------------------------------------------------
+/** @brief Calls ExpandIndexBuffer() for all meshes of a scene. */
+ASSIMP_API void ExpandIndexBuffers(aiScene* scene);
+
+} // Namespace Assimp
+
+#endif // AI_INDEXBUFFER_H_INC
@@ -136,6 +136,12 @@ public:
         ai_assert(false); // won't be needed
     }
 
+    // -------------------------------------------------------------------
+    // The whole buffer is in memory anyways
+    const uint8_t* GetMappedData() const {
+        return buffer;
+    }
+
 private:
     const uint8_t* buffer;
     size_t length,pos;
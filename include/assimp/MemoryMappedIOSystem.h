@@ -0,0 +1,128 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MemoryMappedIOSystem.h
+ *  @brief IOSystem implementation which maps files into memory instead of reading them.
+ */
+#pragma once
+#ifndef AI_MEMORYMAPPEDIOSYSTEM_H_INC
+#define AI_MEMORYMAPPEDIOSYSTEM_H_INC
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+#include <string>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Read-only stream on top of a file that has been mapped into memory.
+ *
+ *  The stream hands out the mapping through GetMappedData(), so importers
+ *  which support it parse the file in place. The pages are loaded by the
+ *  operating system on demand and are not accounted as heap memory.
+ */
+class ASSIMP_API MemoryMappedIOStream : public IOStream {
+    friend class MemoryMappedIOSystem;
+
+protected:
+    MemoryMappedIOStream(const uint8_t* data, size_t length, const std::string& filename) AI_NO_EXCEPT;
+
+public:
+    /** Destructor, unmaps the file. */
+    ~MemoryMappedIOStream();
+
+    // -------------------------------------------------------------------
+    /// Read from stream
+    size_t Read(void* pvBuffer, size_t pSize, size_t pCount);
+
+    // -------------------------------------------------------------------
+    /// Write to stream, always fails
+    size_t Write(const void* pvBuffer, size_t pSize, size_t pCount);
+
+    // -------------------------------------------------------------------
+    /// Seek specific position
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin);
+
+    // -------------------------------------------------------------------
+    /// Get current seek position
+    size_t Tell() const;
+
+    // -------------------------------------------------------------------
+    /// Get size of file
+    size_t FileSize() const;
+
+    // -------------------------------------------------------------------
+    /// Flush file contents, nothing to do
+    void Flush();
+
+    // -------------------------------------------------------------------
+    /// Get the mapped file contents
+    const uint8_t* GetMappedData() const;
+
+private:
+    const uint8_t* mData;
+    size_t mLength;
+    size_t mPos;
+    std::string mFilename;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem which maps files opened for reading into memory.
+ *
+ *  Files opened for writing, and files which can't be mapped (e.g. empty
+ *  files or special files), are handled like in #DefaultIOSystem. Use it
+ *  via Importer::SetIOHandler() to avoid copying large input files:
+ *  @code
+ *  Assimp::Importer importer;
+ *  importer.SetIOHandler( new Assimp::MemoryMappedIOSystem );
+ *  @endcode
+ */
+class ASSIMP_API MemoryMappedIOSystem : public DefaultIOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. Read-only files are mapped. */
+    IOStream* Open( const char* pFile, const char* pMode = "rb");
+};
+
+} //!ns Assimp
+
+#endif //AI_MEMORYMAPPEDIOSYSTEM_H_INC
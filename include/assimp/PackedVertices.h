@@ -0,0 +1,104 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file PackedVertices.h
+ *  @brief Conversion between the vertex arrays of a mesh and the quantized
+ *    aiMesh::mPackedVertices, and access to single packed vertices
+ */
+#ifndef AI_PACKEDVERTICES_H_INC
+#define AI_PACKEDVERTICES_H_INC
+
+#include <assimp/defs.h>
+#include <assimp/vector3.h>
+#include <assimp/color4.h>
+
+struct aiMesh;
+struct aiScene;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Quantizes vertex streams of a mesh into one interleaved buffer.
+ *
+ *  On success the arrays of the packed streams are released and
+ *  aiMesh::mPackedVertices holds aiMesh::mPackedLayout.mStride bytes per
+ *  vertex. The buffer is allocated as an array of unsigned int and released
+ *  by aiMesh::~aiMesh().
+ *  @param mesh Mesh to convert.
+ *  @param streams Combination of the aiPackedVertexStream flags.
+ *  @return false if the mesh was left unchanged because it is packed
+ *    already or has none of the requested streams.
+ */
+ASSIMP_API bool BuildPackedVertices(aiMesh* mesh, unsigned int streams);
+
+// ---------------------------------------------------------------------------
+/** @brief Restores the vertex arrays from the packed vertices of a mesh,
+ *  with the precision of the packed data, and releases the buffer. Meshes
+ *  without packed vertices are left unchanged.
+ */
+ASSIMP_API void ExpandPackedVertices(aiMesh* mesh);
+
+// ---------------------------------------------------------------------------
+/** @brief Calls BuildPackedVertices() for all meshes of a scene. */
+ASSIMP_API void BuildPackedVertices(aiScene* scene, unsigned int streams);
+
+// ---------------------------------------------------------------------------
+/** @brief Calls ExpandPackedVertices() for all meshes of a scene. */
+ASSIMP_API void ExpandPackedVertices(aiScene* scene);
+
+// ---------------------------------------------------------------------------
+/** @brief Read a single vertex from a mesh, no matter whether the stream is
+ *  packed or not. A zero vector is returned for streams the mesh doesn't
+ *  have.
+ *  @param mesh The mesh to read from.
+ *  @param vertex Index of the vertex, less than aiMesh::mNumVertices.
+ */
+ASSIMP_API aiVector3D GetVertexPosition(const aiMesh* mesh, unsigned int vertex);
+ASSIMP_API aiVector3D GetVertexNormal(const aiMesh* mesh, unsigned int vertex);
+ASSIMP_API aiVector3D GetVertexTangent(const aiMesh* mesh, unsigned int vertex);
+ASSIMP_API aiVector3D GetVertexBitangent(const aiMesh* mesh, unsigned int vertex);
+ASSIMP_API aiVector3D GetVertexTextureCoords(const aiMesh* mesh, unsigned int channel, unsigned int vertex);
+ASSIMP_API aiColor4D GetVertexColor(const aiMesh* mesh, unsigned int set, unsigned int vertex);
+
+} // Namespace Assimp
+
+#endif // AI_PACKEDVERTICES_H_INC
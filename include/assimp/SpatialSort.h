@@ -55,12 +55,28 @@ namespace Assimp {
  * by their indices and sorts them by their distance to an arbitrary chosen plane.
  * You can then query the instance for all vertices close to a given position in an average O(log n)
  * time, with O(n) worst case complexity when all vertices lay on the plane. The plane is chosen
- * so that it avoids common planes in usual data sets. */
+ * so that it avoids common planes in usual data sets.
+ *
+ * Alternatively the positions can be bucketed into a uniform 3D grid sized to the bounding box
+ * of the data. Queries then only visit the cells overlapping the search radius, which avoids
+ * the slab scans the plane sort degrades to on large, flat or axis-aligned meshes. See #Backend.*/
 // ------------------------------------------------------------------------------------------------
 class ASSIMP_API SpatialSort
 {
 public:
 
+    /** Data structure used to answer the queries. */
+    enum Backend {
+        /** Choose by the number of positions and how evenly they fill the grid. */
+        Backend_Auto = 0,
+
+        /** Sort by the distance to a reference plane and binary search the queries. */
+        Backend_PlaneSort = 1,
+
+        /** Bucket the positions into a uniform 3D grid. */
+        Backend_Grid = 2
+    };
+
     SpatialSort();
 
     // ------------------------------------------------------------------------------------
@@ -79,6 +95,21 @@ public:
 
 public:
 
+    // ------------------------------------------------------------------------------------
+    /** Selects the data structure to be built by the next #Finalize(). The default is
+     *  #Backend_PlaneSort. Existing data is not rearranged until it is finalized again.
+     * @param pBackend The backend to use. */
+    void SetBackend( Backend pBackend);
+
+    // ------------------------------------------------------------------------------------
+    /** Returns the backend which has been selected with #SetBackend(). */
+    Backend GetBackend() const;
+
+    // ------------------------------------------------------------------------------------
+    /** Returns true if the last #Finalize() has built the grid, either because it was
+     *  requested explicitly or because #Backend_Auto picked it. */
+    bool IsGridActive() const;
+
     // ------------------------------------------------------------------------------------
     /** Sets the input data for the SpatialSort. This replaces existing data, if any.
      *  The new data receives new indices in ascending order.
@@ -116,7 +147,8 @@ public:
      * @param pPosition The position to look for vertices.
      * @param pRadius Maximal distance from the position a vertex may have to be counted in.
      * @param poResults The container to store the indices of the found positions.
-     *   Will be emptied by the call so it may contain anything.
+     *   Will be emptied by the call so it may contain anything. The order of the
+     *   indices depends on the backend.
      * @return An iterator to iterate over all vertices in the given area.*/
     void FindPositions( const aiVector3D& pPosition, ai_real pRadius,
         std::vector<unsigned int>& poResults) const;
@@ -165,8 +197,34 @@ protected:
         bool operator < (const Entry& e) const { return mDistance < e.mDistance; }
     };
 
-    // all positions, sorted by distance to the sorting plane
+    /** Builds the grid. Returns false if Backend_Auto is set and the positions
+     *  distribute too unevenly, nothing has been changed in this case. */
+    bool BuildGrid();
+
+    /** Returns the index of the grid cell containing the given position, clamped to the grid */
+    void GetCell( const aiVector3D& pPosition, unsigned int pCell[3]) const;
+
+    /** Collects all positions within a box of the given half extent around a position
+     *  and passes them to a filter, grid backend only. */
+    template <typename Filter>
+    void VisitGridCells( const aiVector3D& pPosition, ai_real pRadius, Filter& pFilter) const;
+
+    // all positions, sorted by distance to the sorting plane or by grid cell
     std::vector<Entry> mPositions;
+
+    /** Backend requested by the user */
+    Backend mBackend;
+
+    /** True if mPositions is sorted by grid cell */
+    bool mUseGrid;
+
+    /** Grid origin, number of cells per axis and inverse cell size */
+    aiVector3D mGridMin;
+    unsigned int mGridDims[3];
+    ai_real mInvCellSize;
+
+    /** Index of the first entry of each cell in mPositions, with one extra entry at the end */
+    std::vector<unsigned int> mCellStart;
 };
 
 } // end of namespace Assimp
@@ -370,6 +370,16 @@ ASSIMP_API void aiGetMemoryRequirements(
     const C_STRUCT aiScene* pIn,
     C_STRUCT aiMemoryInfo* in);
 
+// --------------------------------------------------------------------------------
+/** Get the timing and memory statistics collected while importing an asset.
+ * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is set.
+ * @param pIn Input asset.
+ * @return NULL if no statistics have been collected. The returned data is
+ *   owned by the asset and released along with it.
+ */
+ASSIMP_API const C_STRUCT aiImportStatistics* aiGetImportStatistics(
+    const C_STRUCT aiScene* pIn);
+
 
 
 // --------------------------------------------------------------------------------
@@ -106,11 +106,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * LIMITBONEWEIGHTS
  * VALIDATEDS
  * IMPROVECACHELOCALITY
+ * GENMESHLETS
+ * GENLODS
  * FIXINFACINGNORMALS
  * REMOVE_REDUNDANTMATERIALS
  * OPTIMIZEGRAPH
  * SORTBYPTYPE
  * FINDINVALIDDATA
+ * OPTIMIZEANIMATIONS
  * TRANSFORMTEXCOORDS
  * GENUVCOORDS
  * ENTITYMESHBUILDER
@@ -224,11 +227,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     //////////////////////////////////////////////////////////////////////////
     /* Define ASSIMP_BUILD_SINGLETHREADED to compile assimp
      * without threading support. The library doesn't utilize
-     * threads then and is itself not threadsafe. */
+     * threads then and is itself not threadsafe. The CMake option
+     * of the same name sets this define. */
     //////////////////////////////////////////////////////////////////////////
-#ifndef ASSIMP_BUILD_SINGLETHREADED
-#   define ASSIMP_BUILD_SINGLETHREADED
-#endif
 
 #if defined(_DEBUG) || ! defined(NDEBUG)
 #   define ASSIMP_BUILD_DEBUG
@@ -368,6 +368,22 @@ ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+// ------------------------------------------------------------------------------------
+//! Batched variants of fast_atoreal_move(), strtoul10() and strtol10() for arrays of
+//! numbers. They read up to count numbers from [*inout,end), skipping whitespace and
+//! line ends in front of each number, and never read at or behind end. Each number
+//! has to be followed by whitespace, a line end or the end of the range. The values are
+//! the same as the scalar functions return. Runs of digits are converted with SSE2
+//! where the CPU supports it.
+//! @param inout Set behind the last number read. If fewer than count numbers were
+//!   found it is set to the start of the first token which isn't a number, or to end.
+//! @return Number of values written to out.
+// ------------------------------------------------------------------------------------
+ASSIMP_API size_t fast_atoreal_array(const char** inout, const char* end, float* out, size_t count, bool check_comma = true);
+ASSIMP_API size_t fast_atoreal_array(const char** inout, const char* end, double* out, size_t count, bool check_comma = true);
+ASSIMP_API size_t strtoul10_array(const char** inout, const char* end, unsigned int* out, size_t count);
+ASSIMP_API size_t strtol10_array(const char** inout, const char* end, int* out, size_t count);
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
@@ -548,6 +548,159 @@ enum aiMorphingMethod
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief A small cluster of triangles of a mesh, as used by mesh shaders and
+ *  cluster culling.
+ *
+ *  The meshlets of a mesh are generated by the #aiProcess_GenMeshlets step.
+ *  A meshlet references #mVertexCount consecutive entries of
+ *  aiMesh::mMeshletVertices starting at #mVertexOffset, which are indices
+ *  into the vertex streams of the mesh. Its triangles are #mTriangleCount
+ *  times three consecutive entries of aiMesh::mMeshletIndices starting at
+ *  #mTriangleOffset; these are local indices into the meshlet's vertices.
+ */
+struct aiMeshlet {
+    //! First entry of the meshlet in aiMesh::mMeshletVertices
+    unsigned int mVertexOffset;
+
+    //! First entry of the meshlet in aiMesh::mMeshletIndices
+    unsigned int mTriangleOffset;
+
+    //! Number of vertices referenced by the meshlet
+    unsigned int mVertexCount;
+
+    //! Number of triangles in the meshlet
+    unsigned int mTriangleCount;
+
+    //! Center of a bounding sphere enclosing all vertices of the meshlet
+    C_STRUCT aiVector3D mCenter;
+
+    //! Radius of the bounding sphere
+    ai_real mRadius;
+
+    /** Apex and axis of the normal cone. All triangles of the meshlet face
+     *  away from a camera at position c, so the meshlet can be culled, if
+     *  dot(normalize(mConeApex - c), mConeAxis) >= mConeCutoff. */
+    C_STRUCT aiVector3D mConeApex;
+
+    //! Normalized axis of the normal cone
+    C_STRUCT aiVector3D mConeAxis;
+
+    //! Sine of the half angle of the normal cone, 1 if the cone is too
+    //! wide to ever cull the meshlet.
+    ai_real mConeCutoff;
+
+#ifdef __cplusplus
+
+    //! Default constructor
+    aiMeshlet() AI_NO_EXCEPT
+    : mVertexOffset(0)
+    , mTriangleOffset(0)
+    , mVertexCount(0)
+    , mTriangleCount(0)
+    , mCenter()
+    , mRadius(0)
+    , mConeApex()
+    , mConeAxis()
+    , mConeCutoff(1) {
+        // empty
+    }
+
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Vertex streams that can be packed into aiMesh::mPackedVertices,
+ *  see #AI_CONFIG_GLOB_PACK_VERTICES.
+ */
+enum aiPackedVertexStream {
+    /** Positions, as three unsigned 16 bit integers normalized to the
+     *  bounding box of the mesh, padded to 8 bytes. */
+    aiPackedVertexStream_Positions = 0x1,
+
+    /** Normals, tangents and bitangents, as two signed 16 bit integers
+     *  holding the octahedral encoding of the unit vector. */
+    aiPackedVertexStream_Normals = 0x2,
+
+    /** Two-component texture coordinates, as two unsigned 16 bit integers
+     *  normalized to the range of each channel. All channels are left
+     *  unpacked if one of them has three components. */
+    aiPackedVertexStream_TexCoords = 0x4,
+
+    /** Stores packed texture coordinates as two 16 bit floats instead,
+     *  which keeps coordinates far outside [0, 1] more accurate. Implies
+     *  #aiPackedVertexStream_TexCoords. */
+    aiPackedVertexStream_HalfTexCoords = 0x8,
+
+    /** Vertex colors, as four unsigned 8 bit integers clamped to [0, 1]. */
+    aiPackedVertexStream_Colors = 0x10,
+
+    /** This value is not used. It forces the compiler to use at least
+     *  32 bit integers to represent this enum. */
+#ifndef SWIG
+    _aiPackedVertexStream_Force32Bit = INT_MAX
+#endif
+};
+
+/** Byte offset of a stream that is not part of the packed vertices */
+#define AI_PACKED_VERTEX_NONE 0xffffffff
+
+// ---------------------------------------------------------------------------
+/** @brief Describes the interleaved layout of aiMesh::mPackedVertices and
+ *  how to restore the original values.
+ *
+ *  Vertex i starts at byte i * #mStride of the buffer, each stream at its
+ *  offset within the vertex. Streams that were not packed have the offset
+ *  #AI_PACKED_VERTEX_NONE and are still found in their usual aiMesh array.
+ */
+struct aiPackedVertexLayout {
+    //! Combination of the aiPackedVertexStream flags that were applied
+    unsigned int mStreams;
+
+    //! Size of a vertex in bytes, a multiple of 4
+    unsigned int mStride;
+
+    //! Byte offsets of the streams within a vertex
+    unsigned int mPositionOffset;
+    unsigned int mNormalOffset;
+    unsigned int mTangentOffset;
+    unsigned int mBitangentOffset;
+    unsigned int mTexCoordOffset[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+    unsigned int mColorOffset[AI_MAX_NUMBER_OF_COLOR_SETS];
+
+    /** A packed position q is restored as mPositionMin + q * mPositionScale,
+     *  component-wise. */
+    C_STRUCT aiVector3D mPositionMin;
+    C_STRUCT aiVector3D mPositionScale;
+
+    /** The same for texture coordinates stored as unsigned 16 bit integers,
+     *  the z component is unused. */
+    C_STRUCT aiVector3D mTexCoordMin[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+    C_STRUCT aiVector3D mTexCoordScale[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+#ifdef __cplusplus
+
+    //! Default constructor, no streams are packed
+    aiPackedVertexLayout() AI_NO_EXCEPT
+    : mStreams(0)
+    , mStride(0)
+    , mPositionOffset(AI_PACKED_VERTEX_NONE)
+    , mNormalOffset(AI_PACKED_VERTEX_NONE)
+    , mTangentOffset(AI_PACKED_VERTEX_NONE)
+    , mBitangentOffset(AI_PACKED_VERTEX_NONE)
+    , mPositionMin()
+    , mPositionScale() {
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+            mTexCoordOffset[a] = AI_PACKED_VERTEX_NONE;
+        }
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+            mColorOffset[a] = AI_PACKED_VERTEX_NONE;
+        }
+    }
+
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
 *
@@ -714,6 +867,70 @@ struct aiMesh
      *  Method of morphing when animeshes are specified. 
      */
     unsigned int mMethod;
+
+    /** The number of indices in #mIndexBuffer, three per triangle. */
+    unsigned int mNumIndices;
+
+    /** The size of an entry of #mIndexBuffer in bytes: 2 for unsigned
+     *  short and 4 for unsigned int indices, 0 if there is no index buffer. */
+    unsigned int mIndexSize;
+
+    /** The faces of a triangle mesh as one contiguous array of vertex
+     *  indices, three per face, ready to be uploaded to the GPU as is.
+     *
+     *  This compact layout is only used if it was requested with
+     *  #AI_CONFIG_GLOB_INDEX_BUFFER. The faces are then not available
+     *  as #mFaces, which is NULL, while #mNumFaces still holds the number
+     *  of triangles. Assimp::ExpandIndexBuffer() restores the classic
+     *  layout. Meshes that are not made of triangles only always keep
+     *  #mFaces. */
+    void* mIndexBuffer;
+
+    /** The number of meshlets in #mMeshlets. */
+    unsigned int mNumMeshlets;
+
+    /** The meshlets the faces of the mesh were split into by the
+     *  #aiProcess_GenMeshlets step, NULL if the step wasn't run. Later
+     *  changes to the faces do not update the meshlets. */
+    C_STRUCT aiMeshlet* mMeshlets;
+
+    /** The number of entries in #mMeshletVertices. */
+    unsigned int mNumMeshletVertices;
+
+    /** The vertices of all meshlets as indices into the vertex streams. */
+    unsigned int* mMeshletVertices;
+
+    /** The number of entries in #mMeshletIndices, three per triangle. */
+    unsigned int mNumMeshletIndices;
+
+    /** The triangles of all meshlets. Each entry indexes the vertices of its
+     *  meshlet, i.e. vertex i of a meshlet m is
+     *  mMeshletVertices[m.mVertexOffset + i]. */
+    unsigned char* mMeshletIndices;
+
+    /** The number of entries in #mLODs. */
+    unsigned int mNumLODs;
+
+    /** Simplified versions of this mesh, generated if
+     *  #AI_CONFIG_PP_LOD_RATIOS is set, as indices into aiScene::mMeshes,
+     *  from the finest to the coarsest level. NULL if there are none. The LOD meshes are not
+     *  referenced by any node. */
+    unsigned int* mLODs;
+
+    /** Layout of #mPackedVertices. */
+    C_STRUCT aiPackedVertexLayout mPackedLayout;
+
+    /** The vertex streams packed into one interleaved buffer of
+     *  #mNumVertices times mPackedLayout.mStride bytes, ready to be
+     *  uploaded to the GPU as is.
+     *
+     *  This compact layout is only used if it was requested with
+     *  #AI_CONFIG_GLOB_PACK_VERTICES. The arrays of the packed streams,
+     *  e.g. #mVertices, are NULL then. The Assimp::GetVertexPosition()
+     *  family of functions reads a vertex from either layout and
+     *  Assimp::ExpandPackedVertices() restores the arrays. NULL if the
+     *  vertices are not packed. */
+    void* mPackedVertices;
 	
 #ifdef __cplusplus
 
@@ -735,7 +952,20 @@ struct aiMesh
     , mMaterialIndex( 0 )
     , mNumAnimMeshes( 0 )
     , mAnimMeshes(nullptr)
-    , mMethod( 0 ) {
+    , mMethod( 0 )
+    , mNumIndices( 0 )
+    , mIndexSize( 0 )
+    , mIndexBuffer(nullptr)
+    , mNumMeshlets( 0 )
+    , mMeshlets(nullptr)
+    , mNumMeshletVertices( 0 )
+    , mMeshletVertices(nullptr)
+    , mNumMeshletIndices( 0 )
+    , mMeshletIndices(nullptr)
+    , mNumLODs( 0 )
+    , mLODs(nullptr)
+    , mPackedLayout()
+    , mPackedVertices(nullptr) {
         for( unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a ) {
             mNumUVComponents[a] = 0;
             mTextureCoords[a] = nullptr;
@@ -775,6 +1005,12 @@ struct aiMesh
         }
 
         delete [] mFaces;
+        delete [] static_cast<unsigned int*>(mIndexBuffer);
+        delete [] mMeshlets;
+        delete [] mMeshletVertices;
+        delete [] mMeshletIndices;
+        delete [] mLODs;
+        delete [] static_cast<unsigned int*>(mPackedVertices);
     }
 
     //! Check whether the mesh contains positions. Provided no special
@@ -787,6 +1023,23 @@ struct aiMesh
     bool HasFaces() const
         { return mFaces != nullptr && mNumFaces > 0; }
 
+    //! Check whether the faces are stored in the compact #mIndexBuffer
+    //! instead of #mFaces.
+    bool HasIndexBuffer() const
+        { return mIndexBuffer != nullptr && mNumIndices > 0; }
+
+    //! Check whether the mesh has been split into meshlets
+    bool HasMeshlets() const
+        { return mMeshlets != nullptr && mNumMeshlets > 0; }
+
+    //! Check whether vertex streams are stored in #mPackedVertices
+    bool HasPackedVertices() const
+        { return mPackedVertices != nullptr && mNumVertices > 0; }
+
+    //! Check whether simplified versions of the mesh have been generated
+    bool HasLODs() const
+        { return mLODs != nullptr && mNumLODs > 0; }
+
     //! Check whether the mesh contains normal vectors
     bool HasNormals() const
         { return mNormals != nullptr && mNumVertices > 0; }
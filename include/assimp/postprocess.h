@@ -278,6 +278,19 @@ enum aiPostProcessSteps
      * If you intend to render huge models in hardware, this step might
      * be of interest to you. The <tt>#AI_CONFIG_PP_ICL_PTCACHE_SIZE</tt>
      * importer property can be used to fine-tune the cache optimization.
+     * <tt>#AI_CONFIG_PP_ICL_VERTEX_FETCH_ORDER</tt> additionally reorders the
+     * vertices for the vertex fetch, <tt>#AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD</tt>
+     * enables the overdraw reduction.
+     *
+     * Levels of detail, which <tt>#AI_CONFIG_PP_LOD_RATIOS</tt> enables without
+     * a flag of their own, are generated right before this step and optimized
+     * as well. They are simplified versions of each triangle mesh.
+     * Edges are collapsed in the order of their quadric error, vertices are
+     * never moved or created, so normals, UV coordinates, colors and bone
+     * weights are kept exactly. Open borders and attribute seams are preserved.
+     * Each level is added to aiScene::mMeshes and linked from aiMesh::mLODs
+     * of the source mesh. Run #aiProcess_JoinIdenticalVertices as well,
+     * unconnected triangles can't be simplified.
      */
     aiProcess_ImproveCacheLocality = 0x800,
 
@@ -316,6 +329,25 @@ enum aiPostProcessSteps
     */
     aiProcess_FixInfacingNormals = 0x2000,
 
+    // -------------------------------------------------------------------------
+    /** <hr>Splits the triangles of each mesh into meshlets for mesh shader
+     *  and cluster culling based renderers.
+     *
+     *  The meshlets are stored in aiMesh::mMeshlets, their vertices and
+     *  triangles in aiMesh::mMeshletVertices and aiMesh::mMeshletIndices.
+     *  Triangles are grouped by adjacency, so meshlets are compact and share
+     *  as many vertices as possible. Each meshlet gets a bounding sphere and
+     *  a normal cone for culling. Use the <tt>#AI_CONFIG_PP_GM_VERTEX_LIMIT</tt>
+     *  and <tt>#AI_CONFIG_PP_GM_TRIANGLE_LIMIT</tt> importer properties to
+     *  set the size of the meshlets. Meshes that do not consist of triangles
+     *  only are left alone.
+     *
+     *  The step runs after all other steps. Combine it with
+     *  #aiProcess_ImproveCacheLocality for a good triangle order inside of
+     *  the meshlets.
+     */
+    aiProcess_GenMeshlets = 0x4000,
+
     // -------------------------------------------------------------------------
     /** <hr>This step splits meshes with more than one primitive type in
      *  homogeneous sub-meshes.
@@ -384,7 +416,9 @@ enum aiPostProcessSteps
      * The step will also remove meshes that are infinitely small and reduce
      * animation tracks consisting of hundreds if redundant keys to a single
      * key. The <tt>AI_CONFIG_PP_FID_ANIM_ACCURACY</tt> config property decides
-     * the accuracy of the check for duplicate animation tracks.
+     * the accuracy of the check for duplicate animation tracks.<br>
+     * Redundant node animation keys within a track are removed by a separate
+     * step, which <tt>#AI_CONFIG_PP_OA_ENABLE</tt> enables without any flag.
     */
     aiProcess_FindInvalidData = 0x20000,
 
@@ -557,7 +591,7 @@ enum aiPostProcessSteps
     aiProcess_EmbedTextures  = 0x10000000,
         
     // aiProcess_GenEntityMeshes = 0x100000,
-    // aiProcess_OptimizeAnimations = 0x200000
+    // aiProcess_OptimizeAnimations = 0x200000 - see AI_CONFIG_PP_OA_ENABLE
     // aiProcess_FixTexturePaths = 0x200000
 
 
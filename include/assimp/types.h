@@ -514,6 +514,78 @@ struct aiMemoryInfo
     unsigned int total;
 }; // !struct aiMemoryInfo
 
+// ----------------------------------------------------------------------------------
+/** Statistics of a single phase of an import, i.e. the actual import, the scene
+ *  preprocessing, the data structure validation or a post-processing step.
+ *  @see aiImportStatistics
+*/
+struct aiImportStepStatistics
+{
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiImportStepStatistics() AI_NO_EXCEPT
+        : mName()
+        , mSeconds         (0.0)
+        , mNumMeshesIn     (0)
+        , mNumMeshesOut    (0)
+        , mNumVerticesIn   (0)
+        , mNumVerticesOut  (0)
+        , mBytesIn         (0)
+        , mBytesOut        (0)
+    {}
+
+#endif
+
+    /** Name of the phase: "import", "preprocess", "validate" or the name of
+     *  the post-processing step, e.g. "JoinVerticesProcess". */
+    C_STRUCT aiString mName;
+
+    /** Wall-clock time spent in the phase, in seconds */
+    double mSeconds;
+
+    /** Number of meshes in the scene before and after the phase */
+    unsigned int mNumMeshesIn;
+    unsigned int mNumMeshesOut;
+
+    /** Total number of vertices in the scene before and after the phase */
+    unsigned int mNumVerticesIn;
+    unsigned int mNumVerticesOut;
+
+    /** Storage allocated for the scene before and after the phase, in bytes.
+     *  Computed like aiMemoryInfo::total. */
+    unsigned int mBytesIn;
+    unsigned int mBytesOut;
+}; // !struct aiImportStepStatistics
+
+// ----------------------------------------------------------------------------------
+/** Timing and memory statistics of the last import, broken down by phase.
+ *  Collected if #AI_CONFIG_GLOB_MEASURE_TIME is set.
+ *  @see Importer::GetLastImportStatistics()
+*/
+struct aiImportStatistics
+{
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiImportStatistics() AI_NO_EXCEPT
+        : mTotalSeconds (0.0)
+        , mNumSteps     (0)
+        , mSteps        (NULL)
+    {}
+
+#endif
+
+    /** Sum of the time spent in all phases, in seconds */
+    double mTotalSeconds;
+
+    /** Number of phases in #mSteps */
+    unsigned int mNumSteps;
+
+    /** The phases, in the order they have been executed */
+    C_STRUCT aiImportStepStatistics* mSteps;
+}; // !struct aiImportStatistics
+
 #ifdef __cplusplus
 }
 #endif //!  __cplusplus
@@ -44,6 +44,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Importer.h"
 #include "TestIOSystem.h"
 
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
 using namespace ::Assimp;
 
 class BatchLoaderTest : public ::testing::Test {
@@ -79,3 +85,51 @@ TEST_F( BatchLoaderTest, validateAccessTest ) {
     BatchLoader loader2( m_io, true );
     EXPECT_TRUE( loader2.getValidation() );
 }
+
+TEST_F( BatchLoaderTest, numThreadsAccessTest ) {
+    BatchLoader loader( m_io );
+    EXPECT_EQ( 1u, loader.getNumThreads() );
+    loader.setNumThreads( 4 );
+    EXPECT_EQ( 4u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, parallelLoadMatchesSerialLoad ) {
+    static const char* files[] = {
+        ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/cube_usemtl.obj",
+        ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply",
+        ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl",
+        ASSIMP_TEST_MODELS_DIR "/3DS/fels.3ds",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/does_not_exist.obj",
+    };
+    const unsigned int numFiles = sizeof( files ) / sizeof( files[ 0 ] );
+
+    DefaultIOSystem io;
+    BatchLoader serial( &io );
+    BatchLoader parallel( &io );
+    parallel.setNumThreads( 4 );
+
+    std::vector<unsigned int> serialIds, parallelIds;
+    for ( unsigned int i = 0; i < numFiles; ++i ) {
+        serialIds.push_back( serial.AddLoadRequest( files[ i ], aiProcess_Triangulate ) );
+        parallelIds.push_back( parallel.AddLoadRequest( files[ i ], aiProcess_Triangulate ) );
+    }
+    serial.LoadAll();
+    parallel.LoadAll();
+
+    for ( unsigned int i = 0; i < numFiles; ++i ) {
+        std::unique_ptr<aiScene> a( serial.GetImport( serialIds[ i ] ) );
+        std::unique_ptr<aiScene> b( parallel.GetImport( parallelIds[ i ] ) );
+        ASSERT_EQ( nullptr == a, nullptr == b ) << files[ i ];
+        if ( !a ) {
+            continue;
+        }
+        ASSERT_EQ( a->mNumMeshes, b->mNumMeshes ) << files[ i ];
+        ASSERT_EQ( a->mNumMaterials, b->mNumMaterials ) << files[ i ];
+        for ( unsigned int m = 0; m < a->mNumMeshes; ++m ) {
+            EXPECT_EQ( a->mMeshes[ m ]->mNumVertices, b->mMeshes[ m ]->mNumVertices );
+            EXPECT_EQ( a->mMeshes[ m ]->mNumFaces, b->mMeshes[ m ]->mNumFaces );
+        }
+    }
+}
@@ -42,9 +42,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 #include "AbstractImportExportBase.h"
+#include "SceneDiffer.h"
 
 #include <assimp/Importer.hpp>
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 using namespace Assimp;
 
@@ -60,3 +63,66 @@ public:
 TEST_F( utColladaImportExport, importBlenFromFileTest ) {
     EXPECT_TRUE( importerTest() );
 }
+
+// Releasing mesh sources early must not change the result
+TEST_F( utColladaImportExport, releaseSourcesImportMatchesDefaultImport ) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/Collada/duck.dae",
+        ASSIMP_TEST_MODELS_DIR "/Collada/COLLADA.dae",
+        ASSIMP_TEST_MODELS_DIR "/Collada/teapots.DAE",
+        ASSIMP_TEST_MODELS_DIR "/Collada/library_animation_clips.dae"
+    };
+    for ( size_t i = 0; i < sizeof( files ) / sizeof( files[ 0 ] ); ++i ) {
+        Assimp::Importer importer;
+        const aiScene *expected = importer.ReadFile( files[ i ], aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, expected );
+
+        Assimp::Importer releasing;
+        releasing.SetPropertyBool( AI_CONFIG_IMPORT_COLLADA_RELEASE_SOURCES, true );
+        const aiScene *scene = releasing.ReadFile( files[ i ], aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, scene );
+
+        SceneDiffer differ;
+        EXPECT_TRUE( differ.isEqual( expected, scene ) ) << files[ i ];
+        EXPECT_EQ( expected->mNumAnimations, scene->mNumAnimations );
+    }
+}
+
+// Two triangles, the second one reuses the positions of the first mesh
+static const char *SharedSourcesDae =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+    "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+    "<library_geometries>\n"
+    "<geometry id=\"A\"><mesh>\n"
+    "<source id=\"A-pos\"><float_array id=\"A-pos-array\" count=\"9\">0 0 0 1 0 0 0 1 0</float_array>\n"
+    "<technique_common><accessor source=\"#A-pos-array\" count=\"3\" stride=\"3\">\n"
+    "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>\n"
+    "</accessor></technique_common></source>\n"
+    "<vertices id=\"A-vtx\"><input semantic=\"POSITION\" source=\"#A-pos\"/></vertices>\n"
+    "<triangles count=\"1\"><input semantic=\"VERTEX\" source=\"#A-vtx\" offset=\"0\"/><p>0 1 2</p></triangles>\n"
+    "</mesh></geometry>\n"
+    "<geometry id=\"B\"><mesh>\n"
+    "<vertices id=\"B-vtx\"><input semantic=\"POSITION\" source=\"#A-pos\"/></vertices>\n"
+    "<triangles count=\"1\"><input semantic=\"VERTEX\" source=\"#B-vtx\" offset=\"0\"/><p>2 1 0</p></triangles>\n"
+    "</mesh></geometry>\n"
+    "</library_geometries>\n"
+    "<library_visual_scenes><visual_scene id=\"Scene\">\n"
+    "<node id=\"a\"><instance_geometry url=\"#A\"/></node>\n"
+    "<node id=\"b\"><instance_geometry url=\"#B\"/></node>\n"
+    "</visual_scene></library_visual_scenes>\n"
+    "<scene><instance_visual_scene url=\"#Scene\"/></scene>\n"
+    "</COLLADA>\n";
+
+// Sources released with another mesh must fail the import instead of dropping geometry
+TEST_F( utColladaImportExport, releaseSourcesFailsOnSharedSources ) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory( SharedSourcesDae, ::strlen( SharedSourcesDae ), aiProcess_ValidateDataStructure, "dae" );
+    ASSERT_NE( nullptr, scene );
+    EXPECT_EQ( 2u, scene->mNumMeshes );
+
+    Assimp::Importer releasing;
+    releasing.SetPropertyBool( AI_CONFIG_IMPORT_COLLADA_RELEASE_SOURCES, true );
+    scene = releasing.ReadFileFromMemory( SharedSourcesDae, ::strlen( SharedSourcesDae ), aiProcess_ValidateDataStructure, "dae" );
+    EXPECT_EQ( nullptr, scene );
+    EXPECT_NE( std::string::npos, std::string( releasing.GetErrorString() ).find( "AI_CONFIG_IMPORT_COLLADA_RELEASE_SOURCES" ) );
+}
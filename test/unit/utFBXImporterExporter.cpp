@@ -51,6 +51,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/types.h>
 
+#include <fstream>
+#include <iterator>
+
 using namespace Assimp;
 
 class utFBXImporterExporter : public AbstractImportExportBase {
@@ -114,3 +117,89 @@ TEST_F(utFBXImporterExporter, importUnitScaleFactor) {
     scene->mMetaData->Get("UnitScaleFactor", factor);
     EXPECT_DOUBLE_EQ(500.0, factor);
 }
+
+static const char AsciiFbx[] =
+    "; FBX 7.4.0 project file\n"
+    "FBXHeaderExtension:  {\n"
+    "    FBXHeaderVersion: 1003\n"
+    "    FBXVersion: 7400\n"
+    "}\n"
+    "Objects:  {\n"
+    "    Geometry: 1000, \"Geometry::tri\", \"Mesh\" {\n"
+    "        Vertices: *9 {\n"
+    "            a: 0,0,0,1,0,0,\n"
+    "            0,1,0\n"
+    "        }\n"
+    "        PolygonVertexIndex: *3 {\n"
+    "            a: 0,1,-3\n"
+    "        }\n"
+    "    }\n"
+    "    Model: 2000, \"Model::tri\", \"Mesh\" {\n"
+    "        Version: 232\n"
+    "    }\n"
+    "}\n"
+    "Connections:  {\n"
+    "    C: \"OO\",1000,2000\n"
+    "    C: \"OO\",2000,0\n"
+    "}\n";
+
+TEST_F(utFBXImporterExporter, importAsciiFromMemory) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(AsciiFbx, sizeof(AsciiFbx) - 1, aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    EXPECT_EQ(3u, scene->mMeshes[0]->mNumVertices);
+    EXPECT_EQ(1u, scene->mMeshes[0]->mNumFaces);
+    EXPECT_EQ(aiVector3D(0, 1, 0), scene->mMeshes[0]->mVertices[2]);
+}
+
+TEST_F(utFBXImporterExporter, truncatedFilesFailCleanly) {
+    Assimp::Importer importer;
+
+    // stops inside a nested scope
+    const std::string ascii(AsciiFbx, ::strstr(AsciiFbx, "PolygonVertexIndex") - AsciiFbx);
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(ascii.c_str(), ascii.size(), 0, "fbx"));
+
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", std::ios::binary);
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(binary.empty());
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(&binary[0], binary.size() / 2, 0, "fbx"));
+}
+
+static void checkParallelImport(const char *file) {
+    Assimp::Importer serial;
+    const aiScene *expected = serial.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    Assimp::Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_IMPORT_FBX_NUM_THREADS, 4);
+    const aiScene *scene = parallel.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    SceneDiffer differ;
+    EXPECT_TRUE(differ.isEqual(expected, scene));
+
+    // meshes must come out in the same order, with the same materials and bones
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *expMesh = expected->mMeshes[i], *mesh = scene->mMeshes[i];
+        EXPECT_STREQ(expMesh->mName.C_Str(), mesh->mName.C_Str());
+        EXPECT_EQ(expMesh->mMaterialIndex, mesh->mMaterialIndex);
+        ASSERT_EQ(expMesh->mNumBones, mesh->mNumBones);
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            EXPECT_STREQ(expMesh->mBones[b]->mName.C_Str(), mesh->mBones[b]->mName.C_Str());
+            ASSERT_EQ(expMesh->mBones[b]->mNumWeights, mesh->mBones[b]->mNumWeights);
+            for (unsigned int w = 0; w < mesh->mBones[b]->mNumWeights; ++w) {
+                EXPECT_EQ(expMesh->mBones[b]->mWeights[w].mVertexId, mesh->mBones[b]->mWeights[w].mVertexId);
+                EXPECT_EQ(expMesh->mBones[b]->mWeights[w].mWeight, mesh->mBones[b]->mWeights[w].mWeight);
+            }
+        }
+    }
+}
+
+TEST_F(utFBXImporterExporter, parallelImportMatchesSerialImport) {
+    checkParallelImport(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+    checkParallelImport(ASSIMP_TEST_MODELS_DIR "/FBX/box.fbx");
+    checkParallelImport(ASSIMP_TEST_MODELS_DIR "/FBX/phong_cube.fbx");
+    checkParallelImport(ASSIMP_TEST_MODELS_DIR "/FBX/global_settings.fbx");
+}
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
 
 namespace {
 
@@ -188,3 +189,107 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+struct FastAtofArrayWrapper {
+    ai_real operator()(const char* str) {
+        ai_real value = 0;
+        EXPECT_EQ(1u, Assimp::fast_atoreal_array(&str, str + strlen(str), &value, 1));
+        return value;
+    }
+};
+
+TEST_F(FastAtofTest, FastAtofArray)
+{
+    RunTest<ai_real>(FastAtofArrayWrapper());
+}
+
+template <typename Real>
+static void CheckArrayMatchesScalar(const std::string& text, size_t count)
+{
+    std::vector<Real> expected(count), values(count);
+    const char* c = text.c_str();
+    for (size_t i = 0; i < count; ++i) {
+        Assimp::SkipSpacesAndLineEnd(&c);
+        c = Assimp::fast_atoreal_move<Real>(c, expected[i]);
+    }
+
+    const char* in = text.c_str();
+    ASSERT_EQ(count, Assimp::fast_atoreal_array(&in, text.c_str() + text.size(), &values[0], count));
+    EXPECT_EQ(c, in);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(0, memcmp(&expected[i], &values[i], sizeof(Real))) << i;
+    }
+}
+
+TEST_F(FastAtofTest, FastAtofArrayMatchesScalar)
+{
+    // all lengths of integer and fraction parts, around the 15 relevant decimals
+    std::string text;
+    size_t count = 0;
+    for (unsigned int intDigits = 0; intDigits < 20; ++intDigits) {
+        for (unsigned int fracDigits = 0; fracDigits < 20; ++fracDigits) {
+            if (intDigits + fracDigits == 0) {
+                continue;
+            }
+            std::string number = (count % 2) ? "-" : "";
+            for (unsigned int i = 0; i < intDigits; ++i) {
+                number += static_cast<char>('1' + (i + count) % 9);
+            }
+            if (fracDigits) {
+                number += '.';
+                for (unsigned int i = 0; i < fracDigits; ++i) {
+                    number += static_cast<char>('0' + (i * 7 + count) % 10);
+                }
+            }
+            if (count % 5 == 0) {
+                number += "e-" + std::to_string(count % 12);
+            }
+            text += number + ((count % 3) ? " " : "\r\n\t");
+            ++count;
+        }
+    }
+    CheckArrayMatchesScalar<float>(text, count);
+    CheckArrayMatchesScalar<double>(text, count);
+}
+
+TEST_F(FastAtofTest, FastAtofArrayStopsAtInvalidTokens)
+{
+    float values[4] = { 0.f, 0.f, 0.f, 0.f };
+
+    const char* text = "1.5 2 1.0.0 4";
+    const char* in = text;
+    EXPECT_EQ(2u, Assimp::fast_atoreal_array(&in, text + strlen(text), values, 4));
+    EXPECT_EQ(text + 6, in);
+    EXPECT_EQ(1.5f, values[0]);
+    EXPECT_EQ(2.f, values[1]);
+    EXPECT_EQ(0.f, values[2]);
+
+    // never reads behind the end of the range
+    const char* digits = "12345678901234567890";
+    in = digits;
+    EXPECT_EQ(1u, Assimp::fast_atoreal_array(&in, digits + 3, values, 4));
+    EXPECT_EQ(123.f, values[0]);
+    EXPECT_EQ(digits + 3, in);
+}
+
+TEST_F(FastAtofTest, IntArrays)
+{
+    const char* text = " 12 -7\n+3 4000000000 123456789012345 x";
+    const char* end = text + strlen(text);
+
+    int values[6];
+    const char* in = text;
+    ASSERT_EQ(5u, Assimp::strtol10_array(&in, end, values, 6));
+    EXPECT_EQ('x', *in);
+    const char* c = text;
+    for (unsigned int i = 0; i < 5; ++i) {
+        Assimp::SkipSpacesAndLineEnd(&c);
+        EXPECT_EQ(Assimp::strtol10(c, &c), values[i]);
+    }
+
+    unsigned int counts[3];
+    in = text;
+    EXPECT_EQ(1u, Assimp::strtoul10_array(&in, end, counts, 3));
+    EXPECT_EQ(12u, counts[0]);
+    EXPECT_EQ('-', *in);
+}
@@ -0,0 +1,210 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <FindInstancesProcess.h>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+using namespace Assimp;
+
+class FindInstancesProcessTest : public ::testing::Test {
+protected:
+    aiMesh* CreateQuadMesh(float offset) {
+        aiMesh* mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = 6;
+        mesh->mVertices = new aiVector3D[6];
+        mesh->mTextureCoords[0] = new aiVector3D[6];
+        mesh->mNumUVComponents[0] = 2;
+        const aiVector3D corners[6] = {
+            aiVector3D(0,0,0), aiVector3D(1,0,0), aiVector3D(1,1,0),
+            aiVector3D(0,0,0), aiVector3D(1,1,0), aiVector3D(0,1,0)
+        };
+        for (unsigned int i = 0; i < 6; ++i) {
+            mesh->mVertices[i] = corners[i] + aiVector3D(offset, 0, 0);
+            mesh->mTextureCoords[0][i] = corners[i];
+        }
+        mesh->mNumFaces = 2;
+        mesh->mFaces = new aiFace[2];
+        for (unsigned int f = 0; f < 2; ++f) {
+            aiFace& face = mesh->mFaces[f];
+            face.mNumIndices = 3;
+            face.mIndices = new unsigned int[3];
+            for (unsigned int i = 0; i < 3; ++i) {
+                face.mIndices[i] = f * 3 + i;
+            }
+        }
+        return mesh;
+    }
+
+    /** Builds a scene with one node per mesh */
+    aiScene* CreateScene(const std::vector<aiMesh*>& meshes) {
+        aiScene* scene = new aiScene();
+        scene->mNumMeshes = static_cast<unsigned int>(meshes.size());
+        scene->mMeshes = new aiMesh*[meshes.size()];
+        scene->mRootNode = new aiNode();
+        scene->mRootNode->mNumChildren = scene->mNumMeshes;
+        scene->mRootNode->mChildren = new aiNode*[meshes.size()];
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            scene->mMeshes[i] = meshes[i];
+            aiNode* node = new aiNode();
+            node->mParent = scene->mRootNode;
+            node->mNumMeshes = 1;
+            node->mMeshes = new unsigned int[1];
+            node->mMeshes[0] = i;
+            scene->mRootNode->mChildren[i] = node;
+        }
+        return scene;
+    }
+
+    /** Binds all vertices of a mesh to one bone */
+    aiMesh* CreateSkinnedQuadMesh(const char* boneName) {
+        aiMesh* mesh = CreateQuadMesh(0.f);
+        mesh->mNumBones = 1;
+        mesh->mBones = new aiBone*[1];
+        mesh->mBones[0] = new aiBone();
+        mesh->mBones[0]->mName.Set(boneName);
+        mesh->mBones[0]->mNumWeights = mesh->mNumVertices;
+        mesh->mBones[0]->mWeights = new aiVertexWeight[mesh->mNumVertices];
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            mesh->mBones[0]->mWeights[i] = aiVertexWeight(i, 1.f);
+        }
+        return mesh;
+    }
+
+    void RunProcess(aiScene* scene, bool contentHash) {
+        Importer importer;
+        importer.SetPropertyBool(AI_CONFIG_PP_FI_CONTENT_HASH, contentHash);
+        FindInstancesProcess process;
+        process.SetupProperties(&importer);
+        process.Execute(scene);
+    }
+
+    void CheckInstancesMerged(bool contentHash) {
+        aiScene* scene = CreateScene({ CreateQuadMesh(0.f), CreateQuadMesh(5.f),
+            CreateQuadMesh(0.f), CreateQuadMesh(5.f), CreateQuadMesh(0.f) });
+        RunProcess(scene, contentHash);
+
+        ASSERT_EQ(2u, scene->mNumMeshes);
+        EXPECT_FLOAT_EQ(0.f, scene->mMeshes[0]->mVertices[0].x);
+        EXPECT_FLOAT_EQ(5.f, scene->mMeshes[1]->mVertices[0].x);
+
+        const unsigned int expected[5] = { 0, 1, 0, 1, 0 };
+        for (unsigned int i = 0; i < 5; ++i) {
+            EXPECT_EQ(expected[i], scene->mRootNode->mChildren[i]->mMeshes[0]);
+        }
+        delete scene;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, mergesInstances) {
+    CheckInstancesMerged(false);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, mergesInstancesWithContentHash) {
+    CheckInstancesMerged(true);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, keepsDistinctMeshes) {
+    aiMesh* other = CreateQuadMesh(0.f);
+    other->mTextureCoords[0][2] = aiVector3D(0.5f, 0.5f, 0.f);
+    aiMesh* bones = CreateQuadMesh(0.f);
+    bones->mNumBones = 1;
+    bones->mBones = new aiBone*[1];
+    bones->mBones[0] = new aiBone();
+    bones->mBones[0]->mNumWeights = 1;
+    bones->mBones[0]->mWeights = new aiVertexWeight[1];
+    bones->mBones[0]->mWeights[0] = aiVertexWeight(0, 1.f);
+
+    aiScene* scene = CreateScene({ CreateQuadMesh(0.f), other, bones });
+    RunProcess(scene, false);
+    EXPECT_EQ(3u, scene->mNumMeshes);
+    delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, skinnedMeshesKeepTheirBones) {
+    for (int contentHash = 0; contentHash < 2; ++contentHash) {
+        aiScene* scene = CreateScene({ CreateSkinnedQuadMesh("arm_L"), CreateSkinnedQuadMesh("arm_R"),
+            CreateSkinnedQuadMesh("arm_L") });
+        RunProcess(scene, 0 != contentHash);
+
+        // equal weights bound to different bones are no instances
+        ASSERT_EQ(2u, scene->mNumMeshes);
+        EXPECT_STREQ("arm_L", scene->mMeshes[0]->mBones[0]->mName.C_Str());
+        EXPECT_STREQ("arm_R", scene->mMeshes[1]->mBones[0]->mName.C_Str());
+        EXPECT_EQ(0u, scene->mRootNode->mChildren[2]->mMeshes[0]);
+        delete scene;
+    }
+
+    std::unique_ptr<aiMesh> a(CreateSkinnedQuadMesh("arm_L"));
+    std::unique_ptr<aiMesh> b(CreateSkinnedQuadMesh("arm_R"));
+    EXPECT_NE(GetMeshContentHash(a.get(), true), GetMeshContentHash(b.get(), true));
+    b->mBones[0]->mName.Set("arm_L");
+    b->mBones[0]->mOffsetMatrix.a4 = 1.f;
+    EXPECT_NE(GetMeshContentHash(a.get(), true), GetMeshContentHash(b.get(), true));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, contentHash) {
+    std::unique_ptr<aiMesh> a(CreateQuadMesh(0.f));
+    std::unique_ptr<aiMesh> b(CreateQuadMesh(0.f));
+    EXPECT_EQ(GetMeshContentHash(a.get(), true), GetMeshContentHash(b.get(), true));
+
+    // -0 and +0 compare equal
+    b->mVertices[0].x = -0.f;
+    EXPECT_EQ(GetMeshContentHash(a.get(), true), GetMeshContentHash(b.get(), true));
+
+    b->mTextureCoords[0][1].y = 0.25f;
+    EXPECT_NE(GetMeshContentHash(a.get(), false), GetMeshContentHash(b.get(), false));
+
+    // the winding order is only part of the hash when requested
+    std::swap(b->mFaces[1].mIndices[0], b->mFaces[0].mIndices[0]);
+    b->mTextureCoords[0][1].y = a->mTextureCoords[0][1].y;
+    EXPECT_EQ(GetMeshContentHash(a.get(), false), GetMeshContentHash(b.get(), false));
+    EXPECT_NE(GetMeshContentHash(a.get(), true), GetMeshContentHash(b.get(), true));
+}
@@ -0,0 +1,330 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/SceneCombiner.h>
+#include <GenLODsProcess.h>
+#include <SortByPTypeProcess.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace Assimp;
+
+class GenLODsTest : public ::testing::Test {
+public:
+    virtual void SetUp();
+    virtual void TearDown();
+
+protected:
+    // a flat grid of n x n quads with a texture seam at x = n / 2
+    static const unsigned int n = 16;
+
+    GenLODsProcess *piProcess;
+    aiMesh *pcMesh;
+    std::vector<aiMesh *> lods;
+};
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest::SetUp() {
+    piProcess = new GenLODsProcess();
+
+    // the right half of the grid uses its own vertices, their texture
+    // coordinates are at u = 1 while the left half is at u = 0
+    const unsigned int row = n + 2;
+    pcMesh = new aiMesh();
+    pcMesh->mName.Set( "grid" );
+    pcMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    pcMesh->mNumVertices = ( n + 1 ) * row;
+    pcMesh->mVertices = new aiVector3D[ pcMesh->mNumVertices ];
+    pcMesh->mTextureCoords[ 0 ] = new aiVector3D[ pcMesh->mNumVertices ];
+    pcMesh->mNumUVComponents[ 0 ] = 2;
+    for ( unsigned int y = 0; y <= n; ++y ) {
+        for ( unsigned int i = 0; i < row; ++i ) {
+            const unsigned int x = i <= n / 2 ? i : i - 1;
+            pcMesh->mVertices[ y * row + i ] = aiVector3D( ( ai_real ) x, ( ai_real ) y, 0 );
+            pcMesh->mTextureCoords[ 0 ][ y * row + i ] = aiVector3D( i <= n / 2 ? 0.f : 1.f, 0, 0 );
+        }
+    }
+
+    pcMesh->mNumFaces = n * n * 2;
+    pcMesh->mFaces = new aiFace[ pcMesh->mNumFaces ];
+    for ( unsigned int y = 0, f = 0; y < n; ++y ) {
+        for ( unsigned int x = 0; x < n; ++x ) {
+            const unsigned int i = y * row + ( x < n / 2 ? x : x + 1 );
+            const unsigned int quad[ 2 ][ 3 ] = { { i, i + 1, i + row + 1 }, { i, i + row + 1, i + row } };
+            for ( unsigned int t = 0; t < 2; ++t, ++f ) {
+                aiFace &face = pcMesh->mFaces[ f ];
+                face.mIndices = new unsigned int[ face.mNumIndices = 3 ];
+                std::copy( quad[ t ], quad[ t ] + 3, face.mIndices );
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest::TearDown() {
+    for ( aiMesh *lod : lods ) {
+        delete lod;
+    }
+    delete piProcess;
+    delete pcMesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testGridLODs ) {
+    piProcess->SetRatios( { 0.125f, 0.5f, 0.25f, 2.f } );
+    ASSERT_TRUE( piProcess->ProcessMesh( pcMesh, lods ) );
+    ASSERT_EQ( 3u, lods.size() );
+    EXPECT_EQ( n * n * 2, pcMesh->mNumFaces );
+    EXPECT_STREQ( "grid_LOD1", lods[ 0 ]->mName.C_Str() );
+
+    const float ratios[] = { 0.5f, 0.25f, 0.125f };
+    for ( unsigned int k = 0; k < lods.size(); ++k ) {
+        const aiMesh *lod = lods[ k ];
+        EXPECT_LE( lod->mNumFaces, pcMesh->mNumFaces * ratios[ k ] );
+        ASSERT_TRUE( lod->HasTextureCoords( 0 ) );
+
+        // the grid is flat, so neither the outline nor the seam may move:
+        // both halves keep their area and stay on their side of the seam
+        ai_real area[ 2 ] = { 0, 0 };
+        aiVector3D min( 1e10f ), max( -1e10f );
+        for ( unsigned int f = 0; f < lod->mNumFaces; ++f ) {
+            const unsigned int *idx = lod->mFaces[ f ].mIndices;
+            const unsigned int side = lod->mTextureCoords[ 0 ][ idx[ 0 ] ].x > 0.5f ? 1 : 0;
+            for ( unsigned int i = 0; i < 3; ++i ) {
+                const aiVector3D &p = lod->mVertices[ idx[ i ] ];
+                EXPECT_EQ( side, lod->mTextureCoords[ 0 ][ idx[ i ] ].x > 0.5f ? 1u : 0u );
+                EXPECT_TRUE( side ? p.x >= n / 2 : p.x <= n / 2 );
+                min.x = std::min( min.x, p.x ); min.y = std::min( min.y, p.y );
+                max.x = std::max( max.x, p.x ); max.y = std::max( max.y, p.y );
+            }
+            const aiVector3D normal = ( lod->mVertices[ idx[ 1 ] ] - lod->mVertices[ idx[ 0 ] ] ) ^
+                ( lod->mVertices[ idx[ 2 ] ] - lod->mVertices[ idx[ 0 ] ] );
+            EXPECT_GT( normal.z, 0 );
+            area[ side ] += normal.z / 2;
+        }
+        EXPECT_NEAR( n * n / 2, area[ 0 ], 1e-3f );
+        EXPECT_NEAR( n * n / 2, area[ 1 ], 1e-3f );
+        EXPECT_EQ( aiVector3D( 0, 0, 1e10f ), aiVector3D( min.x, min.y, 1e10f ) );
+        EXPECT_EQ( aiVector3D( n, n, 1e10f ), aiVector3D( max.x, max.y, 1e10f ) );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testSkipsNonTriangleMeshes ) {
+    pcMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
+    EXPECT_FALSE( piProcess->ProcessMesh( pcMesh, lods ) );
+    EXPECT_TRUE( lods.empty() );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testImportedLODs ) {
+    Assimp::Importer importer;
+    importer.SetPropertyString( AI_CONFIG_PP_LOD_RATIOS, "0.5 0.2" );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality | aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+
+    unsigned int numLODs = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        const aiMesh *mesh = scene->mMeshes[ m ];
+        numLODs += mesh->mNumLODs;
+
+        unsigned int numFaces = mesh->mNumFaces;
+        for ( unsigned int k = 0; k < mesh->mNumLODs; ++k ) {
+            ASSERT_LT( mesh->mLODs[ k ], scene->mNumMeshes );
+            const aiMesh *lod = scene->mMeshes[ mesh->mLODs[ k ] ];
+            EXPECT_FALSE( lod->HasLODs() );
+            EXPECT_LT( lod->mNumFaces, numFaces );
+            numFaces = lod->mNumFaces;
+            EXPECT_EQ( mesh->mMaterialIndex, lod->mMaterialIndex );
+            EXPECT_EQ( mesh->HasNormals(), lod->HasNormals() );
+
+            // every vertex of a level is one of the original vertices
+            for ( unsigned int v = 0; v < lod->mNumVertices; v += 7 ) {
+                bool found = false;
+                for ( unsigned int i = 0; i < mesh->mNumVertices && !found; ++i ) {
+                    found = mesh->mVertices[ i ] == lod->mVertices[ v ] &&
+                            mesh->mTextureCoords[ 0 ][ i ] == lod->mTextureCoords[ 0 ][ v ];
+                }
+                EXPECT_TRUE( found );
+            }
+        }
+        if ( mesh->HasLODs() ) {
+            EXPECT_LE( scene->mMeshes[ mesh->mLODs[ 0 ] ]->mNumFaces, mesh->mNumFaces * 0.5f );
+        }
+    }
+    EXPECT_GT( numLODs, 0u );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testNoLODsByDefault ) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality );
+    ASSERT_NE( nullptr, scene );
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        EXPECT_FALSE( scene->mMeshes[ m ]->HasLODs() );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testRatiosAloneEnableLODs ) {
+    Assimp::Importer importer;
+    importer.SetPropertyString( AI_CONFIG_PP_LOD_RATIOS, "0.5" );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices );
+    ASSERT_NE( nullptr, scene );
+    unsigned int numLODs = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        numLODs += scene->mMeshes[ m ]->mNumLODs;
+    }
+    EXPECT_GT( numLODs, 0u );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testOptimizeMeshesKeepsLODs ) {
+    Assimp::Importer importer;
+    importer.SetPropertyString( AI_CONFIG_PP_LOD_RATIOS, "0.5 0.2" );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality );
+    ASSERT_NE( nullptr, scene );
+    const unsigned int numMeshes = scene->mNumMeshes;
+
+    // the levels aren't referenced by any node, but must neither be dropped nor merged
+    scene = importer.ApplyPostProcessing( aiProcess_OptimizeMeshes | aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+    EXPECT_EQ( numMeshes, scene->mNumMeshes );
+
+    unsigned int numLODs = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        const aiMesh *mesh = scene->mMeshes[ m ];
+        numLODs += mesh->mNumLODs;
+        for ( unsigned int k = 0; k < mesh->mNumLODs; ++k ) {
+            ASSERT_LT( mesh->mLODs[ k ], scene->mNumMeshes );
+            EXPECT_LT( scene->mMeshes[ mesh->mLODs[ k ] ]->mNumFaces, mesh->mNumFaces );
+            EXPECT_EQ( mesh->mMaterialIndex, scene->mMeshes[ mesh->mLODs[ k ] ]->mMaterialIndex );
+        }
+    }
+    EXPECT_GT( numLODs, 0u );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testPreTransformKeepsLODs ) {
+    Assimp::Importer importer;
+    importer.SetPropertyString( AI_CONFIG_PP_LOD_RATIOS, "0.5" );
+    importer.SetPropertyBool( AI_CONFIG_PP_PTV_KEEP_HIERARCHY, true );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality );
+    ASSERT_NE( nullptr, scene );
+    const unsigned int numMeshes = scene->mNumMeshes;
+
+    scene = importer.ApplyPostProcessing( aiProcess_PreTransformVertices | aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( numMeshes, scene->mNumMeshes );
+    unsigned int numLODs = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        numLODs += scene->mMeshes[ m ]->mNumLODs;
+    }
+    EXPECT_GT( numLODs, 0u );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenLODsTest, testRenumberedMeshesKeepLODs ) {
+    piProcess->SetRatios( { 0.5f, 0.25f } );
+    ASSERT_TRUE( piProcess->ProcessMesh( pcMesh, lods ) );
+    ASSERT_EQ( 2u, lods.size() );
+
+    // a mesh made of a point and a triangle, SortByPType splits it in two
+    aiMesh *mixed = new aiMesh();
+    mixed->mPrimitiveTypes = aiPrimitiveType_POINT | aiPrimitiveType_TRIANGLE;
+    mixed->mNumVertices = 4;
+    mixed->mVertices = new aiVector3D[ 4 ];
+    mixed->mVertices[ 2 ].x = mixed->mVertices[ 3 ].y = 1;
+    mixed->mNumFaces = 2;
+    mixed->mFaces = new aiFace[ 2 ];
+    mixed->mFaces[ 0 ].mIndices = new unsigned int[ mixed->mFaces[ 0 ].mNumIndices = 1 ]{ 0 };
+    mixed->mFaces[ 1 ].mIndices = new unsigned int[ mixed->mFaces[ 1 ].mNumIndices = 3 ]{ 1, 2, 3 };
+
+    aiScene *scene = new aiScene();
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[ 1 ]{ new aiMaterial() };
+    scene->mNumMeshes = 4;
+    scene->mMeshes = new aiMesh *[ 4 ]{ mixed, pcMesh, lods[ 0 ], lods[ 1 ] };
+    pcMesh->mLODs = new unsigned int[ pcMesh->mNumLODs = 2 ]{ 2, 3 };
+    scene->mRootNode = new aiNode();
+    scene->mRootNode->mMeshes = new unsigned int[ scene->mRootNode->mNumMeshes = 2 ]{ 0, 1 };
+    pcMesh = nullptr;
+    lods.clear();
+
+    SortByPTypeProcess sort;
+    sort.Execute( scene );
+    ASSERT_EQ( 5u, scene->mNumMeshes );
+    const aiMesh *grid = scene->mMeshes[ 2 ];
+    EXPECT_STREQ( "grid", grid->mName.C_Str() );
+    ASSERT_EQ( 2u, grid->mNumLODs );
+    EXPECT_STREQ( "grid_LOD1", scene->mMeshes[ grid->mLODs[ 0 ] ]->mName.C_Str() );
+    EXPECT_STREQ( "grid_LOD2", scene->mMeshes[ grid->mLODs[ 1 ] ]->mName.C_Str() );
+
+    // the levels of the second scene follow its other meshes
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene( &copy, scene );
+    std::vector<aiScene *> src = { scene, copy };
+    aiScene *merged = nullptr;
+    SceneCombiner::MergeScenes( &merged, src, 0 );
+    ASSERT_NE( nullptr, merged );
+    ASSERT_EQ( 10u, merged->mNumMeshes );
+    for ( unsigned int m = 2; m < 10; m += 5 ) {
+        grid = merged->mMeshes[ m ];
+        ASSERT_EQ( 2u, grid->mNumLODs );
+        EXPECT_EQ( m + 1, grid->mLODs[ 0 ] );
+        EXPECT_EQ( m + 2, grid->mLODs[ 1 ] );
+        EXPECT_STREQ( "grid_LOD1", merged->mMeshes[ grid->mLODs[ 0 ] ]->mName.C_Str() );
+    }
+    delete merged;
+}
@@ -0,0 +1,211 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <GenMeshletsProcess.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Assimp;
+
+class GenMeshletsTest : public ::testing::Test {
+public:
+    virtual void SetUp();
+    virtual void TearDown();
+
+protected:
+    typedef std::array<unsigned int, 3> Triangle;
+
+    // rotate the smallest index to the front, this keeps the winding order
+    static Triangle normalize( unsigned int a, unsigned int b, unsigned int c ) {
+        Triangle t = {{ a, b, c }};
+        std::rotate( t.begin(), std::min_element( t.begin(), t.end() ), t.end() );
+        return t;
+    }
+
+    static void checkMeshlets( const aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles );
+
+    GenMeshletsProcess *piProcess;
+    aiMesh *pcMesh;
+};
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsTest::SetUp() {
+    piProcess = new GenMeshletsProcess();
+
+    // a flat grid of 32x32 quads, two triangles each
+    const unsigned int n = 32;
+    pcMesh = new aiMesh();
+    pcMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    pcMesh->mNumVertices = ( n + 1 ) * ( n + 1 );
+    pcMesh->mVertices = new aiVector3D[ pcMesh->mNumVertices ];
+    for ( unsigned int y = 0; y <= n; ++y ) {
+        for ( unsigned int x = 0; x <= n; ++x ) {
+            pcMesh->mVertices[ y * ( n + 1 ) + x ] = aiVector3D( ( ai_real ) x, ( ai_real ) y, 0 );
+        }
+    }
+
+    pcMesh->mNumFaces = n * n * 2;
+    pcMesh->mFaces = new aiFace[ pcMesh->mNumFaces ];
+    for ( unsigned int y = 0, f = 0; y < n; ++y ) {
+        for ( unsigned int x = 0; x < n; ++x ) {
+            const unsigned int i = y * ( n + 1 ) + x;
+            const unsigned int quad[ 2 ][ 3 ] = { { i, i + 1, i + n + 2 }, { i, i + n + 2, i + n + 1 } };
+            for ( unsigned int t = 0; t < 2; ++t, ++f ) {
+                aiFace &face = pcMesh->mFaces[ f ];
+                face.mIndices = new unsigned int[ face.mNumIndices = 3 ];
+                std::copy( quad[ t ], quad[ t ] + 3, face.mIndices );
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsTest::TearDown() {
+    delete piProcess;
+    delete pcMesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsTest::checkMeshlets( const aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles ) {
+    ASSERT_TRUE( mesh->HasMeshlets() );
+
+    std::vector<Triangle> expected, actual;
+    for ( unsigned int f = 0; f < mesh->mNumFaces; ++f ) {
+        const unsigned int *idx = mesh->mFaces[ f ].mIndices;
+        expected.push_back( normalize( idx[ 0 ], idx[ 1 ], idx[ 2 ] ) );
+    }
+
+    for ( unsigned int m = 0; m < mesh->mNumMeshlets; ++m ) {
+        const aiMeshlet &meshlet = mesh->mMeshlets[ m ];
+        EXPECT_LE( meshlet.mVertexCount, maxVertices );
+        EXPECT_LE( meshlet.mTriangleCount, maxTriangles );
+        ASSERT_LE( meshlet.mVertexOffset + meshlet.mVertexCount, mesh->mNumMeshletVertices );
+        ASSERT_LE( meshlet.mTriangleOffset + meshlet.mTriangleCount * 3, mesh->mNumMeshletIndices );
+
+        const unsigned int *vertices = mesh->mMeshletVertices + meshlet.mVertexOffset;
+        const unsigned char *indices = mesh->mMeshletIndices + meshlet.mTriangleOffset;
+        for ( unsigned int v = 0; v < meshlet.mVertexCount; ++v ) {
+            const ai_real dist = ( mesh->mVertices[ vertices[ v ] ] - meshlet.mCenter ).Length();
+            EXPECT_LE( dist, meshlet.mRadius * 1.0001f + 1e-4f );
+        }
+
+        const ai_real minCos = std::sqrt( 1 - meshlet.mConeCutoff * meshlet.mConeCutoff );
+        for ( unsigned int t = 0; t < meshlet.mTriangleCount; ++t ) {
+            ASSERT_LT( indices[ t * 3 ], meshlet.mVertexCount );
+            ASSERT_LT( indices[ t * 3 + 1 ], meshlet.mVertexCount );
+            ASSERT_LT( indices[ t * 3 + 2 ], meshlet.mVertexCount );
+            const unsigned int a = vertices[ indices[ t * 3 ] ], b = vertices[ indices[ t * 3 + 1 ] ], c = vertices[ indices[ t * 3 + 2 ] ];
+            actual.push_back( normalize( a, b, c ) );
+
+            // all normals lie within the cone
+            aiVector3D normal = ( mesh->mVertices[ b ] - mesh->mVertices[ a ] ) ^ ( mesh->mVertices[ c ] - mesh->mVertices[ a ] );
+            if ( meshlet.mConeCutoff < 1 && normal.SquareLength() > 0 ) {
+                EXPECT_GE( normal.Normalize() * meshlet.mConeAxis, minCos - 1e-4f );
+            }
+        }
+    }
+
+    // every face ends up in exactly one meshlet
+    std::sort( expected.begin(), expected.end() );
+    std::sort( actual.begin(), actual.end() );
+    EXPECT_TRUE( expected == actual );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenMeshletsTest, testGridMeshlets ) {
+    piProcess->SetLimits( 64, 124 );
+    ASSERT_TRUE( piProcess->ProcessMesh( pcMesh ) );
+    checkMeshlets( pcMesh, 64, 124 );
+
+    // a flat grid needs at least 2048 / 98 meshlets, since 64 vertices can
+    // hold 98 triangles of a regular grid at most
+    EXPECT_LE( pcMesh->mNumMeshlets, 32u );
+
+    // all meshlets face up and can be culled from below
+    for ( unsigned int m = 0; m < pcMesh->mNumMeshlets; ++m ) {
+        const aiMeshlet &meshlet = pcMesh->mMeshlets[ m ];
+        EXPECT_NEAR( 1.f, meshlet.mConeAxis.z, 1e-4f );
+        aiVector3D view = meshlet.mConeApex - aiVector3D( 16, 16, -10 );
+        EXPECT_GE( view.Normalize() * meshlet.mConeAxis, meshlet.mConeCutoff );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenMeshletsTest, testSmallLimits ) {
+    piProcess->SetLimits( 3, 1 );
+    ASSERT_TRUE( piProcess->ProcessMesh( pcMesh ) );
+    checkMeshlets( pcMesh, 3, 1 );
+    EXPECT_EQ( pcMesh->mNumFaces, pcMesh->mNumMeshlets );
+
+    // running again replaces the meshlets
+    piProcess->SetLimits( 16, 16 );
+    ASSERT_TRUE( piProcess->ProcessMesh( pcMesh ) );
+    checkMeshlets( pcMesh, 16, 16 );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenMeshletsTest, testSkipsNonTriangleMeshes ) {
+    pcMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
+    EXPECT_FALSE( piProcess->ProcessMesh( pcMesh ) );
+    EXPECT_FALSE( pcMesh->HasMeshlets() );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( GenMeshletsTest, testImportWithMeshlets ) {
+    Importer importer;
+    importer.SetPropertyInteger( AI_CONFIG_PP_GM_VERTEX_LIMIT, 32 );
+    importer.SetPropertyInteger( AI_CONFIG_PP_GM_TRIANGLE_LIMIT, 48 );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality | aiProcess_GenMeshlets );
+    ASSERT_NE( nullptr, scene );
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        checkMeshlets( scene->mMeshes[ m ], 32, 48 );
+    }
+}
@@ -42,9 +42,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 #include "AbstractImportExportBase.h"
+#include "SceneDiffer.h"
 
 #include <assimp/Importer.hpp>
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 using namespace Assimp;
 
@@ -63,6 +66,21 @@ TEST_F( utIFCImportExport, importIFCFromFileTest ) {
     EXPECT_TRUE( importerTest() );
 }
 
+// Scanning the data section on several threads must not change the result
+TEST_F( utIFCImportExport, parallelImportMatchesSerialImport ) {
+    Assimp::Importer importer;
+    const aiScene *expected = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, expected );
+
+    Assimp::Importer parallel;
+    parallel.SetPropertyInteger( AI_CONFIG_IMPORT_IFC_NUM_THREADS, 4 );
+    const aiScene *scene = parallel.ReadFile( ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+
+    SceneDiffer differ;
+    EXPECT_TRUE( differ.isEqual( expected, scene ) );
+}
+
 TEST_F( utIFCImportExport, importComplextypeAsColor ) {
     std::string asset =
         "ISO-10303-21;\n"
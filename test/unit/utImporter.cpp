@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../../include/assimp/postprocess.h"
 #include "../../include/assimp/scene.h"
 #include <assimp/Importer.hpp>
+#include <assimp/cimport.h>
 #include <assimp/BaseImporter.h>
 #include "TestIOSystem.h"
 #include <assimp/DefaultIOSystem.h>
@@ -274,6 +275,81 @@ TEST_F(ImporterTest, testMultipleReads)
     //EXPECT_TRUE(pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/dwarf.x",flags)); # is in nonbsd
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportStatistics)
+{
+    const unsigned int flags = aiProcess_ValidateDataStructure | aiProcess_Triangulate | aiProcess_JoinIdenticalVertices;
+
+    // nothing is collected by default
+    ASSERT_TRUE(nullptr != pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags));
+    EXPECT_TRUE(nullptr == pImp->GetLastImportStatistics());
+
+    pImp->SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    const aiScene* scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_TRUE(nullptr != scene);
+
+    const aiImportStatistics* stats = pImp->GetLastImportStatistics();
+    ASSERT_TRUE(nullptr != stats);
+    // JoinIdenticalVertices is wrapped into the steps managing the shared SpatialSort
+    ASSERT_EQ(7U, stats->mNumSteps);
+    EXPECT_STREQ("import", stats->mSteps[0].mName.C_Str());
+    EXPECT_STREQ("validate", stats->mSteps[1].mName.C_Str());
+    EXPECT_STREQ("preprocess", stats->mSteps[2].mName.C_Str());
+    EXPECT_STREQ("TriangulateProcess", stats->mSteps[3].mName.C_Str());
+    EXPECT_STREQ("ComputeSpatialSortProcess", stats->mSteps[4].mName.C_Str());
+    EXPECT_STREQ("JoinVerticesProcess", stats->mSteps[5].mName.C_Str());
+    EXPECT_STREQ("DestroySpatialSortProcess", stats->mSteps[6].mName.C_Str());
+
+    EXPECT_EQ(0U, stats->mSteps[0].mNumMeshesIn);
+    EXPECT_EQ(0U, stats->mSteps[0].mBytesIn);
+    EXPECT_LT(0U, stats->mSteps[0].mBytesOut);
+
+    double total = 0.0;
+    for (unsigned int i = 0; i < stats->mNumSteps; ++i) {
+        EXPECT_LE(0.0, stats->mSteps[i].mSeconds);
+        total += stats->mSteps[i].mSeconds;
+        if (i > 0) {
+            // each phase starts with the output of the one before
+            EXPECT_EQ(stats->mSteps[i - 1].mNumMeshesOut, stats->mSteps[i].mNumMeshesIn);
+            EXPECT_EQ(stats->mSteps[i - 1].mNumVerticesOut, stats->mSteps[i].mNumVerticesIn);
+        }
+    }
+    EXPECT_DOUBLE_EQ(total, stats->mTotalSeconds);
+
+    // joining vertices must have reduced the vertex count to the final one
+    const aiImportStepStatistics& join = stats->mSteps[5];
+    EXPECT_GT(join.mNumVerticesIn, join.mNumVerticesOut);
+    unsigned int numVertices = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        numVertices += scene->mMeshes[i]->mNumVertices;
+    }
+    EXPECT_EQ(numVertices, join.mNumVerticesOut);
+    EXPECT_EQ(scene->mNumMeshes, join.mNumMeshesOut);
+
+    // a later post-processing run is appended
+    pImp->ApplyPostProcessing(aiProcess_GenSmoothNormals);
+    stats = pImp->GetLastImportStatistics();
+    ASSERT_EQ(8U, stats->mNumSteps);
+    EXPECT_STREQ("GenVertexNormalsProcess", stats->mSteps[7].mName.C_Str());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportStatisticsC)
+{
+    aiPropertyStore* props = aiCreatePropertyStore();
+    aiSetImportPropertyInteger(props, AI_CONFIG_GLOB_MEASURE_TIME, 1);
+    const aiScene* scene = aiImportFileExWithProperties(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        aiProcess_Triangulate, nullptr, props);
+    aiReleasePropertyStore(props);
+    ASSERT_TRUE(nullptr != scene);
+
+    const aiImportStatistics* stats = aiGetImportStatistics(scene);
+    ASSERT_TRUE(nullptr != stats);
+    ASSERT_EQ(3U, stats->mNumSteps);
+    EXPECT_STREQ("TriangulateProcess", stats->mSteps[2].mName.C_Str());
+    aiReleaseImport(scene);
+}
+
 TEST_F( ImporterTest, SearchFileHeaderForTokenTest ) {
     //DefaultIOSystem ioSystem;
 //    BaseImporter::SearchFileHeaderForToken( &ioSystem, assetPath, Token, 2 )
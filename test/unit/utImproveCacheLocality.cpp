@@ -41,4 +41,134 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 
-#include "UnitTestPCH.h"
\ No newline at end of file
+#include "UnitTestPCH.h"
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <vector>
+
+using namespace Assimp;
+
+class utImproveCacheLocality : public ::testing::Test {
+protected:
+    typedef std::array<ai_real, 9> Triangle;
+
+    static const aiScene *import( Importer &importer ) {
+        return importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality );
+    }
+
+    // the faces of a mesh as vertex positions, independent of the vertex order
+    static std::vector<Triangle> triangles( const aiMesh *mesh ) {
+        std::vector<Triangle> out;
+        for ( unsigned int f = 0; f < mesh->mNumFaces; ++f ) {
+            Triangle t;
+            for ( unsigned int i = 0; i < 3; ++i ) {
+                const aiVector3D &v = mesh->mVertices[ mesh->mFaces[ f ].mIndices[ i ] ];
+                t[ i * 3 ] = v.x;
+                t[ i * 3 + 1 ] = v.y;
+                t[ i * 3 + 2 ] = v.z;
+            }
+            out.push_back( t );
+        }
+        return out;
+    }
+};
+
+TEST_F( utImproveCacheLocality, vertexFetchOrderFollowsFaces ) {
+    Importer reference;
+    const aiScene *expected = import( reference );
+    ASSERT_NE( nullptr, expected );
+
+    Importer importer;
+    importer.SetPropertyBool( AI_CONFIG_PP_ICL_VERTEX_FETCH_ORDER, true );
+    const aiScene *scene = import( importer );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        const aiMesh *mesh = scene->mMeshes[ m ];
+        ASSERT_EQ( expected->mMeshes[ m ]->mNumVertices, mesh->mNumVertices );
+
+        // same triangles in the same order, only the vertices moved
+        EXPECT_TRUE( triangles( expected->mMeshes[ m ] ) == triangles( mesh ) );
+
+        // each new vertex is the next one in the buffer
+        unsigned int next = 0;
+        for ( unsigned int f = 0; f < mesh->mNumFaces; ++f ) {
+            for ( unsigned int i = 0; i < 3; ++i ) {
+                const unsigned int idx = mesh->mFaces[ f ].mIndices[ i ];
+                ASSERT_LE( idx, next );
+                if ( idx == next ) {
+                    ++next;
+                }
+            }
+        }
+    }
+}
+
+TEST_F( utImproveCacheLocality, overdrawReductionKeepsTriangles ) {
+    Importer reference;
+    const aiScene *expected = import( reference );
+    ASSERT_NE( nullptr, expected );
+
+    Importer importer;
+    importer.SetPropertyFloat( AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 1.05f );
+    const aiScene *scene = import( importer );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+
+    unsigned int reordered = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        std::vector<Triangle> a = triangles( expected->mMeshes[ m ] ), b = triangles( scene->mMeshes[ m ] );
+        if ( a != b ) {
+            ++reordered;
+        }
+        std::sort( a.begin(), a.end() );
+        std::sort( b.begin(), b.end() );
+        EXPECT_TRUE( a == b );
+    }
+
+    // the clusters of the model face in different directions, so they must have been sorted
+    EXPECT_LT( 0u, reordered );
+}
+
+// The reordering must not depend on the logger, which decides whether the ACMR is computed
+TEST_F( utImproveCacheLocality, reorderingIgnoresLogger ) {
+    // Main installs the logger for all tests
+    ASSERT_FALSE( DefaultLogger::isNullLogger() );
+
+    // without joined vertices the input ACMR is 3, so the logger sees the mesh as unsuitable
+    static const unsigned int flags = aiProcess_Triangulate | aiProcess_ImproveCacheLocality;
+    Importer reference;
+    const aiScene *expected = reference.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj", flags );
+    ASSERT_NE( nullptr, expected );
+
+    Importer importer;
+    importer.SetPropertyFloat( AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 1.05f );
+    importer.SetPropertyBool( AI_CONFIG_PP_ICL_VERTEX_FETCH_ORDER, true );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj", flags );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+
+    unsigned int reordered = 0;
+    for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+        const aiMesh *mesh = scene->mMeshes[ m ];
+        if ( triangles( expected->mMeshes[ m ] ) != triangles( mesh ) ) {
+            ++reordered;
+        }
+
+        // the first face uses the first vertices
+        ASSERT_LT( 0u, mesh->mNumFaces );
+        for ( unsigned int i = 0; i < 3; ++i ) {
+            EXPECT_EQ( i, mesh->mFaces[ 0 ].mIndices[ i ] );
+        }
+    }
+    EXPECT_LT( 0u, reordered );
+}
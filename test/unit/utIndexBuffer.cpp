@@ -0,0 +1,171 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/IndexBuffer.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utIndexBuffer : public ::testing::Test {
+protected:
+    // a strip of numFaces triangles over numVertices vertices
+    static aiMesh* makeMesh(unsigned int numFaces, unsigned int numVertices) {
+        aiMesh* mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = numVertices;
+        mesh->mVertices = new aiVector3D[numVertices];
+        mesh->mNumFaces = numFaces;
+        mesh->mFaces = new aiFace[numFaces];
+        for (unsigned int i = 0; i < numFaces; ++i) {
+            aiFace& face = mesh->mFaces[i];
+            face.mNumIndices = 3;
+            face.mIndices = new unsigned int[3];
+            for (unsigned int j = 0; j < 3; ++j) {
+                face.mIndices[j] = (i * 7 + j * 13) % numVertices;
+            }
+        }
+        return mesh;
+    }
+
+    static void expectSameFaces(const aiMesh* a, const aiMesh* b) {
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ASSERT_NE(nullptr, b->mFaces);
+        for (unsigned int i = 0; i < a->mNumFaces; ++i) {
+            ASSERT_EQ(a->mFaces[i].mNumIndices, b->mFaces[i].mNumIndices);
+            for (unsigned int j = 0; j < a->mFaces[i].mNumIndices; ++j) {
+                EXPECT_EQ(a->mFaces[i].mIndices[j], b->mFaces[i].mIndices[j]);
+            }
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utIndexBuffer, buildAndExpand32Bit) {
+    std::unique_ptr<aiMesh> reference(makeMesh(100, 50));
+    std::unique_ptr<aiMesh> mesh(makeMesh(100, 50));
+
+    ASSERT_TRUE(BuildIndexBuffer(mesh.get(), 4));
+    EXPECT_TRUE(mesh->HasIndexBuffer());
+    EXPECT_FALSE(mesh->HasFaces());
+    EXPECT_EQ(nullptr, mesh->mFaces);
+    EXPECT_EQ(100u, mesh->mNumFaces);
+    EXPECT_EQ(300u, mesh->mNumIndices);
+    EXPECT_EQ(4u, mesh->mIndexSize);
+
+    const unsigned int* indices = static_cast<const unsigned int*>(mesh->mIndexBuffer);
+    for (unsigned int i = 0; i < 100; ++i) {
+        for (unsigned int j = 0; j < 3; ++j) {
+            EXPECT_EQ(reference->mFaces[i].mIndices[j], indices[i * 3 + j]);
+        }
+    }
+
+    ExpandIndexBuffer(mesh.get());
+    EXPECT_FALSE(mesh->HasIndexBuffer());
+    EXPECT_EQ(0u, mesh->mIndexSize);
+    expectSameFaces(reference.get(), mesh.get());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utIndexBuffer, build16BitIfVertexCountPermits) {
+    std::unique_ptr<aiMesh> reference(makeMesh(33, 0x10000));
+    std::unique_ptr<aiMesh> mesh(makeMesh(33, 0x10000));
+
+    ASSERT_TRUE(BuildIndexBuffer(mesh.get(), 2));
+    EXPECT_EQ(2u, mesh->mIndexSize);
+    const unsigned short* indices = static_cast<const unsigned short*>(mesh->mIndexBuffer);
+    EXPECT_EQ(reference->mFaces[32].mIndices[2], indices[98]);
+
+    ExpandIndexBuffer(mesh.get());
+    expectSameFaces(reference.get(), mesh.get());
+
+    // one vertex too many for 16 bit indices
+    std::unique_ptr<aiMesh> large(makeMesh(10, 0x10001));
+    ASSERT_TRUE(BuildIndexBuffer(large.get(), 2));
+    EXPECT_EQ(4u, large->mIndexSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utIndexBuffer, nonTriangleMeshesKeepFaces) {
+    std::unique_ptr<aiMesh> mesh(makeMesh(10, 20));
+    aiFace& line = mesh->mFaces[4];
+    line.mNumIndices = 2;
+    mesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
+
+    EXPECT_FALSE(BuildIndexBuffer(mesh.get(), 4));
+    EXPECT_TRUE(mesh->HasFaces());
+    EXPECT_FALSE(mesh->HasIndexBuffer());
+
+    std::unique_ptr<aiMesh> empty(new aiMesh());
+    EXPECT_FALSE(BuildIndexBuffer(empty.get(), 4));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utIndexBuffer, importerBuildsIndexBuffers) {
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_INDEX_BUFFER, 16);
+    const aiScene* scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh* mesh = scene->mMeshes[i];
+        EXPECT_TRUE(mesh->HasIndexBuffer());
+        EXPECT_FALSE(mesh->HasFaces());
+        EXPECT_EQ(2u, mesh->mIndexSize);
+        EXPECT_EQ(mesh->mNumFaces * 3, mesh->mNumIndices);
+    }
+
+    // further post-processing sees the faces, the result is compacted again
+    const unsigned short* indices = static_cast<const unsigned short*>(scene->mMeshes[0]->mIndexBuffer);
+    const unsigned short first = indices[0], last = indices[2];
+    scene = importer.ApplyPostProcessing(aiProcess_FlipWindingOrder | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_TRUE(scene->mMeshes[0]->HasIndexBuffer());
+    indices = static_cast<const unsigned short*>(scene->mMeshes[0]->mIndexBuffer);
+    EXPECT_EQ(last, indices[0]);
+    EXPECT_EQ(first, indices[2]);
+}
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/scene.h>
+#include <assimp/Importer.hpp>
 #include <JoinVerticesProcess.h>
 
 
@@ -143,3 +144,57 @@ TEST_F(JoinVerticesTest, testProcess)
     EXPECT_EQ(150.f*299.f*3.f, fSum); // gaussian sum equation
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(JoinVerticesTest, testExactMatchProcess)
+{
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_JIV_EXACT_MATCH, true);
+    piProcess->SetupProperties(&importer);
+
+    // -0 and +0 are the same value
+    pcMesh->mNormals[450].x = -0.f;
+
+    // a tiny offset is joined by the epsilon-based search, but not in exact mode
+    pcMesh->mTextureCoords[0][899].x = 1e-7f;
+
+    piProcess->ProcessMesh(pcMesh,0);
+
+    ASSERT_EQ(300U, pcMesh->mNumFaces);
+    ASSERT_EQ(301U, pcMesh->mNumVertices);
+
+    // faces must still refer to their original positions
+    for (unsigned int i = 0; i < 300;++i)
+    {
+        const aiFace& face = pcMesh->mFaces[i];
+        for (unsigned int a = 0; a < 3;++a) {
+            ASSERT_LT(face.mIndices[a], pcMesh->mNumVertices);
+            EXPECT_EQ((float)((i*3+a)%300), pcMesh->mVertices[face.mIndices[a]].x);
+        }
+    }
+    EXPECT_EQ(1e-7f, pcMesh->mTextureCoords[0][pcMesh->mFaces[299].mIndices[2]].x);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(JoinVerticesTest, testExactMatchBoneWeights)
+{
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_JIV_EXACT_MATCH, true);
+    piProcess->SetupProperties(&importer);
+
+    // weight the first copy of vertex 0 differently than the other two
+    pcMesh->mNumBones = 1;
+    pcMesh->mBones = new aiBone*[1];
+    aiBone* bone = pcMesh->mBones[0] = new aiBone();
+    bone->mNumWeights = 2;
+    bone->mWeights = new aiVertexWeight[2];
+    bone->mWeights[0] = aiVertexWeight(0, 1.f);
+    bone->mWeights[1] = aiVertexWeight(300, 0.5f);
+
+    piProcess->ProcessMesh(pcMesh,0);
+
+    ASSERT_EQ(302U, pcMesh->mNumVertices);
+    ASSERT_EQ(1U, pcMesh->mNumBones);
+    EXPECT_EQ(2U, pcMesh->mBones[0]->mNumWeights);
+    EXPECT_NE(pcMesh->mFaces[0].mIndices[0], pcMesh->mFaces[100].mIndices[0]);
+    EXPECT_NE(pcMesh->mFaces[100].mIndices[0], pcMesh->mFaces[200].mIndices[0]);
+}
@@ -0,0 +1,133 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <string.h>
+#include <vector>
+
+using namespace Assimp;
+
+class utMemoryMappedIOSystem : public ::testing::Test {
+protected:
+    void compareImports( const char *file ) {
+        Importer reference;
+        const aiScene *expected = reference.ReadFile( file, aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, expected );
+
+        Importer mapped;
+        mapped.SetIOHandler( new MemoryMappedIOSystem );
+        const aiScene *scene = mapped.ReadFile( file, aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, scene );
+
+        ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+        for ( unsigned int i = 0; i < scene->mNumMeshes; ++i ) {
+            const aiMesh *a = expected->mMeshes[ i ], *b = scene->mMeshes[ i ];
+            ASSERT_EQ( a->mNumVertices, b->mNumVertices );
+            EXPECT_EQ( a->mNumFaces, b->mNumFaces );
+            EXPECT_EQ( 0, memcmp( a->mVertices, b->mVertices, sizeof( aiVector3D ) * a->mNumVertices ) );
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utMemoryMappedIOSystem, readMappedFileTest ) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+
+    DefaultIOSystem plain;
+    std::unique_ptr<IOStream> reference( plain.Open( file, "rb" ) );
+    ASSERT_NE( nullptr, reference.get() );
+    EXPECT_EQ( nullptr, reference->GetMappedData() );
+    std::vector<uint8_t> expected( reference->FileSize() );
+    ASSERT_EQ( 1u, reference->Read( &expected[ 0 ], expected.size(), 1 ) );
+
+    MemoryMappedIOSystem io;
+    std::unique_ptr<IOStream> stream( io.Open( file, "rb" ) );
+    ASSERT_NE( nullptr, stream.get() );
+    ASSERT_NE( nullptr, stream->GetMappedData() );
+    ASSERT_EQ( expected.size(), stream->FileSize() );
+    EXPECT_EQ( 0, memcmp( &expected[ 0 ], stream->GetMappedData(), expected.size() ) );
+
+    uint8_t header[ 16 ];
+    EXPECT_EQ( 1u, stream->Read( header, sizeof( header ), 1 ) );
+    EXPECT_EQ( sizeof( header ), stream->Tell() );
+    EXPECT_EQ( 0, memcmp( &expected[ 0 ], header, sizeof( header ) ) );
+
+    EXPECT_EQ( aiReturn_SUCCESS, stream->Seek( 4, aiOrigin_END ) );
+    EXPECT_EQ( expected.size() - 4, stream->Tell() );
+    EXPECT_EQ( 0u, stream->Read( header, sizeof( header ), 1 ) );
+    EXPECT_EQ( aiReturn_FAILURE, stream->Seek( expected.size() + 1, aiOrigin_SET ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utMemoryMappedIOSystem, fallbackTest ) {
+    MemoryMappedIOSystem io;
+    EXPECT_EQ( nullptr, io.Open( ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl", "rb" ) );
+
+    const char *file = "mmap_fallback_test.bin";
+    std::unique_ptr<IOStream> out( io.Open( file, "wb" ) );
+    ASSERT_NE( nullptr, out.get() );
+    EXPECT_EQ( nullptr, out->GetMappedData() );
+    out.reset();
+    io.DeleteFile( file );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utMemoryMappedIOSystem, importBinaryFBXTest ) {
+    compareImports( ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx" );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utMemoryMappedIOSystem, importGLBTest ) {
+    compareImports( ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb" );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utMemoryMappedIOSystem, importBinarySTLTest ) {
+    compareImports( ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl" );
+}
@@ -415,3 +415,58 @@ TEST_F(utObjImportExport, import_without_linend) {
     const aiScene *scene = myImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box_without_lineending.obj", 0);
     ASSERT_NE(nullptr, scene);
 }
+
+static void checkParallelImport( const char *file, const std::string &content = std::string() ) {
+    Assimp::Importer serialImporter, parallelImporter;
+    parallelImporter.SetPropertyInteger( AI_CONFIG_IMPORT_OBJ_NUM_THREADS, 4 );
+
+    const aiScene *expected, *scene;
+    if ( nullptr != file ) {
+        expected = serialImporter.ReadFile( file, aiProcess_ValidateDataStructure );
+        scene = parallelImporter.ReadFile( file, aiProcess_ValidateDataStructure );
+    } else {
+        expected = serialImporter.ReadFileFromMemory( content.c_str(), content.size(), aiProcess_ValidateDataStructure, "obj" );
+        scene = parallelImporter.ReadFileFromMemory( content.c_str(), content.size(), aiProcess_ValidateDataStructure, "obj" );
+    }
+    ASSERT_NE( nullptr, expected );
+    ASSERT_NE( nullptr, scene );
+
+    SceneDiffer differ;
+    EXPECT_TRUE( differ.isEqual( expected, scene ) );
+    differ.showReport();
+
+    ASSERT_EQ( expected->mRootNode->mNumChildren, scene->mRootNode->mNumChildren );
+    for ( unsigned int i = 0; i < scene->mRootNode->mNumChildren; ++i ) {
+        const aiNode *expectedNode = expected->mRootNode->mChildren[ i ], *node = scene->mRootNode->mChildren[ i ];
+        EXPECT_STREQ( expectedNode->mName.C_Str(), node->mName.C_Str() );
+        ASSERT_EQ( expectedNode->mNumMeshes, node->mNumMeshes );
+        for ( unsigned int j = 0; j < node->mNumMeshes; ++j ) {
+            EXPECT_EQ( expectedNode->mMeshes[ j ], node->mMeshes[ j ] );
+        }
+    }
+}
+
+TEST_F( utObjImportExport, parallel_import_matches_serial_import ) {
+    checkParallelImport( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj" );
+    checkParallelImport( ASSIMP_TEST_MODELS_DIR "/OBJ/cube_usemtl.obj" );
+    checkParallelImport( ASSIMP_TEST_MODELS_DIR "/OBJ/cube_with_vertexcolors.obj" );
+    checkParallelImport( ASSIMP_TEST_MODELS_DIR "/OBJ/box_without_lineending.obj" );
+    checkParallelImport( ASSIMP_TEST_MODELS_DIR "/OBJ/testmixed.obj" );
+}
+
+TEST_F( utObjImportExport, parallel_import_relative_indices_and_groups ) {
+    // Enough lines to be split across several chunks, with relative indices
+    // pointing into the data of earlier chunks and alternating groups
+    std::string content;
+    for ( unsigned int i = 0; i < 200; ++i ) {
+        const std::string n = std::to_string( i );
+        content += "g group" + std::to_string( i % 3 ) + "\r\n";
+        content += "v " + n + " 0 0\r\nv " + n + " 1 0\r\n";
+        content += "vt 0 " + n + "\nvn 0 0 1\n# comment\n";
+        content += "v " + n + " 1 1\n";
+        content += i % 2 ? "usemtl a\n" : "usemtl b\n";
+        content += "f -3/-1/-1 -2/-1/-1 -1/-1/-1\n";
+        content += "f " + std::to_string( i * 3 + 1 ) + " -2 -1\n";
+    }
+    checkParallelImport( nullptr, content );
+}
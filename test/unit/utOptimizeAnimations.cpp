@@ -0,0 +1,245 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <OptimizeAnimationsProcess.h>
+
+#include <cmath>
+
+using namespace Assimp;
+
+// number of keys of the test channel, one per frame
+static const unsigned int numKeys = 101;
+
+class OptimizeAnimationsTest : public ::testing::Test {
+public:
+    virtual void SetUp();
+    virtual void TearDown();
+
+protected:
+    // value of a track at the given time
+    static aiVector3D evaluate( const aiVectorKey *keys, unsigned int num, double time );
+    static aiQuaternion evaluate( const aiQuatKey *keys, unsigned int num, double time );
+
+    OptimizeAnimationsProcess *piProcess;
+    aiNodeAnim *pcChannel;
+};
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsTest::SetUp() {
+    piProcess = new OptimizeAnimationsProcess();
+
+    // a baked channel with a key on each frame
+    pcChannel = new aiNodeAnim();
+    pcChannel->mPositionKeys = new aiVectorKey[ pcChannel->mNumPositionKeys = numKeys ];
+    pcChannel->mRotationKeys = new aiQuatKey[ pcChannel->mNumRotationKeys = numKeys ];
+    pcChannel->mScalingKeys = new aiVectorKey[ pcChannel->mNumScalingKeys = numKeys ];
+    for ( unsigned int i = 0; i < numKeys; ++i ) {
+        const double time = i;
+        pcChannel->mPositionKeys[ i ] = aiVectorKey( time, aiVector3D( std::sin( time * 0.1f ), std::cos( time * 0.05f ), 0 ) );
+        pcChannel->mRotationKeys[ i ] = aiQuatKey( time, aiQuaternion( aiVector3D( 0, 0, 1 ), ( ai_real ) std::sin( time * 0.04f ) ) );
+        pcChannel->mScalingKeys[ i ] = aiVectorKey( time, aiVector3D( 1 + ( i % 2 ) * 0.001f ) );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsTest::TearDown() {
+    delete piProcess;
+    delete pcChannel;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D OptimizeAnimationsTest::evaluate( const aiVectorKey *keys, unsigned int num, double time ) {
+    unsigned int i = 0;
+    while ( i + 2 < num && keys[ i + 1 ].mTime <= time ) {
+        ++i;
+    }
+    if ( num == 1 ) {
+        return keys[ 0 ].mValue;
+    }
+    const ai_real f = ( ai_real ) ( ( time - keys[ i ].mTime ) / ( keys[ i + 1 ].mTime - keys[ i ].mTime ) );
+    return keys[ i ].mValue + ( keys[ i + 1 ].mValue - keys[ i ].mValue ) * f;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiQuaternion OptimizeAnimationsTest::evaluate( const aiQuatKey *keys, unsigned int num, double time ) {
+    unsigned int i = 0;
+    while ( i + 2 < num && keys[ i + 1 ].mTime <= time ) {
+        ++i;
+    }
+    if ( num == 1 ) {
+        return keys[ 0 ].mValue;
+    }
+    aiQuaternion out;
+    aiQuaternion::Interpolate( out, keys[ i ].mValue, keys[ i + 1 ].mValue,
+            ( ai_real ) ( ( time - keys[ i ].mTime ) / ( keys[ i + 1 ].mTime - keys[ i ].mTime ) ) );
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testExactReduction ) {
+    // a linear section and a constant section are removed without any error
+    for ( unsigned int i = 0; i < numKeys; ++i ) {
+        pcChannel->mPositionKeys[ i ].mValue = aiVector3D( i <= 50 ? ( ai_real ) i : 50.f, 0, 0 );
+        pcChannel->mRotationKeys[ i ].mValue = aiQuaternion( aiVector3D( 0, 1, 0 ), 0.5f );
+        pcChannel->mScalingKeys[ i ].mValue = aiVector3D( 1, 1, 1 );
+    }
+    pcChannel->mScalingKeys[ 70 ].mValue = aiVector3D( 2, 1, 1 );
+
+    piProcess->ProcessChannel( pcChannel, 25 );
+    ASSERT_EQ( 3u, pcChannel->mNumPositionKeys );
+    EXPECT_EQ( 50., pcChannel->mPositionKeys[ 1 ].mTime );
+    EXPECT_EQ( 100., pcChannel->mPositionKeys[ 2 ].mTime );
+    EXPECT_EQ( 1u, pcChannel->mNumRotationKeys );
+    ASSERT_EQ( 5u, pcChannel->mNumScalingKeys );
+    EXPECT_EQ( 70., pcChannel->mScalingKeys[ 2 ].mTime );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testErrorBounds ) {
+    aiNodeAnim original;
+    original.mPositionKeys = new aiVectorKey[ original.mNumPositionKeys = numKeys ];
+    original.mRotationKeys = new aiQuatKey[ original.mNumRotationKeys = numKeys ];
+    std::copy( pcChannel->mPositionKeys, pcChannel->mPositionKeys + numKeys, original.mPositionKeys );
+    std::copy( pcChannel->mRotationKeys, pcChannel->mRotationKeys + numKeys, original.mRotationKeys );
+
+    const ai_real maxPosition = 0.01f, maxRotation = 0.5f;
+    piProcess->SetErrors( maxPosition, maxRotation, 0.002f );
+    piProcess->ProcessChannel( pcChannel, 25 );
+    EXPECT_LT( pcChannel->mNumPositionKeys, numKeys / 2 );
+    EXPECT_LT( pcChannel->mNumRotationKeys, numKeys / 4 );
+    EXPECT_EQ( 1u, pcChannel->mNumScalingKeys );
+    EXPECT_EQ( 0., pcChannel->mPositionKeys[ 0 ].mTime );
+    EXPECT_EQ( 100., pcChannel->mPositionKeys[ pcChannel->mNumPositionKeys - 1 ].mTime );
+
+    for ( unsigned int i = 0; i < numKeys; ++i ) {
+        const double time = original.mPositionKeys[ i ].mTime;
+        const aiVector3D p = evaluate( pcChannel->mPositionKeys, pcChannel->mNumPositionKeys, time );
+        EXPECT_LE( ( p - original.mPositionKeys[ i ].mValue ).Length(), maxPosition * 1.001f );
+
+        aiQuaternion q = evaluate( pcChannel->mRotationKeys, pcChannel->mNumRotationKeys, time );
+        const aiQuaternion &r = original.mRotationKeys[ i ].mValue;
+        q.Normalize();
+        const ai_real cos = std::min( 1.f, std::fabs( q.x * r.x + q.y * r.y + q.z * r.z + q.w * r.w ) );
+        EXPECT_LE( 2 * std::acos( cos ), AI_DEG_TO_RAD( maxRotation ) * 1.01f );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testResample ) {
+    // resample from 25 to 10 keys per second
+    piProcess->SetResampleRate( 10 );
+    piProcess->ProcessChannel( pcChannel, 25 );
+    ASSERT_LE( pcChannel->mNumPositionKeys, 41u );
+    ASSERT_GT( pcChannel->mNumPositionKeys, 30u );
+    for ( unsigned int i = 0; i < pcChannel->mNumPositionKeys; ++i ) {
+        const double frame = pcChannel->mPositionKeys[ i ].mTime / 2.5;
+        EXPECT_NEAR( std::floor( frame + 0.5 ), frame, 1e-9 );
+    }
+    EXPECT_EQ( 100., pcChannel->mPositionKeys[ pcChannel->mNumPositionKeys - 1 ].mTime );
+    EXPECT_LE( pcChannel->mNumRotationKeys, 41u );
+
+    // without a tick rate there is nothing to resample to
+    delete pcChannel;
+    SetUp();
+    piProcess->ProcessChannel( pcChannel, 0 );
+    EXPECT_EQ( numKeys, pcChannel->mNumPositionKeys );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testLongLinearTrack ) {
+    // the segments are limited in length, but still reproduce the track
+    const unsigned int num = 10001;
+    aiNodeAnim channel;
+    channel.mPositionKeys = new aiVectorKey[ channel.mNumPositionKeys = num ];
+    for ( unsigned int i = 0; i < num; ++i ) {
+        channel.mPositionKeys[ i ] = aiVectorKey( i, aiVector3D( ( ai_real ) i, 0, 0 ) );
+    }
+    piProcess->ProcessChannel( &channel, 25 );
+    EXPECT_LT( channel.mNumPositionKeys, num / 100 );
+    for ( unsigned int i = 0; i < channel.mNumPositionKeys; ++i ) {
+        EXPECT_EQ( channel.mPositionKeys[ i ].mTime, channel.mPositionKeys[ i ].mValue.x );
+    }
+    EXPECT_EQ( num - 1., channel.mPositionKeys[ channel.mNumPositionKeys - 1 ].mTime );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testDisabledByDefault ) {
+    aiScene scene;
+    scene.mAnimations = new aiAnimation *[ scene.mNumAnimations = 1 ]{ new aiAnimation() };
+    scene.mAnimations[ 0 ]->mChannels = new aiNodeAnim *[ scene.mAnimations[ 0 ]->mNumChannels = 1 ]{ pcChannel };
+    for ( unsigned int i = 0; i < numKeys; ++i ) {
+        pcChannel->mPositionKeys[ i ].mValue = aiVector3D( 1, 2, 3 );
+    }
+    pcChannel = nullptr;
+
+    piProcess->Execute( &scene );
+    EXPECT_EQ( numKeys, scene.mAnimations[ 0 ]->mChannels[ 0 ]->mNumPositionKeys );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( OptimizeAnimationsTest, testImportBVH ) {
+    // without AI_CONFIG_PP_OA_ENABLE the keys are left alone, no flag is needed to enable it
+    unsigned int count[ 2 ] = { 0, 0 };
+    for ( unsigned int pass = 0; pass < 2; ++pass ) {
+        Assimp::Importer importer;
+        importer.SetPropertyFloat( AI_CONFIG_PP_OA_POSITION_ERROR, 0.1f );
+        importer.SetPropertyFloat( AI_CONFIG_PP_OA_ROTATION_ERROR, 0.5f );
+        importer.SetPropertyBool( AI_CONFIG_PP_OA_ENABLE, pass != 0 );
+        const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/BVH/01_01.bvh",
+                aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, scene );
+        ASSERT_TRUE( scene->HasAnimations() );
+
+        for ( unsigned int i = 0; i < scene->mAnimations[ 0 ]->mNumChannels; ++i ) {
+            const aiNodeAnim *channel = scene->mAnimations[ 0 ]->mChannels[ i ];
+            count[ pass ] += channel->mNumRotationKeys;
+        }
+    }
+    // the capture runs at 120 frames per second
+    EXPECT_LT( count[ 1 ] * 3, count[ 0 ] );
+}
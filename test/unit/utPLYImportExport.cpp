@@ -47,6 +47,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractImportExportBase.h"
 #include <assimp/postprocess.h>
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 using namespace ::Assimp;
 
 class utPLYImportExport : public AbstractImportExportBase {
@@ -181,3 +185,111 @@ TEST_F( utPLYImportExport, parseErrorTest ) {
     const aiScene *scene = importer.ReadFileFromMemory( test_file, strlen( test_file ), 0);
     EXPECT_NE( nullptr, scene );
 }
+
+static const char *test_file_with_faces =
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "property uchar red\n"
+    "property uchar green\n"
+    "property uchar blue\n"
+    "property short nx\n"
+    "property double ny\n"
+    "property float nz\n"
+    "element face 2\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n"
+    "0.0 0.0 0.0 255 255 255 0 1.0 0.0\n"
+    "0.0 0.0 1.5 255 0 255 0 0.0 1.0\n"
+    "0.0 1.0 0.0 255 255 0 1 0.0 0.0\n"
+    "0.25 1.0 1.0 0 255 255 1 1.0 0.0\n"
+    "3 0 1 2\n"
+    "4 0 1 3 2\n";
+
+// Appends a value in the requested byte order
+template <typename T>
+static void appendBinary(std::string &out, T value, bool bigEndian) {
+    char bytes[sizeof(T)];
+    ::memcpy(bytes, &value, sizeof(T));
+    const unsigned int probe = 1;
+    const bool hostIsBigEndian = 0 == *reinterpret_cast<const char*>(&probe);
+    if (bigEndian != hostIsBigEndian) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+// Builds the binary counterpart of test_file_with_faces
+static std::string binaryTestFile(bool bigEndian) {
+    std::string out = "ply\nformat ";
+    out += bigEndian ? "binary_big_endian" : "binary_little_endian";
+    out += " 1.0\n";
+    out += std::strstr(test_file_with_faces, "element vertex");
+
+    // strip the ASCII body again
+    out.resize(out.find("end_header\n") + strlen("end_header\n"));
+
+    const float pos[4][3] = { { 0.f, 0.f, 0.f }, { 0.f, 0.f, 1.5f }, { 0.f, 1.f, 0.f }, { 0.25f, 1.f, 1.f } };
+    const unsigned char clr[4][3] = { { 255, 255, 255 }, { 255, 0, 255 }, { 255, 255, 0 }, { 0, 255, 255 } };
+    const short nx[4] = { 0, 0, 1, 1 };
+    const double ny[4] = { 1., 0., 0., 1. };
+    const float nz[4] = { 0.f, 1.f, 0.f, 0.f };
+    for (unsigned int i = 0; i < 4; ++i) {
+        for (unsigned int c = 0; c < 3; ++c) {
+            appendBinary(out, pos[i][c], bigEndian);
+        }
+        for (unsigned int c = 0; c < 3; ++c) {
+            appendBinary(out, clr[i][c], bigEndian);
+        }
+        appendBinary(out, nx[i], bigEndian);
+        appendBinary(out, ny[i], bigEndian);
+        appendBinary(out, nz[i], bigEndian);
+    }
+
+    const int faces[] = { 3, 0, 1, 2, 4, 0, 1, 3, 2 };
+    for (unsigned int i = 0; i < sizeof(faces) / sizeof(faces[0]); ++i) {
+        if (0 == i || 4 == i) {
+            appendBinary(out, static_cast<unsigned char>(faces[i]), bigEndian);
+        } else {
+            appendBinary(out, faces[i], bigEndian);
+        }
+    }
+    return out;
+}
+
+// Binary vertices and faces are decoded in place, they must match the ASCII path
+TEST_F(utPLYImportExport, binaryRecordsMatchAscii) {
+    Assimp::Importer asciiImporter;
+    const aiScene *expected = asciiImporter.ReadFileFromMemory(test_file_with_faces, strlen(test_file_with_faces), 0, "ply");
+    ASSERT_NE(nullptr, expected);
+    const aiMesh *expectedMesh = expected->mMeshes[0];
+    ASSERT_EQ(4u, expectedMesh->mNumVertices);
+    ASSERT_EQ(2u, expectedMesh->mNumFaces);
+
+    for (int bigEndian = 0; bigEndian < 2; ++bigEndian) {
+        const std::string binary = binaryTestFile(0 != bigEndian);
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFileFromMemory(binary.data(), binary.size(), 0, "ply");
+        ASSERT_NE(nullptr, scene);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+        ASSERT_TRUE(mesh->HasNormals());
+        ASSERT_TRUE(mesh->HasVertexColors(0));
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            EXPECT_EQ(expectedMesh->mVertices[i], mesh->mVertices[i]);
+            EXPECT_EQ(expectedMesh->mNormals[i], mesh->mNormals[i]);
+            EXPECT_EQ(expectedMesh->mColors[0][i], mesh->mColors[0][i]);
+        }
+
+        ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            ASSERT_EQ(expectedMesh->mFaces[i].mNumIndices, mesh->mFaces[i].mNumIndices);
+            for (unsigned int a = 0; a < mesh->mFaces[i].mNumIndices; ++a) {
+                EXPECT_EQ(expectedMesh->mFaces[i].mIndices[a], mesh->mFaces[i].mIndices[a]);
+            }
+        }
+    }
+}
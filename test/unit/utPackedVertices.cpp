@@ -0,0 +1,238 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/PackedVertices.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+static const unsigned int AllStreams = aiPackedVertexStream_Positions | aiPackedVertexStream_Normals |
+        aiPackedVertexStream_TexCoords | aiPackedVertexStream_Colors;
+
+class utPackedVertices : public ::testing::Test {
+protected:
+    // a point cloud with all streams filled from a simple pseudo random sequence
+    static aiMesh* makeMesh(unsigned int numVertices) {
+        aiMesh* mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_POINT;
+        mesh->mNumVertices = numVertices;
+        mesh->mVertices = new aiVector3D[numVertices];
+        mesh->mNormals = new aiVector3D[numVertices];
+        mesh->mTangents = new aiVector3D[numVertices];
+        mesh->mBitangents = new aiVector3D[numVertices];
+        mesh->mTextureCoords[0] = new aiVector3D[numVertices];
+        mesh->mTextureCoords[1] = new aiVector3D[numVertices];
+        mesh->mNumUVComponents[0] = mesh->mNumUVComponents[1] = 2;
+        mesh->mColors[0] = new aiColor4D[numVertices];
+
+        unsigned int seed = 12345;
+        auto next = [&seed]() {
+            seed = seed * 1103515245u + 12345u;
+            return ((seed >> 8) & 0xffff) / ai_real(0xffff);
+        };
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            mesh->mVertices[i] = aiVector3D(next() * 20 - 10, next() * 4 + 100, next() * 0.5f);
+            mesh->mNormals[i] = aiVector3D(next() * 2 - 1, next() * 2 - 1, next() * 2 - 1).Normalize();
+            mesh->mTangents[i] = aiVector3D(next() * 2 - 1, next() * 2 - 1, next() * 2 - 1).Normalize();
+            mesh->mBitangents[i] = (mesh->mNormals[i] ^ mesh->mTangents[i]).Normalize();
+            mesh->mTextureCoords[0][i] = aiVector3D(next(), next(), 0);
+            mesh->mTextureCoords[1][i] = aiVector3D(next() * 8 - 4, next() * 3, 0);
+            mesh->mColors[0][i] = aiColor4D(next(), next(), next(), 1);
+        }
+        return mesh;
+    }
+
+    // distance between two unit vectors, about the angle in radians for small angles
+    static ai_real chord(const aiVector3D& a, const aiVector3D& b) {
+        return (a - b).Length();
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utPackedVertices, buildAndExpandAllStreams) {
+    std::unique_ptr<aiMesh> reference(makeMesh(1000));
+    std::unique_ptr<aiMesh> mesh(makeMesh(1000));
+
+    ASSERT_TRUE(BuildPackedVertices(mesh.get(), AllStreams));
+    EXPECT_TRUE(mesh->HasPackedVertices());
+    EXPECT_FALSE(mesh->HasPositions());
+    EXPECT_FALSE(mesh->HasNormals());
+    EXPECT_FALSE(mesh->HasTangentsAndBitangents());
+    EXPECT_FALSE(mesh->HasTextureCoords(0));
+    EXPECT_FALSE(mesh->HasVertexColors(0));
+
+    // 8 bytes position, 3 * 4 bytes directions, 2 * 4 bytes uv and 4 bytes color
+    const aiPackedVertexLayout& layout = mesh->mPackedLayout;
+    EXPECT_EQ(AllStreams, layout.mStreams);
+    EXPECT_EQ(32u, layout.mStride);
+    EXPECT_EQ(0u, layout.mPositionOffset);
+    EXPECT_EQ(8u, layout.mNormalOffset);
+    EXPECT_EQ(AI_PACKED_VERTEX_NONE, layout.mTexCoordOffset[2]);
+    EXPECT_EQ(AI_PACKED_VERTEX_NONE, layout.mColorOffset[1]);
+
+    // the builder must not pack twice
+    EXPECT_FALSE(BuildPackedVertices(mesh.get(), AllStreams));
+
+    for (unsigned int i = 0; i < 1000; ++i) {
+        const aiVector3D p = GetVertexPosition(mesh.get(), i);
+        EXPECT_NEAR(reference->mVertices[i].x, p.x, 20.0 / 65535);
+        EXPECT_NEAR(reference->mVertices[i].y, p.y, 4.0 / 65535);
+        EXPECT_NEAR(reference->mVertices[i].z, p.z, 0.5 / 65535);
+        EXPECT_LT(chord(reference->mNormals[i], GetVertexNormal(mesh.get(), i)), 1e-4);
+        EXPECT_LT(chord(reference->mTangents[i], GetVertexTangent(mesh.get(), i)), 1e-4);
+        EXPECT_LT(chord(reference->mBitangents[i], GetVertexBitangent(mesh.get(), i)), 1e-4);
+        const aiVector3D uv = GetVertexTextureCoords(mesh.get(), 1, i);
+        EXPECT_NEAR(reference->mTextureCoords[1][i].x, uv.x, 8.0 / 65535);
+        EXPECT_NEAR(reference->mTextureCoords[1][i].y, uv.y, 3.0 / 65535);
+        EXPECT_NEAR(reference->mColors[0][i].g, GetVertexColor(mesh.get(), 0, i).g, 0.5 / 255);
+    }
+    EXPECT_EQ(aiVector3D(), GetVertexTextureCoords(mesh.get(), 2, 0));
+
+    ExpandPackedVertices(mesh.get());
+    EXPECT_FALSE(mesh->HasPackedVertices());
+    EXPECT_EQ(0u, mesh->mPackedLayout.mStride);
+    ASSERT_TRUE(mesh->HasPositions());
+    ASSERT_TRUE(mesh->HasNormals());
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    ASSERT_TRUE(mesh->HasTextureCoords(1));
+    ASSERT_TRUE(mesh->HasVertexColors(0));
+    EXPECT_NEAR(reference->mVertices[17].x, mesh->mVertices[17].x, 20.0 / 65535);
+    EXPECT_LT(chord(reference->mNormals[17], mesh->mNormals[17]), 1e-4);
+    EXPECT_NEAR(reference->mTextureCoords[0][17].y, mesh->mTextureCoords[0][17].y, 1.0 / 65535);
+    EXPECT_NEAR(reference->mColors[0][17].r, mesh->mColors[0][17].r, 0.5 / 255);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utPackedVertices, selectedStreamsOnly) {
+    std::unique_ptr<aiMesh> mesh(makeMesh(10));
+    const aiVector3D normal = mesh->mNormals[3];
+
+    ASSERT_TRUE(BuildPackedVertices(mesh.get(), aiPackedVertexStream_Positions));
+    EXPECT_EQ(8u, mesh->mPackedLayout.mStride);
+    EXPECT_EQ(AI_PACKED_VERTEX_NONE, mesh->mPackedLayout.mNormalOffset);
+    EXPECT_FALSE(mesh->HasPositions());
+    ASSERT_TRUE(mesh->HasNormals());
+    EXPECT_EQ(normal, GetVertexNormal(mesh.get(), 3));
+
+    // nothing to pack
+    std::unique_ptr<aiMesh> colorless(makeMesh(10));
+    delete[] colorless->mColors[0];
+    colorless->mColors[0] = nullptr;
+    EXPECT_FALSE(BuildPackedVertices(colorless.get(), aiPackedVertexStream_Colors));
+    EXPECT_FALSE(colorless->HasPackedVertices());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utPackedVertices, halfTexCoords) {
+    std::unique_ptr<aiMesh> mesh(makeMesh(4));
+    mesh->mTextureCoords[0][0] = aiVector3D(0.5f, -3.0f, 0);
+    mesh->mTextureCoords[0][1] = aiVector3D(1000.0f, 0.0f, 0);
+    mesh->mTextureCoords[0][2] = aiVector3D(0.1f, 1.0e-6f, 0);
+
+    ASSERT_TRUE(BuildPackedVertices(mesh.get(), aiPackedVertexStream_HalfTexCoords));
+    EXPECT_EQ(static_cast<unsigned int>(aiPackedVertexStream_TexCoords | aiPackedVertexStream_HalfTexCoords), mesh->mPackedLayout.mStreams);
+    EXPECT_EQ(8u, mesh->mPackedLayout.mStride);
+    EXPECT_TRUE(mesh->HasPositions());
+
+    // exactly representable values survive unchanged
+    EXPECT_EQ(aiVector3D(0.5f, -3.0f, 0), GetVertexTextureCoords(mesh.get(), 0, 0));
+    EXPECT_EQ(aiVector3D(1000.0f, 0.0f, 0), GetVertexTextureCoords(mesh.get(), 0, 1));
+    const aiVector3D uv = GetVertexTextureCoords(mesh.get(), 0, 2);
+    EXPECT_NEAR(0.1, uv.x, 0.1 / 2048);
+    EXPECT_NEAR(1.0e-6, uv.y, 1.0e-7);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utPackedVertices, threeComponentTexCoordsStayFloat) {
+    std::unique_ptr<aiMesh> mesh(makeMesh(10));
+    mesh->mNumUVComponents[1] = 3;
+
+    ASSERT_TRUE(BuildPackedVertices(mesh.get(), aiPackedVertexStream_Positions | aiPackedVertexStream_TexCoords));
+    EXPECT_EQ(aiPackedVertexStream_Positions, mesh->mPackedLayout.mStreams);
+    EXPECT_TRUE(mesh->HasTextureCoords(0));
+    EXPECT_TRUE(mesh->HasTextureCoords(1));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utPackedVertices, importerPacksVertices) {
+    Assimp::Importer reference;
+    const aiScene* unpacked = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, unpacked);
+    aiMemoryInfo unpackedMem;
+    reference.GetMemoryRequirements(unpackedMem);
+
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_PACK_VERTICES, AllStreams);
+    const aiScene* scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(unpacked->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh* mesh = scene->mMeshes[i];
+        EXPECT_TRUE(mesh->HasPackedVertices());
+        EXPECT_FALSE(mesh->HasPositions());
+    }
+
+    aiMemoryInfo mem;
+    importer.GetMemoryRequirements(mem);
+    EXPECT_LT(mem.meshes, unpackedMem.meshes);
+
+    const aiMesh* mesh = scene->mMeshes[0];
+    const aiVector3D& scale = mesh->mPackedLayout.mPositionScale;
+    const aiVector3D p = GetVertexPosition(mesh, 5);
+    EXPECT_NEAR(unpacked->mMeshes[0]->mVertices[5].x, p.x, scale.x);
+    EXPECT_NEAR(unpacked->mMeshes[0]->mVertices[5].y, p.y, scale.y);
+    EXPECT_NEAR(unpacked->mMeshes[0]->mVertices[5].z, p.z, scale.z);
+
+    // further post-processing sees the arrays, the result is packed again
+    scene = importer.ApplyPostProcessing(aiProcess_MakeLeftHanded | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_TRUE(scene->mMeshes[0]->HasPackedVertices());
+    EXPECT_NEAR(-p.z, GetVertexPosition(scene->mMeshes[0], 5).z, scene->mMeshes[0]->mPackedLayout.mPositionScale.z);
+}
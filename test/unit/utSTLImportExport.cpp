@@ -50,6 +50,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/scene.h>
 
+#include <fstream>
+#include <iterator>
 #include <vector>
 
 using namespace Assimp;
@@ -172,3 +174,26 @@ TEST_F(utSTLImporterExporter, test_export_pointclouds) {
 }
 
 #endif
+
+// Binary files are streamed from disk in blocks and read in place from memory,
+// both must yield the same mesh
+TEST_F(utSTLImporterExporter, binaryStreamMatchesMappedBuffer) {
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", std::ios::binary);
+    const std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(content.empty());
+
+    Assimp::Importer streamed, mapped;
+    const aiScene *scene = streamed.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    const aiScene *expected = mapped.ReadFileFromMemory(&content[0], content.size(), aiProcess_ValidateDataStructure, "stl");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, expected);
+
+    const aiMesh *mesh = scene->mMeshes[0];
+    const aiMesh *expectedMesh = expected->mMeshes[0];
+    ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+    ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        EXPECT_EQ(expectedMesh->mVertices[i], mesh->mVertices[i]);
+        EXPECT_EQ(expectedMesh->mNormals[i], mesh->mNormals[i]);
+    }
+}
@@ -0,0 +1,325 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "MemoryArena.h"
+#include "SceneArena.h"
+
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/IndexBuffer.h>
+#include <assimp/PackedVertices.h>
+#include <assimp/SceneCombiner.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utSceneArena : public ::testing::Test {
+protected:
+    // a scene using every kind of array that is moved into the arena
+    static aiScene* makeScene() {
+        aiScene* scene = new aiScene();
+        aiMesh* mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = 6;
+        mesh->mVertices = new aiVector3D[6];
+        mesh->mNormals = new aiVector3D[6];
+        mesh->mTextureCoords[0] = new aiVector3D[6];
+        mesh->mNumUVComponents[0] = 2;
+        for (unsigned int i = 0; i < 6; ++i) {
+            mesh->mVertices[i] = aiVector3D(float(i), float(i * 2), float(i * 3));
+            mesh->mNormals[i] = aiVector3D(0.f, 0.f, 1.f);
+            mesh->mTextureCoords[0][i] = aiVector3D(float(i) / 6.f, 0.f, 0.f);
+        }
+        mesh->mNumFaces = 2;
+        mesh->mFaces = new aiFace[2];
+        for (unsigned int f = 0; f < 2; ++f) {
+            mesh->mFaces[f].mNumIndices = 3;
+            mesh->mFaces[f].mIndices = new unsigned int[3];
+            for (unsigned int i = 0; i < 3; ++i) {
+                mesh->mFaces[f].mIndices[i] = f * 3 + i;
+            }
+        }
+        mesh->mNumBones = 1;
+        mesh->mBones = new aiBone*[1];
+        mesh->mBones[0] = new aiBone();
+        mesh->mBones[0]->mName.Set("bone");
+        mesh->mBones[0]->mNumWeights = 2;
+        mesh->mBones[0]->mWeights = new aiVertexWeight[2];
+        mesh->mBones[0]->mWeights[0] = aiVertexWeight(0, 1.f);
+        mesh->mBones[0]->mWeights[1] = aiVertexWeight(4, .5f);
+
+        scene->mNumMeshes = 1;
+        scene->mMeshes = new aiMesh*[1];
+        scene->mMeshes[0] = mesh;
+
+        scene->mNumMaterials = 1;
+        scene->mMaterials = new aiMaterial*[1];
+        scene->mMaterials[0] = new aiMaterial();
+        const aiColor3D diffuse(.25f, .5f, .75f);
+        scene->mMaterials[0]->AddProperty(&diffuse, 1, AI_MATKEY_COLOR_DIFFUSE);
+
+        scene->mRootNode = new aiNode("root");
+        aiNode* child = new aiNode("bone");
+        scene->mRootNode->addChildren(1, &child);
+        child->mNumMeshes = 1;
+        child->mMeshes = new unsigned int[1];
+        child->mMeshes[0] = 0;
+
+        scene->mNumAnimations = 1;
+        scene->mAnimations = new aiAnimation*[1];
+        aiAnimation* anim = scene->mAnimations[0] = new aiAnimation();
+        anim->mNumChannels = 1;
+        anim->mChannels = new aiNodeAnim*[1];
+        aiNodeAnim* channel = anim->mChannels[0] = new aiNodeAnim();
+        channel->mNodeName.Set("bone");
+        channel->mNumPositionKeys = 2;
+        channel->mPositionKeys = new aiVectorKey[2];
+        channel->mPositionKeys[1] = aiVectorKey(1.0, aiVector3D(1.f, 2.f, 3.f));
+        return scene;
+    }
+
+    static void expectSameScene(const aiScene* a, const aiScene* b) {
+        const aiMesh* ma = a->mMeshes[0];
+        const aiMesh* mb = b->mMeshes[0];
+        ASSERT_EQ(ma->mNumVertices, mb->mNumVertices);
+        for (unsigned int i = 0; i < ma->mNumVertices; ++i) {
+            EXPECT_EQ(ma->mVertices[i], mb->mVertices[i]);
+            EXPECT_EQ(ma->mNormals[i], mb->mNormals[i]);
+            EXPECT_EQ(ma->mTextureCoords[0][i], mb->mTextureCoords[0][i]);
+        }
+        ASSERT_EQ(ma->mNumFaces, mb->mNumFaces);
+        for (unsigned int f = 0; f < ma->mNumFaces; ++f) {
+            ASSERT_EQ(ma->mFaces[f].mNumIndices, mb->mFaces[f].mNumIndices);
+            for (unsigned int i = 0; i < ma->mFaces[f].mNumIndices; ++i) {
+                EXPECT_EQ(ma->mFaces[f].mIndices[i], mb->mFaces[f].mIndices[i]);
+            }
+        }
+        EXPECT_EQ(4u, mb->mBones[0]->mWeights[1].mVertexId);
+        EXPECT_EQ(.5f, mb->mBones[0]->mWeights[1].mWeight);
+
+        aiColor3D diffuse;
+        EXPECT_EQ(aiReturn_SUCCESS, b->mMaterials[0]->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse));
+        EXPECT_EQ(aiColor3D(.25f, .5f, .75f), diffuse);
+
+        EXPECT_EQ(0u, b->mRootNode->mChildren[0]->mMeshes[0]);
+        EXPECT_EQ(aiVector3D(1.f, 2.f, 3.f), b->mAnimations[0]->mChannels[0]->mPositionKeys[1].mValue);
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, arenaAllocatesAlignedStorageFromFewBlocks) {
+    MemoryArena arena(256);
+    EXPECT_EQ(0u, arena.GetNumBlocks());
+
+    char* c = arena.AllocateArray<char>(3);
+    double* d = arena.AllocateArray<double>(4);
+    EXPECT_EQ(0u, reinterpret_cast<size_t>(d) % alignof(double));
+    EXPECT_TRUE(arena.Contains(c));
+    EXPECT_TRUE(arena.Contains(d + 3));
+    EXPECT_EQ(1u, arena.GetNumBlocks());
+
+    int onStack = 0;
+    EXPECT_FALSE(arena.Contains(&onStack));
+
+    // oversized requests get a block of their own
+    arena.Allocate(1000);
+    EXPECT_EQ(2u, arena.GetNumBlocks());
+    EXPECT_GE(arena.GetCapacity(), 1256u);
+
+    arena.Reserve(100);
+    const size_t blocks = arena.GetNumBlocks();
+    for (unsigned int i = 0; i < 10; ++i) {
+        arena.Allocate(10, 1);
+    }
+    EXPECT_EQ(blocks, arena.GetNumBlocks());
+
+    arena.Clear();
+    EXPECT_EQ(0u, arena.GetNumBlocks());
+    EXPECT_EQ(0u, arena.GetBytesUsed());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, moveToArenaKeepsSceneContents) {
+    std::unique_ptr<aiScene> reference(makeScene());
+    std::unique_ptr<aiScene> scene(makeScene());
+    EXPECT_EQ(nullptr, GetSceneArena(scene.get()));
+
+    MoveSceneToArena(scene.get());
+    const MemoryArena* arena = GetSceneArena(scene.get());
+    ASSERT_NE(nullptr, arena);
+    EXPECT_EQ(1u, arena->GetNumBlocks());
+    EXPECT_TRUE(arena->Contains(scene->mMeshes[0]->mVertices));
+    EXPECT_TRUE(arena->Contains(scene->mMeshes[0]->mFaces));
+    EXPECT_TRUE(arena->Contains(scene->mMeshes[0]->mFaces[1].mIndices));
+    EXPECT_TRUE(arena->Contains(scene->mMaterials[0]->mProperties[0]->mData));
+    expectSameScene(reference.get(), scene.get());
+
+    // nothing left to move
+    const size_t used = arena->GetBytesUsed();
+    MoveSceneToArena(scene.get());
+    EXPECT_EQ(used, arena->GetBytesUsed());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, moveFromArenaRestoresHeapArrays) {
+    std::unique_ptr<aiScene> reference(makeScene());
+    std::unique_ptr<aiScene> scene(makeScene());
+    MoveSceneToArena(scene.get());
+    MoveSceneFromArena(scene.get());
+    EXPECT_EQ(nullptr, GetSceneArena(scene.get()));
+    expectSameScene(reference.get(), scene.get());
+
+    // the arrays are owned by the scene's objects again
+    aiMesh* mesh = scene->mMeshes[0];
+    delete[] mesh->mNormals;
+    mesh->mNormals = nullptr;
+    delete[] mesh->mFaces;
+    mesh->mFaces = nullptr;
+    mesh->mNumFaces = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, arraysAddedAfterCompactionAreFreed) {
+    std::unique_ptr<aiScene> scene(makeScene());
+    MoveSceneToArena(scene.get());
+
+    // heap arrays inside an arena face array must still be deleted
+    aiFace& face = scene->mMeshes[0]->mFaces[0];
+    face.mIndices = new unsigned int[3];
+    face.mIndices[0] = 2;
+    face.mIndices[1] = 1;
+    face.mIndices[2] = 0;
+    scene->mMeshes[0]->mColors[0] = new aiColor4D[6];
+    EXPECT_FALSE(GetSceneArena(scene.get())->Contains(face.mIndices));
+
+    // moved on request only
+    MoveSceneToArena(scene.get());
+    EXPECT_TRUE(GetSceneArena(scene.get())->Contains(face.mIndices));
+    EXPECT_TRUE(GetSceneArena(scene.get())->Contains(scene->mMeshes[0]->mColors[0]));
+
+    face.mIndices = new unsigned int[1];
+    face.mIndices[0] = 0;
+    face.mNumIndices = 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, copyOfArenaSceneUsesHeap) {
+    std::unique_ptr<aiScene> scene(makeScene());
+    MoveSceneToArena(scene.get());
+
+    aiScene* copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene.get());
+    ASSERT_NE(nullptr, copy);
+    EXPECT_EQ(nullptr, GetSceneArena(copy));
+    expectSameScene(scene.get(), copy);
+    delete copy;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, importerStoresSceneInArena) {
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    const aiScene* scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate);
+    ASSERT_NE(nullptr, scene);
+    const MemoryArena* arena = GetSceneArena(scene);
+    ASSERT_NE(nullptr, arena);
+    EXPECT_EQ(1u, arena->GetNumBlocks());
+    EXPECT_TRUE(arena->Contains(scene->mMeshes[0]->mFaces[0].mIndices));
+
+    // further post-processing works on heap arrays and compacts the result again
+    scene = importer.ApplyPostProcessing(aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals |
+        aiProcess_JoinIdenticalVertices | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene) << importer.GetErrorString();
+    arena = GetSceneArena(scene);
+    ASSERT_NE(nullptr, arena);
+    EXPECT_TRUE(arena->Contains(scene->mMeshes[0]->mNormals));
+
+    // the arena is off by default
+    Assimp::Importer plain;
+    scene = plain.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(nullptr, GetSceneArena(scene));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneArena, compactStorageIsArenaBackedAndCopiedClassic) {
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_INDEX_BUFFER, 16);
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_PACK_VERTICES, aiPackedVertexStream_Positions);
+    const aiScene* scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    const MemoryArena* arena = GetSceneArena(scene);
+    ASSERT_NE(nullptr, arena);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh* mesh = scene->mMeshes[i];
+        ASSERT_TRUE(mesh->HasIndexBuffer());
+        ASSERT_TRUE(mesh->HasPackedVertices());
+        EXPECT_TRUE(arena->Contains(mesh->mIndexBuffer));
+        EXPECT_TRUE(arena->Contains(mesh->mPackedVertices));
+    }
+
+    // copies use the classic layout
+    aiScene* copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_EQ(nullptr, GetSceneArena(copy));
+    const aiMesh* mesh = copy->mMeshes[0];
+    EXPECT_FALSE(mesh->HasIndexBuffer());
+    EXPECT_FALSE(mesh->HasPackedVertices());
+    ASSERT_TRUE(mesh->HasFaces());
+    ASSERT_TRUE(mesh->HasPositions());
+    const unsigned short* indices = static_cast<const unsigned short*>(scene->mMeshes[0]->mIndexBuffer);
+    EXPECT_EQ(indices[5], mesh->mFaces[1].mIndices[2]);
+    EXPECT_EQ(GetVertexPosition(scene->mMeshes[0], 5), mesh->mVertices[5]);
+    delete copy;
+
+    // as does the exporter
+    Assimp::Exporter exporter;
+    EXPECT_NE(nullptr, exporter.ExportToBlob(scene, "obj"));
+}
@@ -0,0 +1,187 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/SpatialSort.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace Assimp;
+
+class utSpatialSort : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // a flat, axis-aligned grid of points with each position duplicated, plus
+        // some noise on top - the worst case for the plane sort
+        std::mt19937 rng( 42 );
+        std::uniform_real_distribution<float> dist( 0.f, 1.f );
+        for ( unsigned int y = 0; y < 40; ++y ) {
+            for ( unsigned int x = 0; x < 40; ++x ) {
+                const aiVector3D p( x * 0.25f, y * 0.25f, 0.f );
+                mPositions.push_back( p );
+                mPositions.push_back( p );
+            }
+        }
+        for ( unsigned int i = 0; i < 500; ++i ) {
+            mPositions.push_back( aiVector3D( dist( rng ) * 10.f, dist( rng ) * 10.f, dist( rng ) ) );
+        }
+    }
+
+    static std::vector<unsigned int> sorted( std::vector<unsigned int> v ) {
+        std::sort( v.begin(), v.end() );
+        return v;
+    }
+
+    std::vector<aiVector3D> mPositions;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utSpatialSort, backendSelectionTest ) {
+    SpatialSort sort;
+    EXPECT_EQ( SpatialSort::Backend_PlaneSort, sort.GetBackend() );
+    sort.Fill( &mPositions[ 0 ], static_cast<unsigned int>( mPositions.size() ), sizeof( aiVector3D ) );
+    EXPECT_FALSE( sort.IsGridActive() );
+
+    sort.SetBackend( SpatialSort::Backend_Auto );
+    sort.Finalize();
+    EXPECT_TRUE( sort.IsGridActive() );
+
+    // small inputs stay with the plane sort
+    sort.Fill( &mPositions[ 0 ], 100, sizeof( aiVector3D ) );
+    EXPECT_FALSE( sort.IsGridActive() );
+
+    sort.SetBackend( SpatialSort::Backend_Grid );
+    sort.Fill( &mPositions[ 0 ], 100, sizeof( aiVector3D ) );
+    EXPECT_TRUE( sort.IsGridActive() );
+
+    sort.SetBackend( SpatialSort::Backend_PlaneSort );
+    sort.Finalize();
+    EXPECT_FALSE( sort.IsGridActive() );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utSpatialSort, gridMatchesPlaneSortTest ) {
+    const unsigned int num = static_cast<unsigned int>( mPositions.size() );
+    SpatialSort plane, grid;
+    plane.SetBackend( SpatialSort::Backend_PlaneSort );
+    grid.SetBackend( SpatialSort::Backend_Grid );
+    plane.Fill( &mPositions[ 0 ], num, sizeof( aiVector3D ) );
+    grid.Fill( &mPositions[ 0 ], num, sizeof( aiVector3D ) );
+    ASSERT_TRUE( grid.IsGridActive() );
+
+    std::vector<unsigned int> expected, found;
+    const ai_real radii[] = { ai_real( 1e-4 ), ai_real( 0.3 ), ai_real( 2.0 ), ai_real( 100.0 ) };
+    for ( unsigned int i = 0; i < num; i += 13 ) {
+        for ( ai_real radius : radii ) {
+            plane.FindPositions( mPositions[ i ], radius, expected );
+            grid.FindPositions( mPositions[ i ], radius, found );
+            ASSERT_EQ( sorted( expected ), sorted( found ) );
+        }
+        plane.FindIdenticalPositions( mPositions[ i ], expected );
+        grid.FindIdenticalPositions( mPositions[ i ], found );
+        ASSERT_EQ( sorted( expected ), sorted( found ) );
+    }
+
+    // query positions outside of the grid
+    grid.FindPositions( aiVector3D( -5.f, 3.f, 0.f ), ai_real( 5.1 ), found );
+    plane.FindPositions( aiVector3D( -5.f, 3.f, 0.f ), ai_real( 5.1 ), expected );
+    EXPECT_FALSE( found.empty() );
+    EXPECT_EQ( sorted( expected ), sorted( found ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utSpatialSort, gridMappingTableTest ) {
+    SpatialSort grid;
+    grid.SetBackend( SpatialSort::Backend_Grid );
+    grid.Fill( &mPositions[ 0 ], 3200, sizeof( aiVector3D ) );
+
+    std::vector<unsigned int> table;
+    EXPECT_EQ( 1600u, grid.GenerateMappingTable( table, ai_real( 1e-3 ) ) );
+    ASSERT_EQ( 3200u, table.size() );
+    for ( unsigned int i = 0; i < 3200; i += 2 ) {
+        EXPECT_EQ( table[ i ], table[ i + 1 ] );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utSpatialSort, degenerateGridTest ) {
+    // all positions identical, the grid collapses to a single cell
+    std::vector<aiVector3D> same( 50, aiVector3D( 1.f, 2.f, 3.f ) );
+    SpatialSort grid;
+    grid.SetBackend( SpatialSort::Backend_Grid );
+    grid.Fill( &same[ 0 ], 50, sizeof( aiVector3D ) );
+
+    std::vector<unsigned int> found;
+    grid.FindIdenticalPositions( same[ 0 ], found );
+    EXPECT_EQ( 50u, found.size() );
+    grid.FindPositions( aiVector3D( 1.f, 2.f, 4.f ), ai_real( 0.5 ), found );
+    EXPECT_TRUE( found.empty() );
+
+    grid.Fill( &same[ 0 ], 0, sizeof( aiVector3D ) );
+    grid.FindPositions( same[ 0 ], ai_real( 1.0 ), found );
+    EXPECT_TRUE( found.empty() );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utSpatialSort, importWithGridTest ) {
+    const unsigned int flags = aiProcess_JoinIdenticalVertices | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace;
+
+    Importer reference;
+    reference.SetPropertyInteger( AI_CONFIG_PP_SPATIAL_SORT_BACKEND, SpatialSort::Backend_PlaneSort );
+    const aiScene *expected = reference.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags );
+    ASSERT_NE( nullptr, expected );
+
+    Importer importer;
+    importer.SetPropertyInteger( AI_CONFIG_PP_SPATIAL_SORT_BACKEND, SpatialSort::Backend_Grid );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags );
+    ASSERT_NE( nullptr, scene );
+
+    ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+    for ( unsigned int i = 0; i < scene->mNumMeshes; ++i ) {
+        EXPECT_EQ( expected->mMeshes[ i ]->mNumVertices, scene->mMeshes[ i ]->mNumVertices );
+    }
+}
@@ -0,0 +1,133 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <ThreadPool.h>
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace Assimp;
+
+class utThreadPool : public ::testing::Test {
+    // empty
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utThreadPool, parallelForVisitsEachIndexOnceTest ) {
+    ThreadPool pool( 4 );
+    EXPECT_EQ( 4u, pool.GetNumThreads() );
+
+    std::vector<std::atomic<unsigned int>> visits( 1000 );
+    for ( std::atomic<unsigned int> &v : visits ) {
+        v = 0;
+    }
+
+    // run more than one batch to make sure the workers pick up new work
+    for ( unsigned int batch = 0; batch < 3; ++batch ) {
+        pool.ParallelFor( static_cast<unsigned int>( visits.size() ), [&]( unsigned int i ) {
+            ++visits[ i ];
+        } );
+    }
+    for ( std::atomic<unsigned int> &v : visits ) {
+        EXPECT_EQ( 3u, v.load() );
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utThreadPool, parallelForPropagatesExceptionTest ) {
+    ThreadPool pool( 3 );
+    EXPECT_THROW( pool.ParallelFor( 100, []( unsigned int i ) {
+        if ( 42 == i ) {
+            throw std::runtime_error( "failure" );
+        }
+    } ), std::runtime_error );
+
+    // the pool must still be usable afterwards
+    std::atomic<unsigned int> count( 0 );
+    pool.ParallelFor( 10, [&]( unsigned int ) { ++count; } );
+    EXPECT_EQ( 10u, count.load() );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utThreadPool, resolveThreadCountTest ) {
+    EXPECT_EQ( 7u, ThreadPool::ResolveThreadCount( 7 ) );
+    EXPECT_LE( 1u, ThreadPool::ResolveThreadCount( 0 ) );
+    EXPECT_LE( 1u, ThreadPool::ResolveThreadCount( -1 ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F( utThreadPool, parallelPostProcessingMatchesSerialTest ) {
+    const unsigned int flags = aiProcessPreset_TargetRealtime_MaxQuality;
+
+    Importer serial;
+    const aiScene *expected = serial.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags );
+    ASSERT_NE( nullptr, expected );
+
+    Importer parallel;
+    parallel.SetPropertyInteger( AI_CONFIG_PP_NUM_THREADS, 4 );
+    const aiScene *actual = parallel.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags );
+    ASSERT_NE( nullptr, actual );
+
+    ASSERT_EQ( expected->mNumMeshes, actual->mNumMeshes );
+    for ( unsigned int i = 0; i < expected->mNumMeshes; ++i ) {
+        const aiMesh *e = expected->mMeshes[ i ];
+        const aiMesh *a = actual->mMeshes[ i ];
+        ASSERT_EQ( e->mNumVertices, a->mNumVertices );
+        ASSERT_EQ( e->mNumFaces, a->mNumFaces );
+        ASSERT_EQ( e->HasTangentsAndBitangents(), a->HasTangentsAndBitangents() );
+        for ( unsigned int v = 0; v < e->mNumVertices; ++v ) {
+            EXPECT_EQ( e->mVertices[ v ], a->mVertices[ v ] );
+            EXPECT_EQ( e->mNormals[ v ], a->mNormals[ v ] );
+        }
+        for ( unsigned int f = 0; f < e->mNumFaces; ++f ) {
+            ASSERT_EQ( e->mFaces[ f ].mNumIndices, a->mFaces[ f ].mNumIndices );
+            for ( unsigned int n = 0; n < e->mFaces[ f ].mNumIndices; ++n ) {
+                EXPECT_EQ( e->mFaces[ f ].mIndices[ n ], a->mFaces[ f ].mIndices[ n ] );
+            }
+        }
+    }
+}
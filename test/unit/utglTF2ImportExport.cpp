@@ -382,6 +382,58 @@ TEST_F( utglTF2ImportExport, bug_import_simple_skin ) {
     EXPECT_NE( nullptr, scene );
 }
 
+TEST_F( utglTF2ImportExport, simpleSkinWeightsSumToOne ) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/simple_skin.gltf", aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( 1u, scene->mNumMeshes );
+
+    const aiMesh *mesh = scene->mMeshes[ 0 ];
+    ASSERT_EQ( 2u, mesh->mNumBones );
+
+    std::vector<float> sums( mesh->mNumVertices, 0.f );
+    for ( unsigned int b = 0; b < mesh->mNumBones; ++b ) {
+        for ( unsigned int w = 0; w < mesh->mBones[ b ]->mNumWeights; ++w ) {
+            const aiVertexWeight &weight = mesh->mBones[ b ]->mWeights[ w ];
+            ASSERT_LT( weight.mVertexId, mesh->mNumVertices );
+            sums[ weight.mVertexId ] += weight.mWeight;
+        }
+    }
+    for ( float sum : sums ) {
+        EXPECT_NEAR( 1.f, sum, 1e-5f );
+    }
+}
+
+TEST_F( utglTF2ImportExport, embeddedBuffersMatchExternalBuffers ) {
+    Assimp::Importer importer;
+    const aiScene *expected = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, expected );
+    ASSERT_EQ( 1u, expected->mNumMeshes );
+
+    // texture coordinates are flipped to assimp's convention
+    const aiMesh *mesh = expected->mMeshes[ 0 ];
+    ASSERT_NE( nullptr, mesh->mTextureCoords[ 0 ] );
+    EXPECT_EQ( 2u, mesh->mNumUVComponents[ 0 ] );
+    for ( unsigned int i = 0; i < mesh->mNumVertices; ++i ) {
+        EXPECT_LE( 0.f, mesh->mTextureCoords[ 0 ][ i ].y );
+        EXPECT_GE( 1.f, mesh->mTextureCoords[ 0 ][ i ].y );
+        EXPECT_EQ( 0.f, mesh->mTextureCoords[ 0 ][ i ].z );
+    }
+
+    Assimp::Importer other;
+    const aiScene *scene = other.ReadFile( ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Embedded/BoxTextured.gltf", aiProcess_ValidateDataStructure );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_EQ( 1u, scene->mNumMeshes );
+
+    const aiMesh *otherMesh = scene->mMeshes[ 0 ];
+    ASSERT_EQ( mesh->mNumVertices, otherMesh->mNumVertices );
+    for ( unsigned int i = 0; i < mesh->mNumVertices; ++i ) {
+        EXPECT_EQ( mesh->mVertices[ i ], otherMesh->mVertices[ i ] );
+        EXPECT_EQ( mesh->mNormals[ i ], otherMesh->mNormals[ i ] );
+        EXPECT_EQ( mesh->mTextureCoords[ 0 ][ i ], otherMesh->mTextureCoords[ 0 ][ i ] );
+    }
+}
+
 #ifndef ASSIMP_BUILD_NO_EXPORT
 TEST_F( utglTF2ImportExport, exportglTF2FromFileTest ) {
     EXPECT_TRUE( exporterTest() );
@@ -0,0 +1,249 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Harness.cpp
+ *  @brief Implementation of the benchmark runner and the result writers
+ */
+
+#include "Harness.h"
+
+#include <assimp/version.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <exception>
+#include <iomanip>
+
+namespace AssimpBench {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+void Call(const std::function<void()>& fn) {
+    if (fn) {
+        fn();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+double TimeIteration(const Benchmark& bench) {
+    Call(bench.setUp);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bench.run();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    Call(bench.tearDown);
+    return elapsed.count();
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string JsonEscape(const std::string& in) {
+    std::string out;
+    out.reserve(in.size());
+    for (char c : in) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string CsvEscape(const std::string& in) {
+    if (in.find_first_of(",\"\n") == std::string::npos) {
+        return in;
+    }
+    std::string out = "\"";
+    for (char c : in) {
+        if (c == '"') {
+            out += '"';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+// ------------------------------------------------------------------------------------------------
+double ItemsPerSecond(const Result& result) {
+    return result.items && result.median > 0.0 ? result.items / result.median : 0.0;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string Timestamp() {
+    char buffer[64];
+    const time_t now = time(NULL);
+    strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    return buffer;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+Result RunBenchmark(const Benchmark& bench, const Options& options) {
+    Result result;
+    result.name = bench.name;
+    result.iterations = 0;
+    result.min = result.median = result.mean = result.stddev = 0.0;
+    result.items = bench.items;
+
+    std::vector<double> times;
+    try {
+        // warm up caches and lazily initialized state
+        TimeIteration(bench);
+
+        double total = 0.0;
+        while (times.size() < options.maxIterations &&
+                (times.size() < options.minIterations || total < options.minTime)) {
+            times.push_back(TimeIteration(bench));
+            total += times.back();
+        }
+    } catch (const std::exception& e) {
+        result.error = e.what();
+        return result;
+    } catch (...) {
+        result.error = "unknown exception";
+        return result;
+    }
+
+    if (times.empty()) {
+        return result;
+    }
+
+    result.iterations = static_cast<unsigned int>(times.size());
+    std::sort(times.begin(), times.end());
+    result.min = times.front();
+    const size_t mid = times.size() / 2;
+    result.median = times.size() % 2 ? times[mid] : (times[mid - 1] + times[mid]) * 0.5;
+
+    double sum = 0.0;
+    for (double t : times) {
+        sum += t;
+    }
+    result.mean = sum / times.size();
+
+    double variance = 0.0;
+    for (double t : times) {
+        variance += (t - result.mean) * (t - result.mean);
+    }
+    result.stddev = times.size() > 1 ? std::sqrt(variance / (times.size() - 1)) : 0.0;
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteConsoleLine(std::ostream& out, const Result& result) {
+    out << std::left << std::setw(60) << result.name << std::right;
+    if (!result.error.empty()) {
+        out << "  FAILED: " << result.error << "\n";
+        return;
+    }
+    out << std::fixed << std::setprecision(3)
+        << std::setw(12) << result.median * 1e3 << " ms"
+        << std::setw(12) << result.min * 1e3 << " ms"
+        << std::setw(8) << result.iterations;
+    if (result.items) {
+        out << std::setw(14) << std::setprecision(2) << ItemsPerSecond(result) / 1e6 << " M/s";
+    }
+    out << "\n";
+    out.unsetf(std::ios_base::floatfield);
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteResults(std::ostream& out, Format format, const Options& options,
+        const std::vector<Result>& results) {
+    switch (format) {
+    case Format_Console:
+        out << std::left << std::setw(60) << "benchmark" << std::right
+            << std::setw(15) << "median" << std::setw(15) << "min"
+            << std::setw(8) << "iters" << std::setw(18) << "items/s" << "\n";
+        for (const Result& result : results) {
+            WriteConsoleLine(out, result);
+        }
+        break;
+
+    case Format_Json:
+        out << std::setprecision(9);
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << Timestamp() << "\",\n"
+            << "    \"assimp_version\": \"" << aiGetVersionMajor() << "." << aiGetVersionMinor() << "\",\n"
+            << "    \"assimp_revision\": \"" << std::hex << aiGetVersionRevision() << std::dec << "\",\n"
+            << "    \"min_time\": " << options.minTime << ",\n"
+            << "    \"min_iterations\": " << options.minIterations << ",\n"
+            << "    \"max_iterations\": " << options.maxIterations << "\n"
+            << "  },\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << (i ? ",\n" : "\n") << "    {\"name\": \"" << JsonEscape(r.name) << "\"";
+            if (!r.error.empty()) {
+                out << ", \"error\": \"" << JsonEscape(r.error) << "\"}";
+                continue;
+            }
+            out << ", \"iterations\": " << r.iterations
+                << ", \"min_s\": " << r.min
+                << ", \"median_s\": " << r.median
+                << ", \"mean_s\": " << r.mean
+                << ", \"stddev_s\": " << r.stddev
+                << ", \"items\": " << r.items
+                << ", \"items_per_second\": " << ItemsPerSecond(r) << "}";
+        }
+        out << "\n  ]\n}\n";
+        break;
+
+    case Format_Csv:
+        out << std::setprecision(9);
+        out << "name,iterations,min_s,median_s,mean_s,stddev_s,items,items_per_second,error\n";
+        for (const Result& r : results) {
+            out << CsvEscape(r.name) << "," << r.iterations << "," << r.min << "," << r.median
+                << "," << r.mean << "," << r.stddev << "," << r.items << "," << ItemsPerSecond(r)
+                << "," << CsvEscape(r.error) << "\n";
+        }
+        break;
+    }
+}
+
+} // namespace AssimpBench
@@ -0,0 +1,127 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  Harness.h
+ *  @brief Minimal micro-benchmark harness used by assimp_bench
+ */
+
+#ifndef AIBENCH_HARNESS_INCLUDED
+#define AIBENCH_HARNESS_INCLUDED
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace AssimpBench {
+
+// ------------------------------------------------------------------------------------------------
+/** A single benchmark. setUp and tearDown run before and after each
+ *  iteration and are not timed, run is. Both may be empty. */
+struct Benchmark {
+    std::string name;
+    std::function<void()> setUp;
+    std::function<void()> run;
+    std::function<void()> tearDown;
+
+    /** Number of items (e.g. vertices) processed per iteration, 0 if not applicable */
+    unsigned long long items;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Measured timings of a benchmark, all in seconds */
+struct Result {
+    std::string name;
+    unsigned int iterations;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    unsigned long long items;
+
+    /** Non-empty if an iteration has failed, the timings are invalid then */
+    std::string error;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Options controlling how long each benchmark is run */
+struct Options {
+    Options()
+    : minTime(0.5)
+    , minIterations(3)
+    , maxIterations(1000) {
+        // empty
+    }
+
+    /** Each benchmark runs until its timed iterations add up to this many seconds ... */
+    double minTime;
+
+    /** ... but at least and at most this many iterations */
+    unsigned int minIterations;
+    unsigned int maxIterations;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Runs a benchmark: one untimed warm-up iteration, then timed iterations as
+ *  configured. Exceptions thrown by the benchmark are reported in Result::error. */
+Result RunBenchmark(const Benchmark& bench, const Options& options);
+
+// ------------------------------------------------------------------------------------------------
+/** Output formats for WriteResults() */
+enum Format {
+    Format_Console,
+    Format_Json,
+    Format_Csv
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Writes a single result as a line of the console table, for progress output */
+void WriteConsoleLine(std::ostream& out, const Result& result);
+
+// ------------------------------------------------------------------------------------------------
+/** Writes all results in the given format. */
+void WriteResults(std::ostream& out, Format format, const Options& options,
+    const std::vector<Result>& results);
+
+} // namespace AssimpBench
+
+#endif // AIBENCH_HARNESS_INCLUDED
@@ -0,0 +1,417 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Main.cpp
+ *  @brief main() function of assimp_bench
+ *
+ *  Times each importer on the files of the test model corpus and each
+ *  post-processing step on synthetic meshes of increasing size.
+ */
+
+#include "Harness.h"
+#include "Scenes.h"
+
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Subdivision.h>
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <dirent.h>
+#   include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace AssimpBench;
+
+#ifndef ASSIMP_BENCH_MODELS_DIR
+#   define ASSIMP_BENCH_MODELS_DIR "test/models"
+#endif
+
+static const char* AIBENCH_MSG_HELP =
+"assimp_bench [options] [files ...]\n\n"
+" Times the importers on the test model corpus and the post-processing\n"
+" steps on synthetic meshes. Additional model files may be given.\n\n"
+" options:\n"
+"  --filter=<text>       Run only benchmarks whose name contains <text>\n"
+"  --format=<fmt>        Output format: console (default), json or csv\n"
+"  --out=<file>          Write the results to <file> instead of stdout\n"
+"  --min-time=<s>        Minimal accumulated time per benchmark (default: 0.5)\n"
+"  --min-iterations=<n>  Minimal number of iterations (default: 3)\n"
+"  --max-iterations=<n>  Maximal number of iterations (default: 1000)\n"
+"  --models=<dir>        Model corpus (default: " ASSIMP_BENCH_MODELS_DIR ")\n"
+"  --no-corpus           Don't benchmark the files of the model corpus\n"
+"  --large               Add the largest synthetic meshes (~1M vertices)\n"
+"  --list                Print the names of the benchmarks and exit\n"
+"  --help                Print this text\n\n"
+" The exit code is nonzero if any benchmark failed.\n";
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Collects all files below a directory, as paths relative to it. Directories
+// holding deliberately broken files are skipped.
+void CollectFiles(const std::string& root, const std::string& rel, std::vector<std::string>& out) {
+    const std::string dir = rel.empty() ? root : root + "/" + rel;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((dir + "/*").c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    do {
+        const std::string name = data.cFileName;
+        const bool isDir = 0 != (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+    DIR* handle = opendir(dir.c_str());
+    if (!handle) {
+        return;
+    }
+    while (const dirent* entry = readdir(handle)) {
+        const std::string name = entry->d_name;
+        struct stat st;
+        if (0 != stat((dir + "/" + name).c_str(), &st)) {
+            continue;
+        }
+        const bool isDir = S_ISDIR(st.st_mode);
+#endif
+        if (name.empty() || name[0] == '.') {
+            continue;
+        }
+        const std::string path = rel.empty() ? name : rel + "/" + name;
+        if (isDir) {
+            if (name != "invalid") {
+                CollectFiles(root, path, out);
+            }
+        } else {
+            out.push_back(path);
+        }
+#ifdef _WIN32
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    }
+    closedir(handle);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Times Importer::ReadFile() without any post-processing. Each iteration uses a
+// fresh Importer, some loaders keep state between reads.
+Benchmark MakeImportBenchmark(const std::string& name, const std::string& file) {
+    std::shared_ptr<std::unique_ptr<Assimp::Importer> > importer =
+        std::make_shared<std::unique_ptr<Assimp::Importer> >();
+
+    Benchmark bench;
+    bench.name = name;
+    bench.items = 0;
+    bench.setUp = [importer]() {
+        importer->reset(new Assimp::Importer());
+    };
+    bench.run = [importer, file]() {
+        if (!(*importer)->ReadFile(file, 0)) {
+            throw std::runtime_error((*importer)->GetErrorString());
+        }
+    };
+    bench.tearDown = [importer]() {
+        importer->reset();
+    };
+    return bench;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Serializes a synthetic scene so that an Importer can take a fresh copy of it
+// before each iteration
+std::shared_ptr<const aiExportDataBlob> MakeSceneBlob(const aiScene* scene) {
+    Assimp::Exporter exporter;
+    if (!exporter.ExportToBlob(scene, "assbin")) {
+        return std::shared_ptr<const aiExportDataBlob>();
+    }
+    return std::shared_ptr<const aiExportDataBlob>(exporter.GetOrphanedBlob());
+}
+
+// ------------------------------------------------------------------------------------------------
+// Times Importer::ApplyPostProcessing() on a copy of a synthetic scene. Steps in
+// 'prerequisites' are applied to the copy before the timer starts.
+Benchmark MakePostProcessBenchmark(const std::string& name, std::shared_ptr<const aiScene> prototype,
+        unsigned int flags, unsigned int prerequisites) {
+    std::shared_ptr<Assimp::Importer> importer = std::make_shared<Assimp::Importer>();
+    std::shared_ptr<const aiExportDataBlob> blob = MakeSceneBlob(prototype.get());
+
+    Benchmark bench;
+    bench.name = name;
+    bench.items = CountVertices(prototype.get());
+    bench.setUp = [importer, blob, prerequisites]() {
+        if (!blob) {
+            throw std::runtime_error("unable to serialize the scene");
+        }
+        if (!importer->ReadFileFromMemory(blob->data, blob->size, 0, "assbin")) {
+            throw std::runtime_error(importer->GetErrorString());
+        }
+        if (prerequisites && !importer->ApplyPostProcessing(prerequisites)) {
+            throw std::runtime_error(importer->GetErrorString());
+        }
+    };
+    bench.run = [importer, flags]() {
+        if (!importer->ApplyPostProcessing(flags)) {
+            throw std::runtime_error(importer->GetErrorString());
+        }
+    };
+    bench.tearDown = [importer]() {
+        importer->FreeScene();
+    };
+    return bench;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Times the Catmull-Clark subdivision of a cube
+Benchmark MakeSubdivisionBenchmark(const std::string& name, unsigned int levels) {
+    std::shared_ptr<aiScene> cube(MakeSubdividedCubeScene(0));
+    std::shared_ptr<aiMesh*> result = std::make_shared<aiMesh*>((aiMesh*)NULL);
+
+    Benchmark bench;
+    bench.name = name;
+    bench.items = 6 * 4u * (1u << (2 * levels));
+    bench.run = [cube, result, levels]() {
+        std::unique_ptr<Assimp::Subdivider> subdivider(Assimp::Subdivider::Create(Assimp::Subdivider::CATMULL_CLARKE));
+        subdivider->Subdivide(cube->mMeshes[0], *result, levels);
+    };
+    bench.tearDown = [result]() {
+        delete *result;
+        *result = NULL;
+    };
+    return bench;
+}
+
+// ------------------------------------------------------------------------------------------------
+struct PostProcessCase {
+    const char* name;
+    unsigned int flags;
+    unsigned int prerequisites;
+};
+
+// post-processing steps timed on triangle meshes, in verbose format
+const PostProcessCase TriangleCases[] = {
+    { "JoinIdenticalVertices", aiProcess_JoinIdenticalVertices, 0 },
+    { "GenNormals", aiProcess_GenNormals | aiProcess_ForceGenNormals, 0 },
+    { "GenSmoothNormals", aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals, 0 },
+    { "CalcTangentSpace", aiProcess_CalcTangentSpace, 0 },
+    { "ValidateDataStructure", aiProcess_ValidateDataStructure, 0 },
+    { "MakeLeftHanded", aiProcess_MakeLeftHanded, 0 },
+    { "FlipWindingOrder", aiProcess_FlipWindingOrder, 0 },
+    { "FixInfacingNormals", aiProcess_FixInfacingNormals, 0 },
+    { "FindDegenerates", aiProcess_FindDegenerates, 0 },
+    { "FindInvalidData", aiProcess_FindInvalidData, 0 },
+    { "SortByPType", aiProcess_SortByPType, 0 },
+    { "SplitLargeMeshes", aiProcess_SplitLargeMeshes, 0 },
+    { "PreTransformVertices", aiProcess_PreTransformVertices, 0 },
+    { "FindInstances", aiProcess_FindInstances, 0 },
+    { "OptimizeMeshes", aiProcess_OptimizeMeshes, 0 },
+    { "ImproveCacheLocality", aiProcess_ImproveCacheLocality, aiProcess_JoinIdenticalVertices },
+    { "TargetRealtime_MaxQuality", aiProcessPreset_TargetRealtime_MaxQuality, 0 },
+};
+
+// post-processing steps timed on quad meshes
+const PostProcessCase QuadCases[] = {
+    { "Triangulate", aiProcess_Triangulate, 0 },
+    { "JoinIdenticalVertices", aiProcess_JoinIdenticalVertices, 0 },
+    { "GenSmoothNormals", aiProcess_GenSmoothNormals, 0 },
+};
+
+// ------------------------------------------------------------------------------------------------
+void RegisterPostProcessBenchmarks(std::vector<Benchmark>& benchmarks, bool large) {
+    // sphere tesselation 4..7 yields 15k, 61k, 246k and 983k vertices
+    for (unsigned int tess = 4; tess <= (large ? 7u : 6u); ++tess) {
+        const std::shared_ptr<const aiScene> sphere(MakeSphereScene(tess, true));
+        const std::string suffix = "/sphere-" + std::to_string(CountVertices(sphere.get()));
+        for (const PostProcessCase& c : TriangleCases) {
+            benchmarks.push_back(MakePostProcessBenchmark(std::string("postprocess/") + c.name + suffix,
+                sphere, c.flags, c.prerequisites));
+        }
+    }
+
+    // subdivision level 4..7 yields 6k, 24k, 98k and 393k vertices
+    for (unsigned int levels = 4; levels <= (large ? 7u : 6u); ++levels) {
+        const std::shared_ptr<const aiScene> cube(MakeSubdividedCubeScene(levels));
+        const std::string suffix = "/subdivided-cube-" + std::to_string(CountVertices(cube.get()));
+        for (const PostProcessCase& c : QuadCases) {
+            benchmarks.push_back(MakePostProcessBenchmark(std::string("postprocess/") + c.name + suffix,
+                cube, c.flags, c.prerequisites));
+        }
+        benchmarks.push_back(MakeSubdivisionBenchmark("subdivide/catmull-clark" + suffix, levels));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GetOption(const char* arg, const char* name, std::string& value) {
+    const size_t len = strlen(name);
+    if (0 != strncmp(arg, name, len) || arg[len] != '=') {
+        return false;
+    }
+    value = arg + len + 1;
+    return true;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    Options options;
+    Format format = Format_Console;
+    std::string filter, outFile, models = ASSIMP_BENCH_MODELS_DIR;
+    bool large = false, list = false, corpus = true;
+    std::vector<std::string> extraFiles;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+        if (!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h")) {
+            printf("%s", AIBENCH_MSG_HELP);
+            return 0;
+        } else if (!strcmp(argv[i], "--large")) {
+            large = true;
+        } else if (!strcmp(argv[i], "--list")) {
+            list = true;
+        } else if (!strcmp(argv[i], "--no-corpus")) {
+            corpus = false;
+        } else if (GetOption(argv[i], "--filter", value)) {
+            filter = value;
+        } else if (GetOption(argv[i], "--out", value)) {
+            outFile = value;
+        } else if (GetOption(argv[i], "--models", value)) {
+            models = value;
+        } else if (GetOption(argv[i], "--min-time", value)) {
+            options.minTime = atof(value.c_str());
+        } else if (GetOption(argv[i], "--min-iterations", value)) {
+            options.minIterations = static_cast<unsigned int>(atoi(value.c_str()));
+        } else if (GetOption(argv[i], "--max-iterations", value)) {
+            options.maxIterations = std::max(1, atoi(value.c_str()));
+        } else if (GetOption(argv[i], "--format", value)) {
+            if (value == "json") {
+                format = Format_Json;
+            } else if (value == "csv") {
+                format = Format_Csv;
+            } else if (value == "console") {
+                format = Format_Console;
+            } else {
+                fprintf(stderr, "assimp_bench: unknown format '%s'\n", value.c_str());
+                return 1;
+            }
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "assimp_bench: unknown option '%s', see --help\n", argv[i]);
+            return 1;
+        } else {
+            extraFiles.push_back(argv[i]);
+        }
+    }
+
+    // register the benchmarks
+    std::vector<Benchmark> benchmarks;
+    {
+        Assimp::Importer probe;
+        std::vector<std::string> files;
+        if (corpus) {
+            CollectFiles(models, std::string(), files);
+            std::sort(files.begin(), files.end());
+        }
+        for (const std::string& file : files) {
+            const std::string::size_type dot = file.find_last_of('.');
+            if (dot != std::string::npos && probe.IsExtensionSupported(file.substr(dot).c_str())) {
+                benchmarks.push_back(MakeImportBenchmark("import/" + file, models + "/" + file));
+            }
+        }
+        for (const std::string& file : extraFiles) {
+            benchmarks.push_back(MakeImportBenchmark("import/" + file, file));
+        }
+    }
+    RegisterPostProcessBenchmarks(benchmarks, large);
+
+    if (!filter.empty()) {
+        benchmarks.erase(std::remove_if(benchmarks.begin(), benchmarks.end(), [&filter](const Benchmark& b) {
+            return b.name.find(filter) == std::string::npos;
+        }), benchmarks.end());
+    }
+
+    if (list) {
+        for (const Benchmark& bench : benchmarks) {
+            printf("%s\n", bench.name.c_str());
+        }
+        return 0;
+    }
+
+    std::ofstream file;
+    if (!outFile.empty()) {
+        file.open(outFile.c_str());
+        if (!file) {
+            fprintf(stderr, "assimp_bench: unable to open '%s' for writing\n", outFile.c_str());
+            return 1;
+        }
+    }
+    std::ostream& out = outFile.empty() ? std::cout : file;
+
+    // progress goes to stderr unless the console table is written to stdout anyway
+    const bool streamConsole = format == Format_Console && outFile.empty();
+    std::vector<Result> results;
+    results.reserve(benchmarks.size());
+    unsigned int failed = 0;
+    for (const Benchmark& bench : benchmarks) {
+        results.push_back(RunBenchmark(bench, options));
+        failed += results.back().error.empty() ? 0 : 1;
+        WriteConsoleLine(streamConsole ? std::cout : std::cerr, results.back());
+    }
+
+    if (!streamConsole) {
+        WriteResults(out, format, options, results);
+    }
+    fprintf(stderr, "assimp_bench: %u benchmarks, %u failed\n", static_cast<unsigned int>(results.size()), failed);
+    return failed || !out ? 1 : 0;
+}
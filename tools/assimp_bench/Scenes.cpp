@@ -0,0 +1,128 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Scenes.cpp
+ *  @brief Implementation of the synthetic benchmark scenes
+ */
+
+#include "Scenes.h"
+
+#include <assimp/scene.h>
+#include <assimp/StandardShapes.h>
+#include <assimp/Subdivision.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace AssimpBench {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+aiScene* WrapMesh(aiMesh* mesh) {
+    aiScene* scene = new aiScene();
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh*[1];
+    scene->mMeshes[0] = mesh;
+
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial*[1];
+    scene->mMaterials[0] = new aiMaterial();
+
+    scene->mRootNode = new aiNode();
+    scene->mRootNode->mName.Set("root");
+    scene->mRootNode->mNumMeshes = 1;
+    scene->mRootNode->mMeshes = new unsigned int[1];
+    scene->mRootNode->mMeshes[0] = 0;
+    return scene;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+aiScene* MakeSphereScene(unsigned int tess, bool withNormalsAndUVs) {
+    std::vector<aiVector3D> positions;
+    Assimp::StandardShapes::MakeSphere(tess, positions);
+    aiMesh* mesh = Assimp::StandardShapes::MakeMesh(positions, 3);
+
+    if (withNormalsAndUVs) {
+        const ai_real pi = static_cast<ai_real>(AI_MATH_PI);
+        mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+        mesh->mNumUVComponents[0] = 2;
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const aiVector3D n = aiVector3D(mesh->mVertices[i]).Normalize();
+            mesh->mNormals[i] = n;
+            mesh->mTextureCoords[0][i] = aiVector3D(
+                std::atan2(n.z, n.x) / (2 * pi) + ai_real(0.5),
+                std::asin(std::max(ai_real(-1.0), std::min(ai_real(1.0), n.y))) / pi + ai_real(0.5),
+                ai_real(0.0));
+        }
+    }
+    return WrapMesh(mesh);
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene* MakeSubdividedCubeScene(unsigned int levels) {
+    std::vector<aiVector3D> positions;
+    const unsigned int numIndices = Assimp::StandardShapes::MakeHexahedron(positions, true);
+    aiMesh* mesh = Assimp::StandardShapes::MakeMesh(positions, numIndices);
+
+    std::unique_ptr<Assimp::Subdivider> subdivider(Assimp::Subdivider::Create(Assimp::Subdivider::CATMULL_CLARKE));
+    aiMesh* out = NULL;
+    subdivider->Subdivide(mesh, out, levels, true);
+    return WrapMesh(out);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CountVertices(const aiScene* scene) {
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        count += scene->mMeshes[i]->mNumVertices;
+    }
+    return count;
+}
+
+} // namespace AssimpBench
@@ -0,0 +1,71 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2019, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  Scenes.h
+ *  @brief Synthetic scenes for the post-processing benchmarks
+ */
+
+#ifndef AIBENCH_SCENES_INCLUDED
+#define AIBENCH_SCENES_INCLUDED
+
+struct aiScene;
+
+namespace AssimpBench {
+
+// ------------------------------------------------------------------------------------------------
+/** Creates a scene holding a single triangulated sphere with 20*4^tess faces, in
+ *  verbose format. Vertex normals and spherical texture coordinates are added if
+ *  requested. */
+aiScene* MakeSphereScene(unsigned int tess, bool withNormalsAndUVs);
+
+// ------------------------------------------------------------------------------------------------
+/** Creates a scene holding a single quad mesh with 6*4^levels faces, in verbose
+ *  format. It is a cube smoothed by the given number of Catmull-Clark subdivisions. */
+aiScene* MakeSubdividedCubeScene(unsigned int levels);
+
+// ------------------------------------------------------------------------------------------------
+/** Returns the total number of vertices of all meshes in a scene */
+unsigned int CountVertices(const aiScene* scene);
+
+} // namespace AssimpBench
+
+#endif // AIBENCH_SCENES_INCLUDED